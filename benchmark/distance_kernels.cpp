@@ -0,0 +1,42 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <hist/detail/CompactCoordinates.h>
+#include <hist/distribution/GenericDistribution1D.h>
+#include <hist/distance_calculator/detail/TemplateHelpers.h>
+#include <data/Molecule.h>
+#include <constants/Axes.h>
+#include <settings/MoleculeSettings.h>
+#include <settings/GeneralSettings.h>
+
+// The innermost loops of the histogram managers, evaluated on a single thread for all pairs of atoms in 2epe.
+template<bool use_weighted_distribution, int stride>
+auto evaluate_all(const hist::detail::CompactCoordinates& data) {
+    typename hist::GenericDistribution1D<use_weighted_distribution>::type p(constants::axes::d_axis.bins);
+    int size = static_cast<int>(data.size());
+    for (int i = 0; i < size; ++i) {
+        int j = i+1;
+        if constexpr (stride == 8) {
+            for (; j+7 < size; j+=8) {evaluate8<use_weighted_distribution, 2>(p, data, data, i, j);}
+        }
+        if constexpr (4 <= stride) {
+            for (; j+3 < size; j+=4) {evaluate4<use_weighted_distribution, 2>(p, data, data, i, j);}
+        }
+        for (; j < size; ++j) {evaluate1<use_weighted_distribution, 2>(p, data, data, i, j);}
+    }
+    return p;
+}
+
+TEST_CASE("distance kernels", "[benchmark]") {
+    settings::general::verbose = false;
+    settings::molecule::use_effective_charge = false;
+    data::Molecule protein("test/files/2epe.pdb");
+    hist::detail::CompactCoordinates data(protein.get_bodies());
+
+    BENCHMARK("evaluate1") {return evaluate_all<false, 1>(data);};
+    BENCHMARK("evaluate4") {return evaluate_all<false, 4>(data);};
+    BENCHMARK("evaluate8") {return evaluate_all<false, 8>(data);};
+    BENCHMARK("evaluate1 weighted") {return evaluate_all<true, 1>(data);};
+    BENCHMARK("evaluate4 weighted") {return evaluate_all<true, 4>(data);};
+    BENCHMARK("evaluate8 weighted") {return evaluate_all<true, 8>(data);};
+}
\ No newline at end of file
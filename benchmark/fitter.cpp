@@ -0,0 +1,34 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <fitter/HydrationFitter.h>
+#include <fitter/ExcludedVolumeFitter.h>
+#include <fitter/Fit.h>
+#include <hist/intensity_calculator/ICompositeDistanceHistogram.h>
+#include <data/Molecule.h>
+#include <io/ExistingFile.h>
+#include <settings/HistogramSettings.h>
+#include <settings/MoleculeSettings.h>
+#include <settings/GeneralSettings.h>
+#include <settings/FitSettings.h>
+
+TEST_CASE("fitters", "[benchmark]") {
+    settings::general::verbose = false;
+    settings::fit::verbose = false;
+    settings::molecule::use_effective_charge = false;
+    settings::hist::histogram_manager = settings::hist::HistogramManagerChoice::HistogramManagerMTFFAvg;
+    data::Molecule protein("test/files/2epe.pdb");
+    protein.generate_new_hydration();
+    io::ExistingFile mfile("test/files/2epe.dat");
+
+    fitter::HydrationFitter hydration_fitter(mfile, protein.get_histogram());
+    BENCHMARK("HydrationFitter::fit_chi2_only") {return hydration_fitter.fit_chi2_only();};
+    BENCHMARK("HydrationFitter::fit") {return hydration_fitter.fit();};
+
+    // the excluded volume fit is multi-dimensional, and thus requires one of the dlib minimizers
+    #if defined(DLIB_AVAILABLE)
+        fitter::ExcludedVolumeFitter exv_fitter(mfile, protein.get_histogram());
+        BENCHMARK("ExcludedVolumeFitter::fit_chi2_only") {return exv_fitter.fit_chi2_only();};
+        BENCHMARK("ExcludedVolumeFitter::fit") {return exv_fitter.fit();};
+    #endif
+}
\ No newline at end of file
@@ -0,0 +1,56 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <hist/distance_calculator/HistogramManagerFactory.h>
+#include <hist/distance_calculator/IHistogramManager.h>
+#include <hist/intensity_calculator/ICompositeDistanceHistogram.h>
+#include <data/Molecule.h>
+#include <settings/HistogramSettings.h>
+#include <settings/MoleculeSettings.h>
+#include <settings/GeneralSettings.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+using settings::hist::HistogramManagerChoice;
+
+namespace {
+    const std::vector<std::pair<HistogramManagerChoice, std::string>> managers = {
+        {HistogramManagerChoice::HistogramManager, "HistogramManager"},
+        {HistogramManagerChoice::HistogramManagerMT, "HistogramManagerMT"},
+        {HistogramManagerChoice::HistogramManagerMTFFAvg, "HistogramManagerMTFFAvg"},
+        {HistogramManagerChoice::HistogramManagerMTFFExplicit, "HistogramManagerMTFFExplicit"},
+        {HistogramManagerChoice::HistogramManagerMTFFGrid, "HistogramManagerMTFFGrid"},
+        {HistogramManagerChoice::PartialHistogramManager, "PartialHistogramManager"},
+        {HistogramManagerChoice::PartialHistogramManagerMT, "PartialHistogramManagerMT"}
+    };
+}
+
+TEST_CASE("histogram managers", "[benchmark]") {
+    settings::general::verbose = false;
+    settings::molecule::use_effective_charge = false;
+    data::Molecule protein("test/files/2epe.pdb");
+    protein.generate_new_hydration();
+
+    // a new manager is constructed for every run, since the partial managers would otherwise only return their cached result
+    for (const auto& [choice, name] : managers) {
+        BENCHMARK(name + "::calculate_all") {
+            return hist::factory::construct_histogram_manager(&protein, choice)->calculate_all();
+        };
+    }
+}
+
+TEST_CASE("Debye transforms", "[benchmark]") {
+    settings::general::verbose = false;
+    settings::molecule::use_effective_charge = false;
+    data::Molecule protein("test/files/2epe.pdb");
+    protein.generate_new_hydration();
+
+    // the managers with the same intensity calculator are skipped
+    for (const auto& [choice, name] : managers) {
+        if (choice == HistogramManagerChoice::HistogramManager || choice == HistogramManagerChoice::PartialHistogramManager || choice == HistogramManagerChoice::PartialHistogramManagerMT) {continue;}
+        auto h = hist::factory::construct_histogram_manager(&protein, choice)->calculate_all();
+        BENCHMARK(name + "::debye_transform") {return h->debye_transform();};
+    }
+}
\ No newline at end of file
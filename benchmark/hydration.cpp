@@ -0,0 +1,69 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <hydrate/Grid.h>
+#include <hydrate/GridMember.h>
+#include <hydrate/placement/PlacementFactory.h>
+#include <hydrate/culling/CullingFactory.h>
+#include <data/Molecule.h>
+#include <data/record/Water.h>
+#include <settings/GridSettings.h>
+#include <settings/MoleculeSettings.h>
+#include <settings/GeneralSettings.h>
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+TEST_CASE("hydration", "[benchmark]") {
+    settings::general::verbose = false;
+    data::Molecule protein("test/files/2epe.pdb");
+
+    // the placement and culling strategies modify the grid, so each run is given its own expanded grid
+    auto prepare = [&protein] (int runs) {
+        std::vector<std::unique_ptr<grid::Grid>> grids(runs);
+        for (auto& grid : grids) {
+            grid = std::make_unique<grid::Grid>(protein.get_bodies());
+            grid->expand_volume();
+        }
+        return grids;
+    };
+
+    BENCHMARK("Grid::Grid") {return grid::Grid(protein.get_bodies());};
+
+    BENCHMARK_ADVANCED("Grid::hydrate")(Catch::Benchmark::Chronometer meter) {
+        auto grids = prepare(meter.runs());
+        meter.measure([&grids] (int i) {return grids[i]->hydrate();});
+    };
+
+    for (const auto& [strategy, name] : std::vector<std::pair<settings::grid::PlacementStrategy, std::string>>{
+        {settings::grid::PlacementStrategy::AxesStrategy, "AxesPlacement"},
+        {settings::grid::PlacementStrategy::RadialStrategy, "RadialPlacement"},
+        {settings::grid::PlacementStrategy::JanStrategy, "JanPlacement"}
+    }) {
+        BENCHMARK_ADVANCED(name + "::place")(Catch::Benchmark::Chronometer meter) {
+            auto grids = prepare(meter.runs());
+            meter.measure([&grids, strategy] (int i) {return grid::factory::construct_placement_strategy(grids[i].get(), strategy)->place();});
+        };
+    }
+
+    for (const auto& [strategy, name] : std::vector<std::pair<settings::grid::CullingStrategy, std::string>>{
+        {settings::grid::CullingStrategy::CounterStrategy, "CounterCulling"},
+        {settings::grid::CullingStrategy::OutlierStrategy, "OutlierCulling"},
+        {settings::grid::CullingStrategy::RandomStrategy, "RandomCulling"}
+    }) {
+        BENCHMARK_ADVANCED(name + "::cull")(Catch::Benchmark::Chronometer meter) {
+            auto grids = prepare(meter.runs());
+            std::vector<std::vector<grid::GridMember<data::record::Water>>> placed(meter.runs());
+            for (int i = 0; i < meter.runs(); ++i) {
+                placed[i] = grid::factory::construct_placement_strategy(grids[i].get())->place();
+            }
+            meter.measure([&grids, &placed, strategy] (int i) {
+                auto culler = grid::factory::construct_culling_strategy(grids[i].get(), strategy);
+                culler->set_target_count(placed[i].size()/2);
+                return culler->cull(placed[i]);
+            });
+        };
+    }
+}
\ No newline at end of file
@@ -0,0 +1,15 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <data/detail/AtomCollection.h>
+#include <data/Molecule.h>
+#include <io/File.h>
+#include <settings/GeneralSettings.h>
+
+TEST_CASE("PDB parsing", "[benchmark]") {
+    settings::general::verbose = false;
+
+    BENCHMARK("AtomCollection 2epe") {return data::detail::AtomCollection(io::File("test/files/2epe.pdb"));};
+    BENCHMARK("AtomCollection LAR1-2") {return data::detail::AtomCollection(io::File("test/files/LAR1-2.pdb"));};
+    BENCHMARK("Molecule LAR1-2") {return data::Molecule("test/files/LAR1-2.pdb");};
+}
\ No newline at end of file
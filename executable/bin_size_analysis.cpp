@@ -98,19 +98,20 @@ auto exact = [] (const data::Molecule& molecule) {
     return I;
 };
 
-// Instructions: go vary constants::axes::d_axis bins a couple of times while running this program inbetween. 
+// Instructions: call it with the argument "setup" followed by a bin width a couple of times with different widths. 
 // When enough data has been collected, call it with the argument "plot" to plot the results.
 int main(int argc, char const *argv[]) {
     bool setup = false;
     bool structured = true;
     if (argc > 1 && std::string(argv[1]) == "setup") {
         setup = true;
+        if (argc > 2) {settings::axes::distance_bin_width = std::stod(argv[2]);}
     } else if (argc > 1 && std::string(argv[1]) == "plot") {
         structured = false;
     } else if (argc > 1 && std::string(argv[1]) == "plotx") {
         structured = true;
     } else {
-        std::cout << "Usage: " << argv[0] << " [setup|plot|plotx]" << std::endl;
+        std::cout << "Usage: " << argv[0] << " [setup <bin width>|plot|plotx]" << std::endl;
         return 1;
     }
 
@@ -140,7 +141,7 @@ int main(int argc, char const *argv[]) {
         std::string width;
         {
             std::stringstream ss;
-            ss << std::fixed << std::setprecision(2) << constants::axes::d_axis.width();
+            ss << std::fixed << std::setprecision(2) << settings::axes::distance_bin_width;
             width = ss.str();
         }
 
@@ -9,6 +9,7 @@
 #include <fitter/FitReporter.h>
 #include <settings/All.h>
 #include <utility/Constants.h>
+#include <utility/Trace.h>
 
 int main(int argc, char const *argv[]) {
     settings::protein::use_effective_charge = false;
@@ -24,6 +25,7 @@ int main(int argc, char const *argv[]) {
     app.add_option("--frequency", settings::em::sample_frequency, "Sampling frequency of the EM map.");
     app.add_flag("--hydrate,!--no-hydrate", settings::em::hydrate, "Whether to hydrate the protein before fitting.");
     app.add_flag("--fixed-weight,!--no-fixed-weight", settings::em::fixed_weights, "Whether to use a fixed weight for the fit.");
+    app.add_option_function<std::string>("--trace", utility::trace::start, "Save a trace of the time spent in each stage of the calculation at the given path, in the Chrome trace format.");
     CLI11_PARSE(app, argc, argv);
 
     //###################//
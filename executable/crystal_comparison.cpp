@@ -10,12 +10,14 @@
 #include <io/ExistingFile.h>
 #include <data/Molecule.h>
 #include <hist/intensity_calculator/ICompositeDistanceHistogram.h>
+#include <utility/Trace.h>
 
 int main(int argc, char const *argv[]) {
     io::ExistingFile crystal;
     CLI::App app{"Crystal Scattering"};
     app.add_option("input", crystal, "File containing the crystal data.")->required();
     app.add_option("--output,-o", settings::general::output, "Path to save the generated figures at.")->default_val("output/crystal_compare/");
+    app.add_option_function<std::string>("--trace", utility::trace::start, "Save a trace of the time spent in each stage of the calculation at the given path, in the Chrome trace format.");
     CLI11_PARSE(app, argc, argv);
     settings::general::output += crystal.stem() + "/";
     settings::crystal::detail::use_checkpointing = false;
@@ -10,12 +10,14 @@
 #include <data/Molecule.h>
 #include <settings/All.h>
 #include <plots/All.h>
+#include <utility/Trace.h>
 
 int main(int argc, char const *argv[]) {
     io::File crystal;
     CLI::App app{"Crystal Scattering"};
     app.add_option("input", crystal, "File containing the crystal data.")->required();
     app.add_option("--output,-o", settings::general::output, "Path to save the generated figures at.")->default_val("output/crystal/");
+    app.add_option_function<std::string>("--trace", utility::trace::start, "Save a trace of the time spent in each stage of the calculation at the given path, in the Chrome trace format.");
     CLI11_PARSE(app, argc, argv);
     settings::general::output += crystal.stem() + "/";
 
@@ -12,6 +12,7 @@
 #include <constants/Constants.h>
 #include <em/manager/ProteinManager.h>
 #include <hist/intensity_calculator/CompositeDistanceHistogram.h>
+#include <utility/Trace.h>
 
 int main(int argc, char const *argv[]) {
     settings::hist::weighted_bins = false;
@@ -35,6 +36,7 @@ int main(int argc, char const *argv[]) {
     app.add_flag("--mass-axis,!--no-mass-axis", settings::em::mass_axis, "Whether to use a mass axis in place of the threshold axis.");
     app.add_flag("--hydrate,!--no-hydrate", settings::em::hydrate, "Whether to hydrate the protein before fitting.");
     app.add_flag("--fixed-weight,!--no-fixed-weight", settings::em::fixed_weights, "Whether to use a fixed weight for the fit.");
+    app.add_option_function<std::string>("--trace", utility::trace::start, "Save a trace of the time spent in each stage of the calculation at the given path, in the Chrome trace format.");
     CLI11_PARSE(app, argc, argv);
 
     //###################//
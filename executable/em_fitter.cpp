@@ -7,6 +7,8 @@
 #include <fitter/FitReporter.h>
 #include <settings/All.h>
 #include <constants/Constants.h>
+#include <utility/Trace.h>
+#include <utility/Memory.h>
 
 #include <iostream>
 
@@ -25,6 +27,7 @@ int main(int argc, char const *argv[]) {
     auto p_settings = app.add_option("-s,--settings", settings, "Path to the settings file.")->check(CLI::ExistingFile);
     app.add_option("--output,-o", settings::general::output, "Path to save the generated figures at.")->default_val("output/em_fitter/");
     app.add_option("--threads,-t", settings::general::threads, "Number of threads to use.")->default_val(settings::general::threads);
+    app.add_option("--memory-budget", settings::general::memory_budget, "Memory budget in MB. If exceeded, lower-memory strategies are used at the cost of performance. Use 0 for no budget.");
     app.add_option("--qmin", settings::axes::qmin, "Lower limit on used q values from measurement file.");
     app.add_option("--qmax", settings::axes::qmax, "Upper limit on used q values from measurement file.");
     app.add_option("--levelmin", settings::em::alpha_levels.min, "Lower limit on the alpha levels to use for the EM map. Note that lowering this limit severely impacts the performance and memory load.");
@@ -36,6 +39,7 @@ int main(int argc, char const *argv[]) {
     app.add_flag("--verbose,!--quiet", settings::fit::verbose, "Print the progress of the fit to the console.");
     app.add_flag("--weighted-bins, --!no-weighted-bins", settings::hist::weighted_bins, "Use weighted bins for the distance histograms.")->default_val(settings::hist::weighted_bins)->group("Hidden");
     app.add_flag_callback("--licence", [] () {std::cout << constants::licence << std::endl; exit(0);}, "Print the licence.");
+    app.add_option_function<std::string>("--trace", utility::trace::start, "Save a trace of the time spent in each stage of the calculation at the given path, in the Chrome trace format.");
     CLI11_PARSE(app, argc, argv);
 
     console::print_info("Running AUSAXS" + constants::version);
@@ -78,6 +82,7 @@ int main(int argc, char const *argv[]) {
 
     fitter::FitReporter::report(res.get());
     fitter::FitReporter::save(res.get(), settings::general::output + "report.txt", cmd_line);
+    utility::memory::print_summary();
 
     res->figures.data.save(settings::general::output + mfile.stem() + ".scat");
     res->figures.intensity_interpolated.save(settings::general::output + "fit.fit");
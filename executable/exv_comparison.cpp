@@ -14,6 +14,7 @@
 #include <dataset/SimpleDataset.h>
 #include <settings/All.h>
 #include <plots/All.h>
+#include <utility/Trace.h>
 
 #include <sstream>
 
@@ -22,6 +23,7 @@ int main(int argc, char const *argv[]) {
     CLI::App app{"Generate a new hydration layer and fit the resulting scattering intensity histogram for a given input data file."};
     app.add_option("input_s", s_pdb, "Path to the structure file.")->required()->check(CLI::ExistingFile);
     app.add_option("--output,-o", settings::general::output, "Path to save the generated figures at.")->default_val("output/exv_comparison/")->group("General options");
+    app.add_option_function<std::string>("--trace", utility::trace::start, "Save a trace of the time spent in each stage of the calculation at the given path, in the Chrome trace format.");
     CLI11_PARSE(app, argc, argv);
 
     //### GENERATE INTERNAL PLOT ###//
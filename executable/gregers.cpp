@@ -11,6 +11,7 @@
 #include <utility/Constants.h>
 #include <mini/dlibMinimizer.h>
 #include <mini/detail/Parameter.h>
+#include <utility/Trace.h>
 
 #include <iostream>
 #include <unordered_set>
@@ -35,6 +36,7 @@ int main(int argc, char const *argv[]) {
     auto p_settings = app.add_option("-s,--settings", settings, "Path to the settings file.")->check(CLI::ExistingFile);
     // app.add_flag("--hydrate,!--no-hydrate", settings::em::hydrate, "Whether to hydrate the protein before fitting.");
     // app.add_flag("--fixed-weight,!--no-fixed-weight", settings::em::fixed_weights, "Whether to use a fixed weight for the fit.");
+    app.add_option_function<std::string>("--trace", utility::trace::start, "Save a trace of the time spent in each stage of the calculation at the given path, in the Chrome trace format.");
     CLI11_PARSE(app, argc, argv);
     
     // if a settings file was provided
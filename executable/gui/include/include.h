@@ -222,7 +222,8 @@ auto q_slider(gui::view& view) {
 		}
 
 		waiting = true;
-		worker = std::thread([&view] () {
+		worker = std::thread([&view, context = settings::Context()] () {
+			settings::ScopedContext scope(context);
 			do {
 				extend_wait = false;
 				std::this_thread::sleep_for(std::chrono::milliseconds(500));			
@@ -404,7 +405,8 @@ auto alpha_level_slider(gui::view& view) {
 		}
 
 		waiting = true;
-		worker = std::thread([&view, axis_transform] () {
+		worker = std::thread([&view, axis_transform, context = settings::Context()] () {
+			settings::ScopedContext scope(context);
 			do {
 				extend_wait = false;
 				std::this_thread::sleep_for(std::chrono::milliseconds(500));			
@@ -12,6 +12,7 @@
 #include <fitter/Fit.h>
 #include <settings/All.h>
 #include <plots/All.h>
+#include <utility/Job.h>
 
 #include <bitset>
 
@@ -40,16 +41,18 @@ auto make_start_button(gui::view& view) {
 	static auto deck = gui::deck_composite();
 	deck.push_back(gui::share(start_button_layout));
 
-	static std::thread worker;
+	// starting a new fit cancels the previous one, such that stale work is dropped immediately
+	static utility::job::Job<void> fit_job;
 	start_button.on_click = [&view] (bool) {
 		if (!setup::saxs_dataset || !io::File(settings::pdb_file).exists()) {
 			std::cout << "no saxs data or pdb file was provided" << std::endl;
 			std::this_thread::sleep_for(std::chrono::milliseconds(500));
 			return;
 		}
+		fit_job = {}; // the previous fit must be stopped before its molecule is replaced
 		setup::pdb = std::make_unique<data::Molecule>(settings::pdb_file);
 		view.refresh();
-		worker = std::thread([&view] () {
+		fit_job = utility::job::run([&view] () {
 			bool fit_excluded_volume = false; //!
 
 			std::shared_ptr<fitter::HydrationFitter> fitter;
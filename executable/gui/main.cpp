@@ -15,6 +15,7 @@
 #include <settings/All.h>
 #include <utility/Limit2D.h>
 #include <utility/MultiThreading.h>
+#include <utility/Job.h>
 #include <fitter/FitReporter.h>
 #include <shell/Command.h>
 #include <logo.h>
@@ -474,7 +475,8 @@ auto q_slider(gui::view& view) {
 		}
 
 		waiting = true;
-		worker = std::thread([&view] () {
+		worker = std::thread([&view, context = settings::Context()] () {
+			settings::ScopedContext scope(context);
 			do {
 				extend_wait = false;
 				std::this_thread::sleep_for(std::chrono::milliseconds(500));			
@@ -656,7 +658,8 @@ auto alpha_level_slider(gui::view& view) {
 		}
 
 		waiting = true;
-		worker = std::thread([&view, axis_transform] () {
+		worker = std::thread([&view, axis_transform, context = settings::Context()] () {
+			settings::ScopedContext scope(context);
 			do {
 				extend_wait = false;
 				std::this_thread::sleep_for(std::chrono::milliseconds(500));			
@@ -923,7 +926,8 @@ auto make_start_button(gui::view& view) {
 	deck.push_back(gui::share(start_button_layout));
 	deck.push_back(gui::share(progress_bar_layout));
 
-	static std::thread worker;
+	// starting a new fit cancels the previous one, such that stale work is dropped immediately
+	static utility::job::Job<void> fit_job;
 	start_button.on_click = [&view] (bool) {
 		if (!setup::saxs_dataset || !setup::map) {
 			std::cout << "no saxs data or map file was provided" << std::endl;
@@ -931,15 +935,15 @@ auto make_start_button(gui::view& view) {
 			return;
 		}
 
-		static auto observer = setup::map->get_progress_observer();
-		observer->on_notify = [&view] (int progress) {
-			progress_bar.value(float(progress)/(2*settings::fit::max_iterations));
+		auto on_progress = [&view] (const utility::job::Progress& progress) {
+			if (progress.stage != "ImageStack::fit" || progress.total == 0) {return;}
+			progress_bar.value(float(progress.step)/progress.total);
 			view.refresh(deck);
 		};
 
 		deck.select(1);
 		view.refresh();
-		worker = std::thread([&view] () {
+		fit_job = utility::job::run([&view] () {
 			auto res = setup::map->fit(settings::saxs_file);
 
 			// small animation to make the bar reach 100%
@@ -1002,7 +1006,7 @@ auto make_start_button(gui::view& view) {
 
 			deck.push_back(gui::share(image_viewer_layout));
 			deck.select(2);
-		});
+		}, on_progress);
 	};
 
 	return link(deck);
@@ -16,6 +16,8 @@
 #include <hist/intensity_calculator/ICompositeDistanceHistogramExv.h>
 #include <hist/intensity_calculator/CompositeDistanceHistogram.h>
 #include <utility/Console.h>
+#include <utility/Trace.h>
+#include <utility/Memory.h>
 
 #include <vector>
 #include <string>
@@ -31,6 +33,7 @@ int main(int argc, char const *argv[]) {
     app.add_option("input_m", s_mfile, "Path to the measured data.")->required()->check(CLI::ExistingFile);
     app.add_option("--output,-o", settings::general::output, "Path to save the generated figures at.")->default_val("output/intensity_fitter/")->group("General options");
     app.add_option("--threads,-t", settings::general::threads, "Number of threads to use.")->default_val(settings::general::threads)->group("General options");
+    app.add_option("--memory-budget", settings::general::memory_budget, "Memory budget in MB. If exceeded, lower-memory strategies are used at the cost of performance. Use 0 for no budget.")->default_val(settings::general::memory_budget)->group("General options");
     app.add_option("--qmax", settings::axes::qmax, "Upper limit on used q values from the measurement file.")->default_val(settings::axes::qmax)->group("General options");
     app.add_option("--qmin", settings::axes::qmin, "Lower limit on used q values from the measurement file.")->default_val(settings::axes::qmin)->group("General options");
     auto p_settings = app.add_option("-s,--settings", s_settings, "Path to the settings file.")->check(CLI::ExistingFile)->group("General options");
@@ -51,6 +54,7 @@ int main(int argc, char const *argv[]) {
     app.add_option("--rvol", settings::grid::rvol, "The radius of the excluded volume sphere around each atom.")->default_val(settings::grid::rvol)->group("Hidden");
     app.add_flag("--save_exv", settings::grid::save_exv, "Decides whether the excluded volume will be saved.")->default_val(settings::grid::save_exv)->group("Hidden");
     app.add_flag_callback("--licence", [] () {std::cout << constants::licence << std::endl; exit(0);}, "Print the licence.");
+    app.add_option_function<std::string>("--trace", utility::trace::start, "Save a trace of the time spent in each stage of the calculation at the given path, in the Chrome trace format.");
     CLI11_PARSE(app, argc, argv);
 
     std::cout << "Running AUSAXS " << constants::version << std::endl;
@@ -119,6 +123,7 @@ int main(int argc, char const *argv[]) {
     std::shared_ptr<fitter::Fit> result = fitter->fit();
     fitter::FitReporter::report(result.get());
     fitter::FitReporter::save(result.get(), settings::general::output + "report.txt");
+    utility::memory::print_summary();
 
     plots::PlotDistance::quick_plot(fitter->get_scattering_hist(), settings::general::output + "p(r)." + settings::plots::format);
     plots::PlotProfiles::quick_plot(fitter->get_scattering_hist(), settings::general::output + "profiles." + settings::plots::format);
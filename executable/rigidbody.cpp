@@ -12,6 +12,8 @@
 #include <settings/All.h>
 #include <io/File.h>
 #include <fitter/HydrationFitter.h>
+#include <utility/Trace.h>
+#include <utility/Memory.h>
 
 int main(int argc, char const *argv[]) { 
     settings::grid::scaling = 2;
@@ -31,15 +33,23 @@ int main(int argc, char const *argv[]) {
     auto p_cal = app.add_option("--calibrate", settings::rigidbody::detail::calibration_file, "Path to the calibration data.")->expected(0, 1)->check(CLI::ExistingFile);
     app.add_option("--reduce,-r", settings::grid::percent_water, "The desired number of water molecules as a percentage of the number of atoms. Use 0 for no reduction.");
     app.add_option("--grid_width,-w", settings::grid::width, "The distance between each grid point in Ångström (default: 1). Lower widths increase the precision.");
-    app.add_option("--bin_width", settings::axes::distance_bin_width, "Bin width for the distance histograms. Default: 1.");
+    app.add_option("--bin_width", settings::axes::distance_bin_width, "Bin width for the distance histograms. Default: 0.1.");
     app.add_option("--placement_strategy", placement_strategy, "The placement strategy to use. Options: Radial, Axes, Jan.");
     app.add_option("--qmin", settings::axes::qmin, "Lower limit on used q values from measurement file.");
     app.add_option("--qmax", settings::axes::qmax, "Upper limit on used q values from measurement file.");
     auto p_settings = app.add_option("-s,--settings", settings, "Path to the settings file.")->check(CLI::ExistingFile);
+    app.add_option("--memory-budget", settings::general::memory_budget, "Memory budget in MB. If exceeded, lower-memory strategies are used at the cost of performance. Default: 0 (no budget).");
     app.add_option("--iterations", settings::rigidbody::iterations, "Maximum number of iterations. Default: 1000.");
+    app.add_option("--replicas", settings::rigidbody::replicas, "Number of parallel-tempering replicas. Default: 1 (no tempering).");
+    app.add_option("--max-temperature", settings::rigidbody::max_temperature, "Temperature of the hottest parallel-tempering replica in units of chi2. Default: 10.");
+    app.add_option("--swap-interval", settings::rigidbody::swap_interval, "Number of steps between parallel-tempering swap attempts. Default: 10.");
+    app.add_option("--speculative-moves", settings::rigidbody::speculative_moves, "Number of candidate moves evaluated concurrently in each step. Default: 1 (serial).");
+    app.add_option("--seed", settings::rigidbody::seed, "Seed of the random number generators, making the optimization reproducible. Default: 0 (random).");
+    app.add_flag("--checkpoint,!--no-checkpoint", settings::rigidbody::use_checkpointing, "Decides whether checkpoints are written during the optimization, and resumed from if present. Default: false.");
     app.add_option("--constraints", settings::rigidbody::detail::constraints, "Constraints to apply to the rigid body.");
     app.add_flag("--center,!--no-center", settings::protein::center, "Decides whether the protein will be centered. Default: true.");
     app.add_flag("--effective-charge,!--no-effective-charge", settings::protein::use_effective_charge, "Decides whether the protein will be centered. Default: true.");
+    app.add_option_function<std::string>("--trace", utility::trace::start, "Save a trace of the time spent in each stage of the calculation at the given path, in the Chrome trace format.");
     CLI11_PARSE(app, argc, argv);
     std::cout << "Running AUSAXS " << constants::version << std::endl;
 
@@ -115,6 +125,7 @@ int main(int argc, char const *argv[]) {
     }
     fitter::FitReporter::report(res);
     fitter::FitReporter::save(res, settings::general::output + "fit.txt");
+    utility::memory::print_summary();
     plots::PlotIntensityFit::quick_plot(res, settings::general::output + "fit.png");
     return 0;
 }
\ No newline at end of file
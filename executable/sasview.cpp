@@ -1,16 +1,9 @@
-#include <settings/All.h>
-#include <dataset/Dataset.h>
+#include <api/sasview.h>
 #include <dataset/SimpleDataset.h>
-#include <data/record/Atom.h>
-#include <data/Molecule.h>
-#include <hist/intensity_calculator/CompositeDistanceHistogram.h>
-#include <plots/PlotHistogram.h>
-#include <utility/Utility.h>
+#include <utility/StringUtils.h>
 
 #include <fstream>
-
-using namespace data;
-using namespace data::record;
+#include <iostream>
 
 // args: <data file> <q file> <output file>
 // data file format:   | x | y | z | w |
@@ -18,11 +11,6 @@ using namespace data::record;
 // output file format: | q | I(q) |
 int main(int argc, char const *argv[]) {
     std::ios_base::sync_with_stdio(false);
-    settings::hist::histogram_manager = settings::hist::HistogramManagerChoice::HistogramManagerMT;
-    settings::molecule::use_effective_charge = false;
-    settings::molecule::implicit_hydrogens = false;
-    settings::hist::weighted_bins = true;
-    settings::axes::qmax = 1;
 
     // check args
     if (argc != 4) {
@@ -51,18 +39,21 @@ int main(int argc, char const *argv[]) {
         q.push_back(std::stod(line));
     }
 
-    std::vector<Atom> atoms; atoms.reserve(data.size());
+    std::vector<double> x(data.size()), y(data.size()), z(data.size()), w(data.size());
     for (unsigned int i = 0; i < data.size(); ++i) {
-        atoms.push_back(Atom({data[i][0], data[i][1], data[i][2]}, data[i][3], constants::atom_t::dummy, "", i));
+        x[i] = data[i][0]; y[i] = data[i][1]; z[i] = data[i][2]; w[i] = data[i][3];
     }
 
-    Molecule protein(atoms);
-    auto dist = protein.get_histogram();
-    plots::PlotHistogram::quick_plot(*dist.get(), {}, "histogram.png");
-    auto Iq = protein.get_histogram()->debye_transform();
-    for (unsigned int i = 0; i < Iq.size(); ++i) {
-        Iq[i] /= std::exp(-constants::axes::q_vals[i]*constants::axes::q_vals[i]);
+    // evaluate through the same interface as SasView
+    int status;
+    std::vector<double> Iq(q.size());
+    auto model = create_sans_model(x.data(), y.data(), z.data(), w.data(), x.size(), &status);
+    if (status == 0) {evaluate_sans_model(model, q.data(), q.size(), Iq.data(), &status);}
+    destroy_sans_model(model);
+    if (status != 0) {
+        std::cout << "Evaluation failed with status " << status << "." << std::endl;
+        return 1;
     }
-    Iq.as_dataset().interpolate(q).save(argv[3]);
-    return 1;
+    SimpleDataset(q, Iq).save(argv[3]);
+    return 0;
 }
\ No newline at end of file
@@ -9,6 +9,7 @@
 #include <fitter/Fit.h>
 #include <plots/all.h>
 #include <fitter/FitReporter.h>
+#include <utility/Trace.h>
 
 int main(int argc, char const *argv[]) {
     CLI::App app{"Calculate the scattering from a pdb structure."};
@@ -28,6 +29,7 @@ int main(int argc, char const *argv[]) {
     app.add_flag("--effective-charge,!--no-effective-charge", setting::protein::use_effective_charge, "Decides whether the effective atomic charge will be used. Default: true.");
     auto opt = app.add_flag("--use-existing-hydration,!--no-use-existing-hydration", use_existing_hydration, "Decides whether the hydration layer will be generated from scratch or if the existing one will be used. Default: false.");
     app.add_flag("--remove-h", remove_h, "Remove all hydrogens from the structure. Default: false.")->excludes(opt);
+    app.add_option_function<std::string>("--trace", utility::trace::start, "Save a trace of the time spent in each stage of the calculation at the given path, in the Chrome trace format.");
     CLI11_PARSE(app, argc, argv);
 
     //####################//
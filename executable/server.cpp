@@ -0,0 +1,215 @@
+#include <CLI/CLI.hpp>
+
+#include <data/Molecule.h>
+#include <fitter/HydrationFitter.h>
+#include <fitter/ExcludedVolumeFitter.h>
+#include <fitter/Fit.h>
+#include <mini/detail/FittedParameter.h>
+#include <hist/intensity_calculator/CompositeDistanceHistogram.h>
+#include <settings/All.h>
+#include <io/ExistingFile.h>
+#include <constants/Constants.h>
+#include <utility/TaskScheduler.h>
+#include <utility/Exceptions.h>
+#include <utility/Trace.h>
+
+#include <vector>
+#include <string>
+#include <sstream>
+#include <iostream>
+#include <mutex>
+#include <thread>
+
+#if defined(__unix__) || defined(__APPLE__)
+    #include <sys/socket.h>
+    #include <sys/un.h>
+    #include <unistd.h>
+#endif
+
+// A long-running fitting server. Since the process is kept alive between jobs, the residue database, the form factor and sinc tables,
+// and the worker threads are only set up once.
+//
+// Each request is a single line:
+//      <id> <structure> <measurement> [options]
+// where the options are the same as for the intensity_fitter. Each request is answered by a single line as soon as it is finished:
+//      <id> ok chi2=<chi2> dof=<dof> <parameter>=<value> ...
+//      <id> error <message>
+// Requests are read either from stdin, or from the connections of a Unix domain socket. All requests are processed concurrently.
+
+/**
+ * @brief Fit a single structure to a measurement.
+ *        The options of the request only apply to this job, since the settings are local to the thread running it.
+ */
+std::string run_job(const std::string& request) {
+    std::istringstream in(request);
+    std::string id, args;
+    in >> id;
+    std::getline(in, args);
+
+    try {
+        std::string s_pdb, s_mfile, s_fit, histogram_manager;
+        bool use_existing_hydration = false, fit_excluded_volume = false;
+        CLI::App app;
+        app.add_option("input_s", s_pdb)->required()->check(CLI::ExistingFile);
+        app.add_option("input_m", s_mfile)->required()->check(CLI::ExistingFile);
+        app.add_option("--fit", s_fit, "Path to save the fitted curve at.");
+        app.add_option("--qmax", settings::axes::qmax);
+        app.add_option("--qmin", settings::axes::qmin);
+        app.add_flag("--center,!--no-center", settings::molecule::center);
+        app.add_flag("--effective-charge,!--no-effective-charge", settings::molecule::use_effective_charge);
+        app.add_flag("--use-existing-hydration,!--no-use-existing-hydration", use_existing_hydration);
+        app.add_flag("--fit-excluded-volume,!--no-fit-excluded-volume", fit_excluded_volume);
+        app.add_option("--reduce,-r", settings::grid::water_scaling);
+        app.add_option("--grid_width,--gw", settings::grid::width);
+        app.add_option("--exv_radius,--er", settings::grid::exv_radius);
+        app.add_option("--histogram-manager,--hm", histogram_manager);
+        app.add_flag("--weighted_bins", settings::hist::weighted_bins);
+        app.add_option("--rvol", settings::grid::rvol);
+        app.parse(args);
+
+        // the registered settings resolve to the values of the calling thread, so this only affects the current job
+        if (!histogram_manager.empty()) {settings::detail::parse_option("histogram_manager", {histogram_manager});}
+        switch (settings::hist::histogram_manager) {
+            case settings::hist::HistogramManagerChoice::HistogramManagerMTFFAvg:
+            case settings::hist::HistogramManagerChoice::HistogramManagerMTFFExplicit: settings::molecule::use_effective_charge = false;
+            default: break;
+        }
+
+        io::ExistingFile pdb(s_pdb), mfile(s_mfile);
+        if (!constants::filetypes::structure.validate(pdb)) {throw except::invalid_argument("Unknown PDB extension: " + pdb);}
+        if (!constants::filetypes::saxs_data.validate(mfile)) {throw except::invalid_argument("Unknown SAXS data extension: " + mfile);}
+
+        data::Molecule protein(pdb);
+        if (!use_existing_hydration || protein.water_size() == 0) {
+            protein.generate_new_hydration();
+        }
+
+        std::shared_ptr<fitter::HydrationFitter> fitter;
+        if (fit_excluded_volume) {fitter = std::make_shared<fitter::ExcludedVolumeFitter>(mfile, protein.get_histogram());}
+        else {fitter = std::make_shared<fitter::HydrationFitter>(mfile, protein.get_histogram());}
+        auto result = fitter->fit();
+        if (!s_fit.empty()) {fitter->get_model_dataset().save(s_fit);}
+
+        std::ostringstream response;
+        response << id << " ok chi2=" << result->fval << " dof=" << result->dof;
+        for (const auto& param : result->parameters) {
+            response << " " << param.name << "=" << param.value;
+        }
+        return response.str();
+    } catch (const CLI::ParseError& e) {
+        return id + " error invalid options: " + e.what();
+    } catch (const std::exception& e) {
+        return id + " error " + e.what();
+    }
+}
+
+/**
+ * @brief Read requests from a stream until it is closed, and write each response as soon as it is ready.
+ *
+ * @param read Read the next line. Must return false when the stream is closed.
+ * @param write Write a single response line.
+ */
+template<typename Reader, typename Writer>
+void serve(Reader&& read, Writer&& write) {
+    std::mutex write_mutex;
+    utility::multi_threading::TaskGroup jobs;
+    std::string line;
+    while (read(line)) {
+        if (line.find_first_not_of(" \t\r") == std::string::npos) {continue;}
+        jobs.run([line, &write, &write_mutex] () {
+            auto response = run_job(line);
+            std::lock_guard lock(write_mutex);
+            write(response);
+        });
+    }
+    jobs.wait();
+}
+
+#if defined(__unix__) || defined(__APPLE__)
+    /**
+     * @brief Serve all connections of a Unix domain socket. Each connection is served by its own thread.
+     */
+    int serve_socket(const std::string& path) {
+        int server = ::socket(AF_UNIX, SOCK_STREAM, 0);
+        sockaddr_un address{};
+        address.sun_family = AF_UNIX;
+        if (server == -1 || sizeof(address.sun_path) <= path.size()) {
+            std::cerr << "Could not create socket \"" << path << "\"." << std::endl;
+            return 1;
+        }
+        path.copy(address.sun_path, path.size());
+        ::unlink(path.c_str());
+        if (::bind(server, reinterpret_cast<sockaddr*>(&address), sizeof(address)) == -1 || ::listen(server, 16) == -1) {
+            std::cerr << "Could not listen on socket \"" << path << "\"." << std::endl;
+            return 1;
+        }
+
+        while (true) {
+            int client = ::accept(server, nullptr, nullptr);
+            if (client == -1) {continue;}
+            std::thread([client, context = settings::Context()] () {
+                settings::ScopedContext scope(context);
+                std::string buffer;
+                auto read = [client, &buffer] (std::string& line) {
+                    std::size_t end;
+                    while ((end = buffer.find('\n')) == std::string::npos) {
+                        char chunk[4096];
+                        auto n = ::read(client, chunk, sizeof(chunk));
+                        if (n <= 0) {
+                            // the last request may not be terminated by a newline
+                            line = std::move(buffer);
+                            buffer.clear();
+                            return !line.empty();
+                        }
+                        buffer.append(chunk, n);
+                    }
+                    line = buffer.substr(0, end);
+                    buffer.erase(0, end+1);
+                    return true;
+                };
+                auto write = [client] (const std::string& response) {
+                    std::string out = response + "\n";
+                    for (std::size_t written = 0; written < out.size();) {
+                        auto n = ::write(client, out.data() + written, out.size() - written);
+                        if (n <= 0) {return;}
+                        written += n;
+                    }
+                };
+                serve(read, write);
+                ::close(client);
+            }).detach();
+        }
+    }
+#endif
+
+int main(int argc, char const *argv[]) {
+    std::ios_base::sync_with_stdio(false);
+    std::string s_settings, s_socket;
+    settings::general::verbose = false;
+    settings::general::supplementary_plots = false;
+    settings::hist::histogram_manager = settings::hist::HistogramManagerChoice::HistogramManagerMT;
+
+    CLI::App app{"Start a fitting server which processes requests from stdin or a Unix domain socket until it is closed."};
+    app.add_option("--socket", s_socket, "Path of a Unix domain socket to listen on. If not given, requests are read from stdin.");
+    app.add_option("--threads,-t", settings::general::threads, "Number of threads to use.")->default_val(settings::general::threads);
+    auto p_settings = app.add_option("-s,--settings", s_settings, "Path to a settings file. Its values are the defaults of all requests.")->check(CLI::ExistingFile);
+    app.add_flag_callback("--licence", [] () {std::cout << constants::licence << std::endl; exit(0);}, "Print the licence.");
+    app.add_option_function<std::string>("--trace", utility::trace::start, "Save a trace of the time spent in each stage of the calculation at the given path, in the Chrome trace format.");
+    CLI11_PARSE(app, argc, argv);
+    if (p_settings->count() != 0) {settings::read(io::ExistingFile(s_settings));}
+
+    if (!s_socket.empty()) {
+        #if defined(__unix__) || defined(__APPLE__)
+            return serve_socket(s_socket);
+        #else
+            std::cerr << "Unix domain sockets are not supported on this platform." << std::endl;
+            return 1;
+        #endif
+    }
+
+    serve(
+        [] (std::string& line) {return bool(std::getline(std::cin, line));},
+        [] (const std::string& response) {std::cout << response << std::endl;}
+    );
+    return 0;
+}
\ No newline at end of file
@@ -13,6 +13,7 @@
 #include <crystal/Fval.h>
 #include <mini/dlibMinimizer.h>
 #include <settings/All.h>
+#include <utility/Trace.h>
 
 int main(int argc, char const *argv[]) {
     //###############################################//
@@ -22,6 +23,7 @@ int main(int argc, char const *argv[]) {
     CLI::App app{"Silica project"};
     app.add_option("input", crystal, "File containing the crystal data.")->required();
     app.add_option("--output,-o", settings::general::output, "Path to save the generated figures at.")->default_val("output/silica/");
+    app.add_option_function<std::string>("--trace", utility::trace::start, "Save a trace of the time spent in each stage of the calculation at the given path, in the Chrome trace format.");
     CLI11_PARSE(app, argc, argv);
     settings::general::output += crystal.stem() + "/";
     settings::axes::qmin = 1e-2;
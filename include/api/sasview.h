@@ -6,4 +6,36 @@
     #define API
 #endif
 
-extern "C" API void evaluate_sans_debye(double* _q, double* _x, double* _y, double* _z, double* _w, int _nq, int _nc, int* _return_status, double* _return_Iq);
\ No newline at end of file
+extern "C" API void evaluate_sans_debye(double* _q, double* _x, double* _y, double* _z, double* _w, int _nq, int _nc, int* _return_status, double* _return_Iq);
+
+/**
+ * @brief A persistent scattering model for repeated evaluations, e.g. from inside a fitting loop.
+ *        The distance histogram and the sinc(qd) table are cached between calls, and are only recalculated when the coordinates, the weights or the q values change.
+ *        The model never touches the filesystem. A single model must not be used from multiple threads at the same time, but different models are independent.
+ *        All functions set @a _return_status to 0 on success and to a non-zero value on failure.
+ */
+struct sasview_model;
+
+/**
+ * @brief Create a new model from @a _nc scatterers. The coordinates and weights are copied, so the buffers can be reused by the caller immediately after.
+ *
+ * @return A handle to the model, or nullptr on failure. Must be released with destroy_sans_model.
+ */
+extern "C" API sasview_model* create_sans_model(const double* _x, const double* _y, const double* _z, const double* _w, int _nc, int* _return_status);
+
+/**
+ * @brief Replace the coordinates and weights of all scatterers of the model. The number of scatterers must be the same as when the model was created.
+ *        Pass nullptr for @a _x, @a _y and @a _z to only update the weights, or for @a _w to only update the coordinates.
+ */
+extern "C" API void update_sans_model(sasview_model* _model, const double* _x, const double* _y, const double* _z, const double* _w, int* _return_status);
+
+/**
+ * @brief Evaluate the scattering intensity of the model at the @a _nq values in @a _q, and write the result to @a _return_Iq, which must have room for @a _nq values.
+ *        No form factors are applied.
+ */
+extern "C" API void evaluate_sans_model(sasview_model* _model, const double* _q, int _nq, double* _return_Iq, int* _return_status);
+
+/**
+ * @brief Release a model created with create_sans_model. Passing nullptr is allowed.
+ */
+extern "C" API void destroy_sans_model(sasview_model* _model);
\ No newline at end of file
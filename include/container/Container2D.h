@@ -14,8 +14,8 @@ namespace container {
     class Container2D {
         public:
             Container2D() : N(0), M(0), data(0) {}
-            Container2D(unsigned int width, unsigned int height) : N(width), M(height), data(width*height) {}
-            Container2D(unsigned int width, unsigned int height, const T& value) : N(width), M(height), data(width*height, value) {}
+            Container2D(unsigned int width, unsigned int height) : N(width), M(height), data(std::size_t(width)*height) {}
+            Container2D(unsigned int width, unsigned int height, const T& value) : N(width), M(height), data(std::size_t(width)*height, value) {}
 
             /**
              * @brief Get the value at index i, j. 
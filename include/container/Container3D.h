@@ -14,8 +14,8 @@ namespace container {
     class Container3D {
         public:
             Container3D() : N(0), M(0), L(0), data(0) {}
-            Container3D(unsigned int width, unsigned int height, unsigned int depth) : N(width), M(height), L(depth), data(width * height * depth) {}
-            Container3D(unsigned int width, unsigned int height, unsigned int depth, const T& value) : N(width), M(height), L(depth), data(width * height * depth, value) {}
+            Container3D(unsigned int width, unsigned int height, unsigned int depth) : N(width), M(height), L(depth), data(std::size_t(width)*height*depth) {}
+            Container3D(unsigned int width, unsigned int height, unsigned int depth, const T& value) : N(width), M(height), L(depth), data(std::size_t(width)*height*depth, value) {}
 
             /**
              * @brief Get the value at index i, j, k. 
@@ -56,7 +56,7 @@ namespace container {
              */
             std::vector<T> vector_sum() const {
                 std::vector<T> sum(L, 0);
-                for (unsigned int i = 0; i < data.size(); ++i) {sum[i%L] += data[i];}
+                for (std::size_t i = 0; i < data.size(); ++i) {sum[i%L] += data[i];}
                 return sum;
             }
 
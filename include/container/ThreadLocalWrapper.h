@@ -2,53 +2,85 @@
 
 #include <settings/GeneralSettings.h>
 #include <utility/MultiThreading.h>
+#include <utility/Memory.h>
 
 #include <vector>
 #include <functional>
+#include <optional>
+#include <unordered_map>
+#include <thread>
 
 namespace container {
     /**
      * @brief A simple wrapper around T to keep track of the thread-local instances of T.
      *        This allows access to all the thread-local data from any single thread.
+     *        The memory of all instances is accounted for in the given subsystem.
      *        Note that it is assumed that all threads have a longer lifetime than this class.
      *        
      *        ! Making a static instance of this class will cause Windows DLL to deadlock when the program is closed.
      *        ? This is probably due to the threads owning the data no longer existing when this class is destroyed, combined with the FreeLibrary locking the system resources necessary for C++ to solve this. 
      */
-    template <typename T>
+    template <typename T, utility::memory::Subsystem subsystem = utility::memory::Subsystem::Histogram>
     class ThreadLocalWrapper {
         public:
             /**
-             * @brief Create a wrapper around T, and create a thread-local instance of T for each thread using the given arguments.
+             * @brief Create a wrapper around T, with a thread-local instance of T for each thread using the given arguments.
+             *        Each instance is only constructed the first time it is accessed, such that its memory is first touched by the thread owning it.
+             *        With pinned threads, this places each instance on the NUMA node of its thread.
              * 
-             * ! This constructor *must* be called from the main thread, otherwise it will not receive its own thread-local instance.
+             * ! This constructor *must* be called from the thread which later merges the instances, otherwise it will not receive its own thread-local instance.
+             *   This may be a worker thread itself, such that calculations using this wrapper can be nested inside other tasks.
              */
             template <typename... Args>
-            ThreadLocalWrapper(Args&&... args) {
-                auto ids = utility::multi_threading::get_global_pool()->get_thread_ids();
+            ThreadLocalWrapper(Args&&... args) : factory([args...] () {return T(args...);}) {
+                auto ids = utility::multi_threading::get_global_scheduler()->get_thread_ids();
                 for (auto& id : ids) {
-                    data.emplace(id, T(args...));
+                    data.emplace(id, Entry());
                 }
-                data.emplace(std::this_thread::get_id(), T(args...));
+                data.emplace(std::this_thread::get_id(), Entry());
             }
 
             /**
              * @brief Get the thread-local instance of the wrapped type.
              */
-            T& get() {return data.at(std::this_thread::get_id());}
+            T& get() {return instance(data.at(std::this_thread::get_id()));}
 
             // @copydoc get()
-            const T& get() const {return data.at(std::this_thread::get_id());}
+            const T& get() const {return instance(data.at(std::this_thread::get_id()));}
 
             /**
              * @brief Get the thread-local instances of the wrapped type for all threads.
+             *        Instances which have not been accessed yet are constructed by the calling thread. 
              */
             std::vector<std::reference_wrapper<T>> get_all() {
                 std::vector<std::reference_wrapper<T>> result; result.reserve(data.size());
-                for (auto& [id, t] : data) {result.emplace_back(t);}
+                for (auto& [id, t] : data) {result.emplace_back(instance(t));}
                 return result;
             }
 
+            /**
+             * @brief Get the thread-local instances which have already been constructed.
+             *        Unlike get_all, this never constructs the instances of threads which have not accessed them.
+             *        ! This must not be called while other threads may be constructing their instance.
+             */
+            std::vector<std::reference_wrapper<T>> get_existing() {
+                std::vector<std::reference_wrapper<T>> result; result.reserve(data.size());
+                for (auto& [id, t] : data) {
+                    if (t.value) {result.emplace_back(*t.value);}
+                }
+                return result;
+            }
+
+            /**
+             * @brief Get the number of bytes used by a single thread-local instance. 
+             *        This constructs the instance of the calling thread if it does not exist yet.
+             */
+            std::size_t instance_bytes() const {
+                auto& entry = data.at(std::this_thread::get_id());
+                instance(entry);
+                return entry.account.get();
+            }
+
             /**
              * @brief Get the number of thread-local instances of the wrapped type.
              */
@@ -59,33 +91,57 @@ namespace container {
              */
             template <typename... Args>
             void reinitialize_all(Args&&... args) {
+                factory = [args...] () {return T(args...);};
                 for (auto& e : data) {
-                    e.second = T(args...);
+                    if (e.second.value) {
+                        e.second.value = factory();
+                        e.second.account.set(bytes_of(*e.second.value));
+                    }
                 }
             }
 
             /**
              * @brief Merge all thread-local instances of the wrapped type into a single instance.
+             *        Instances which were never accessed are not included. 
              */
             T merge() const {
                 T result = get();
                 auto this_id = std::this_thread::get_id();
                 if constexpr (std::ranges::range<T>) {
                     for (const auto& [id, t] : data) {
-                        if (id == this_id) {continue;}
-                        std::transform(t.begin(), t.end(), result.begin(), result.begin(), std::plus<>());
+                        if (id == this_id || !t.value) {continue;}
+                        std::transform(t.value->begin(), t.value->end(), result.begin(), result.begin(), std::plus<>());
                     }
                     return result;
                 } else {
                     for (const auto& [id, t] : data) {
-                        if (id == this_id) {continue;}
-                        result += t;
+                        if (id == this_id || !t.value) {continue;}
+                        result += *t.value;
                     }
                     return result;
                 }
             }
 
         private:
-            std::unordered_map<std::thread::id, T> data;
+            struct Entry {
+                std::optional<T> value;
+                utility::memory::Account account{subsystem};
+            };
+
+            std::function<T()> factory;
+            mutable std::unordered_map<std::thread::id, Entry> data; // the map itself is never modified after construction, so each thread can safely construct its own instance
+
+            T& instance(Entry& t) const {
+                if (!t.value) {
+                    t.value.emplace(factory());
+                    t.account.set(bytes_of(*t.value));
+                }
+                return *t.value;
+            }
+
+            static std::size_t bytes_of(const T& t) {
+                if constexpr (std::ranges::sized_range<T>) {return utility::memory::size_of(t);}
+                else {return sizeof(T);}
+            }
     };
 }
\ No newline at end of file
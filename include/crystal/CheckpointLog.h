@@ -0,0 +1,107 @@
+#pragma once
+
+#include <crystal/CrystalFwd.h>
+#include <crystal/miller/CrystalMillerFwd.h>
+
+#include <vector>
+#include <string>
+#include <atomic>
+#include <thread>
+#include <fstream>
+#include <cstdint>
+#include <utility>
+#include <type_traits>
+
+namespace crystal {
+    /**
+     * @brief An append-only checkpoint log for the structure factor calculation.
+     *
+     * The Fval vector is divided into fixed-size blocks, and each finished block is appended to the log as a single record.
+     * Workers hand off finished blocks through a lock-free queue to a dedicated writer thread, so writing a checkpoint never stalls the calculations,
+     * and the cost of each checkpoint is independent of the progress.
+     *
+     * When the log is opened, all complete records of an existing log are replayed through a memory mapping.
+     * A record which was only partially written when the program was terminated is discarded.
+     */
+    class CheckpointLog {
+        public:
+            /**
+             * @brief Open the log and replay any existing records into @a fvals.
+             *
+             * @param file The path of the log file.
+             * @param millers The Miller indices of the calculation. Only used to check that an existing log belongs to the same calculation.
+             * @param fvals The structure factors to be calculated. Must have the same size as @a millers.
+             * @param block_size The number of structure factors in each block.
+             */
+            CheckpointLog(const std::string& file, const std::vector<Miller>& millers, std::vector<Fval>& fvals, unsigned int block_size);
+
+            /**
+             * @brief Write all remaining records and close the log.
+             */
+            ~CheckpointLog();
+
+            /**
+             * @brief Get the indices of all blocks which were not present in the log when it was opened.
+             */
+            [[nodiscard]] std::vector<unsigned int> remaining_blocks() const;
+
+            /**
+             * @brief Get the half-open range [begin, end) of Fval indices covered by a block.
+             */
+            [[nodiscard]] std::pair<unsigned int, unsigned int> block_range(unsigned int block) const;
+
+            /**
+             * @brief Queue a finished block for writing.
+             *        This is lock-free and safe to call from any number of threads, but each block may only be committed once.
+             */
+            void commit(unsigned int block);
+
+            /**
+             * @brief Write all committed blocks and stop the writer thread.
+             */
+            void close();
+
+        private:
+            struct Header {
+                std::uint32_t magic;
+                std::uint32_t block_size;
+                std::uint64_t size;
+            };
+            static constexpr std::uint32_t magic = 0x32434658; // "XFC2"
+
+            // the on-disk representation of a single structure factor. Fval is not trivially copyable, so only its index and value are stored
+            struct Record {
+                std::int32_t h, k, l;
+                std::int32_t padding;
+                double re, im;
+            };
+            static_assert(std::is_trivially_copyable_v<Record> && sizeof(Record) == 32, "CheckpointLog::Record must have a fixed binary layout.");
+
+            std::vector<Fval>& fvals;
+            unsigned int block_size;
+            unsigned int blocks;
+            std::vector<bool> done;
+
+            // the queue has exactly one slot for each block, plus one for the termination marker
+            std::vector<unsigned int> slots;
+            std::vector<std::atomic<bool>> ready;
+            std::atomic<unsigned int> tail = 0;
+
+            std::ofstream out;
+            std::jthread writer;
+
+            /**
+             * @brief Replay all complete records of an existing log.
+             *
+             * @return The number of valid bytes in the log.
+             */
+            std::size_t replay(const std::string& file, const std::vector<Miller>& millers);
+
+            /**
+             * @brief Replay the records of a log already loaded into memory.
+             */
+            std::size_t replay(const char* data, std::size_t size, const std::vector<Miller>& millers);
+
+            void write();
+    };
+}
\ No newline at end of file
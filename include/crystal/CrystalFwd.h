@@ -3,4 +3,5 @@
 namespace crystal {
 	struct MillerGenerationStrategy;
 	class Fval;
+	class CheckpointLog;
 }
\ No newline at end of file
@@ -2,6 +2,7 @@
 
 #include <math/Vector3.h>
 #include <crystal/CrystalFwd.h>
+#include <crystal/miller/CrystalMillerFwd.h>
 #include <hydrate/GridFwd.h>
 #include <dataset/DatasetFwd.h>
 
@@ -16,27 +17,21 @@ namespace crystal {
             CrystalScattering(const std::string& input);
 
             SimpleDataset calculate() const;
-    
+
+            /**
+             * @brief Calculate the scattering profile averaged over @a n orientations of the crystal.
+             *        The orientations are chosen by settings::crystal::orientation_strategy.
+             */
             SimpleDataset rotational_average(unsigned int n);
 
         private:
             std::shared_ptr<MillerGenerationStrategy> miller_strategy;
 
             /**
-             * @brief Save a checkpoint file.
+             * @brief Bin the intensities of a set of Miller indices into the q profile. 
+             *        Each intensity is weighted by the multiplicity of its index. 
              */
-            static void save_checkpoint(unsigned int start, const std::vector<Fval>& fvals);
-
-            /**
-             * @brief Load a checkpoint file.
-             * 
-             * @return The number of points loaded. Returns 0 if no checkpoint file exists.
-             */
-            static unsigned int load_checkpoint(std::vector<Fval>& fvals);
-
-            void random_rotation();
-
-            void rotate(const Vector3<double>& axis, double angle);
+            static SimpleDataset bin(const std::vector<Miller>& millers, const std::vector<double>& I);
 
             void initialize();
 
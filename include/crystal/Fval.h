@@ -14,6 +14,11 @@ namespace crystal {
             Fval();
             Fval(int h, int k, int l);
 
+            /**
+             * @brief Construct an F value from a precalculated structure factor. 
+             */
+            Fval(int h, int k, int l, std::complex<double> fval);
+
             static void set_points(std::vector<Vector3<double>>&& points);
 
             static void set_basis(const Basis3D& basis);
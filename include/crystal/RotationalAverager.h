@@ -0,0 +1,41 @@
+#pragma once
+
+#include <crystal/miller/CrystalMillerFwd.h>
+#include <math/Vector3.h>
+#include <math/Matrix.h>
+
+#include <vector>
+
+namespace settings::crystal {enum class OrientationChoice;}
+namespace crystal {
+    /**
+     * @brief Calculates orientationally averaged intensities of a fixed set of points. 
+     * 
+     *        Instead of rotating a copy of the points for each orientation, the inverse rotation is applied to the scattering vectors.
+     *        The points are therefore shared read-only between all threads, and no memory is allocated per orientation.
+     *        The orientations are split into one batch per thread, each accumulating the intensities in its own buffer. 
+     */
+    class RotationalAverager {
+        public:
+            RotationalAverager(const std::vector<Vector3<double>>& points);
+
+            /**
+             * @brief Generate a set of orientations. 
+             * 
+             * @param n The number of orientations.
+             * @param choice The distribution of the orientations.
+             */
+            static std::vector<Matrix<double>> generate_orientations(unsigned int n, settings::crystal::OrientationChoice choice);
+
+            /**
+             * @brief Calculate the intensity of each Miller index averaged over all orientations. 
+             * 
+             * @param millers The Miller indices.
+             * @param orientations The rotations to apply to the points. 
+             */
+            std::vector<double> average(const std::vector<Miller>& millers, const std::vector<Matrix<double>>& orientations) const;
+
+        private:
+            const std::vector<Vector3<double>>& points;
+    };
+}
\ No newline at end of file
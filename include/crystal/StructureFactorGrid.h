@@ -0,0 +1,45 @@
+#pragma once
+
+#include <math/Vector3.h>
+
+#include <vector>
+#include <complex>
+#include <array>
+
+namespace crystal {
+    /**
+     * @brief Calculate the structure factors of all Miller indices within a range with a single three-dimensional FFT.
+     *
+     * The points of the unit cell are spread onto an oversampled periodic grid with a Gaussian kernel. 
+     * The grid is Fourier transformed, and the result is deconvolved with the known transform of the kernel (Greengard & Lee, 2004). 
+     * This reduces the cost from O(N_atoms N_miller) for the direct summation to O(N_atoms + N_miller log N_miller), at a relative accuracy of about 1e-5. 
+     * Note that the oversampled grid contains at least twice as many points as there are Miller indices in the range. 
+     */
+    class StructureFactorGrid {
+        public:
+            /**
+             * @brief Calculate the structure factors.
+             *
+             * @param points The points of the unit cell.
+             * @param cell The side lengths of the orthorhombic unit cell.
+             * @param h, k, l The maximum absolute Miller index along each axis.
+             */
+            StructureFactorGrid(const std::vector<Vector3<double>>& points, const Vector3<double>& cell, unsigned int h, unsigned int k, unsigned int l);
+
+            /**
+             * @brief Get the structure factor of the Miller index (h, k, l).
+             */
+            [[nodiscard]] std::complex<double> F(int h, int k, int l) const;
+
+            /**
+             * @brief Get the number of bytes of the grid for the maximum absolute Miller indices (h, k, l).
+             */
+            [[nodiscard]] static std::size_t bytes(unsigned int h, unsigned int k, unsigned int l);
+
+        private:
+            std::vector<std::complex<double>> grid;       // The Fourier transform of the spread points.
+            std::array<unsigned int, 3> size;             // The size of the oversampled grid along each axis.
+            std::array<int, 3> max;                       // The maximum absolute Miller index along each axis.
+            std::array<std::vector<double>, 3> deconvolve; // The kernel deconvolution factors for each Miller index along each axis.
+    };
+}
\ No newline at end of file
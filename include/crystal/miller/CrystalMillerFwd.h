@@ -2,4 +2,5 @@
 
 namespace crystal {
 	struct Miller;
+	class MillerSymmetry;
 }
\ No newline at end of file
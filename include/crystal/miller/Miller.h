@@ -22,5 +22,6 @@ namespace crystal {
         Miller operator*(int n) const;
 
         int h, k, l;
+        unsigned int multiplicity = 1; // The number of symmetry-equivalent indices represented by this index.
     };
 }
\ No newline at end of file
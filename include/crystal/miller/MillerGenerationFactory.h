@@ -9,6 +9,7 @@ namespace crystal {
     namespace factory {
         /**
          * @brief Prepare a miller generation strategy.
+         *        If settings::crystal::use_symmetry is enabled, the generated indices are reduced to their asymmetric unit.
          */
         std::unique_ptr<crystal::MillerGenerationStrategy> construct_miller_strategy();
 
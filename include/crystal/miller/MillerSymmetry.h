@@ -0,0 +1,70 @@
+#pragma once
+
+#include <crystal/miller/CrystalMillerFwd.h>
+#include <math/Vector3.h>
+
+#include <vector>
+#include <array>
+
+namespace crystal {
+    /**
+     * @brief The Laue symmetry of a rectangular unit cell, used to reduce a set of Miller indices to its asymmetric unit.
+     *
+     * The symmetry operations are the signed permutations of (h, k, l), i.e. the 48 operations of the m-3m point group.
+     * Friedel's law |F(h, k, l)| = |F(-h, -k, -l)| always holds, so the inversion is always included.
+     * The remaining operations are only included if the contents of the unit cell are invariant under the corresponding operation in real space,
+     * which requires the permuted axes to have the same length.
+     */
+    class MillerSymmetry {
+        public:
+            /**
+             * @brief Construct a symmetry containing only the identity and the inversion.
+             */
+            MillerSymmetry();
+
+            /**
+             * @brief Detect the symmetry of the points currently set in Fval.
+             */
+            static MillerSymmetry detect();
+
+            /**
+             * @brief Detect the symmetry of a set of points in a rectangular unit cell.
+             *
+             * @param points The points in the unit cell. Points outside the cell are wrapped back into it.
+             * @param cell The side lengths of the unit cell.
+             * @param tolerance The maximum distance between a transformed point and its symmetry partner, relative to the shortest side of the cell.
+             */
+            static MillerSymmetry detect(const std::vector<Vector3<double>>& points, const Vector3<double>& cell, double tolerance = 1e-4);
+
+            /**
+             * @brief Reduce a set of Miller indices to one index per group of symmetry-equivalent indices.
+             *        The first index of each group is kept, and its multiplicity is set to the total multiplicity of the group.
+             *        Only the indices present in @a millers are counted, so any subset of indices is reduced without changing its weighting.
+             */
+            std::vector<Miller> reduce(const std::vector<Miller>& millers) const;
+
+            /**
+             * @brief Get the canonical representative of the symmetry-equivalent indices of @a m.
+             */
+            Miller canonical(const Miller& m) const;
+
+            /**
+             * @brief Get the number of symmetry operations.
+             */
+            unsigned int order() const noexcept;
+
+        private:
+            struct Operation {
+                std::array<unsigned int, 3> axes;   // The input axis of each output axis.
+                std::array<int, 3> signs;           // The sign of each output axis.
+
+                Miller apply(const Miller& m) const;
+            };
+            std::vector<Operation> operations;
+
+            /**
+             * @brief Generate all 48 signed permutations of the three axes.
+             */
+            static std::vector<Operation> all_operations();
+    };
+}
\ No newline at end of file
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <crystal/miller/MillerGenerationStrategy.h>
+
+#include <memory>
+
+namespace crystal {
+    /**
+     * @brief Reduces the indices generated by another strategy to their asymmetric unit.
+     * 
+     *        The Laue symmetry of the points currently set in Fval is detected every time new indices are generated.
+     *        Only one index of each group of symmetry-equivalent indices is kept, with its multiplicity set to the size of the group.
+     *        Since equivalent indices have the same intensity, this reduces the number of structure factors to be calculated by up to a factor 48
+     *        without changing the resulting scattering profile. See MillerSymmetry for more information. 
+     */
+    class SymmetryReducedMillers : public MillerGenerationStrategy {
+        public:
+            SymmetryReducedMillers(std::unique_ptr<MillerGenerationStrategy> strategy);
+            ~SymmetryReducedMillers() override = default;
+
+            std::vector<Miller> generate() const override;
+
+        private:
+            std::unique_ptr<MillerGenerationStrategy> strategy;
+    };
+}
\ No newline at end of file
@@ -4,6 +4,7 @@
 #include <data/detail/AtomCollection.h>
 #include <data/DataFwd.h>
 #include <io/IOFwd.h>
+#include <utility/Memory.h>
 #include <math/MathFwd.h>
 
 #include <vector>
@@ -226,6 +227,11 @@ namespace data {
 			// The signalling object to signal a change of state. The default doesn't do anything, and must be overriden by a proper Signaller object.  
 			std::shared_ptr<signaller::Signaller> signal;
 
+			// The memory used by the atoms and waters of this body. Refreshed whenever its internal state changes. 
+			mutable utility::memory::Account account{utility::memory::Subsystem::Molecule};
+
 			void initialize();
+
+			void update_account() const;
 	};
 }
\ No newline at end of file
@@ -5,6 +5,7 @@
 #include <math/MathFwd.h>
 #include <io/ExistingFile.h>
 #include <utility/observer_ptr.h>
+#include <utility/Memory.h>
 #include <dataset/DatasetFwd.h>
 #include <fitter/FitterFwd.h>
 #include <hydrate/GridFwd.h>
@@ -334,6 +335,7 @@ namespace data {
 			mutable std::unique_ptr<grid::Grid> grid; // The grid representation of this body
 			std::unique_ptr<hist::IHistogramManager> phm;
 			std::unique_ptr<hist::ICompositeDistanceHistogram> histogram; // An object representing the distances between atoms
+			mutable utility::memory::Account hydration_account{utility::memory::Subsystem::Molecule}; // The memory used by the hydration atoms
 
 			void initialize();
 	};
@@ -4,6 +4,7 @@
 #include <em/ObjectBounds2D.h>
 #include <data/DataFwd.h>
 #include <utility/observer_ptr.h>
+#include <utility/Memory.h>
 
 #include <list>
 
@@ -108,5 +109,6 @@ namespace em {
             Matrix<float> data;                                 // The actual data storage. 
             unsigned int z = 0;                                 // The z-index of this image in the ImageStack. 
             ObjectBounds2D bounds;
+            utility::memory::Account account{utility::memory::Subsystem::EM, static_cast<std::size_t>(N)*M*sizeof(float)};
     };
 }
\ No newline at end of file
@@ -4,6 +4,7 @@
 #include <data/DataFwd.h>
 #include <hist/HistFwd.h>
 #include <utility/observer_ptr.h>
+#include <settings/HistogramSettings.h>
 
 #include <vector>
 
@@ -58,6 +59,7 @@ namespace em::managers {
 
         private:
             double previous_cutoff = 0;
+            settings::hist::HistogramManagerChoice previous_histogram_manager = settings::hist::histogram_manager; // The histogram manager to restore when the initialization is enabled again.
 
             /**
              * @brief Generate a new Protein for a given cutoff. 
@@ -5,6 +5,7 @@
 #include <utility/UtilityFwd.h>
 #include <fitter/Fitter.h>
 #include <utility/observer_ptr.h>
+#include <math/CubicSplineResampler.h>
 
 namespace fitter {
 
@@ -173,9 +174,43 @@ namespace fitter {
 			 */
 			[[nodiscard]] std::vector<double> splice(const std::vector<double>& ym) const;
 
+			/**
+			 * @brief Splice values from the model into the preallocated buffer @a Im. 
+			 *        No allocations are performed if @a Im already has the correct size. 
+			 * 
+			 * @param ym the model y-values corresponding to the q-axis of the histogram
+			 */
+			void splice(const std::vector<double>& ym, std::vector<double>& Im) const;
+
+			/**
+			 * @brief Splice the model values @a ym onto the data and fit a*Im + b to it, returning the resulting chi2. 
+			 *        This is the hot path of the minimizers, so everything is done in preallocated buffers. 
+			 * 
+			 * @param ym the model y-values corresponding to the q-axis of the histogram
+			 */
+			[[nodiscard]] double chi2_spliced(const std::vector<double>& ym);
+
+			/**
+			 * @brief Discard the precalculated splicing operator and fit buffers. Must be called whenever the data changes. 
+			 */
+			void reset_buffers();
+
 			/**
 			 * @brief Initialize this class based on a model histogram. 
 			 */
 			void model_setup(std::unique_ptr<hist::DistanceHistogram> model, const Limit& limits);
+
+		private: 
+			mutable std::unique_ptr<math::CubicSplineResampler> resampler; // Splicing operator from the model q-axis onto the data, built on first use
+			mutable std::vector<double> resampler_axis;                     // The model q-axis the splicing operator was built for
+			std::vector<double> Im_buffer;                                  // Spliced model values of the last chi2 evaluation
+			std::vector<double> y_buffer;                                   // Data values, normalized to I0 if set
+			std::vector<double> w_buffer;                                   // Data weights 1/yerr^2
+
+			/**
+			 * @brief Get the splicing operator, building it if necessary. 
+			 *        The operator is rebuilt whenever the q-axis of the model histogram changes, since it depends on the q-range of the calling thread.
+			 */
+			const math::CubicSplineResampler& get_resampler() const;
 	};
 }
\ No newline at end of file
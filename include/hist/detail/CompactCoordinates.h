@@ -1,10 +1,13 @@
 #pragma once
 
 #include <hist/detail/CompactCoordinatesData.h>
+#include <hist/detail/DistanceAxis.h>
 #include <utility/Concepts.h>
 #include <data/DataFwd.h>
 
 #include <vector>
+#include <functional>
+#include <initializer_list>
 
 namespace hist::detail {
     /**
@@ -25,8 +28,10 @@ namespace hist::detail {
 
             /**
              * @brief Create a CompactCoordinates object with a given size.
+             *
+             * @throws except::size_error if there are too many atoms for the distance calculations. This also applies to all other constructors.
              */
-            CompactCoordinates(unsigned int size);
+            CompactCoordinates(std::size_t size);
 
             /**
              * @brief Extract the necessary coordinates and weights from a body. 
@@ -47,10 +52,31 @@ namespace hist::detail {
 
             const std::vector<CompactCoordinatesData>& get_data() const;
 
+            /**
+             * @brief Check if all elements have the same weight. This is trivially true if there are no elements.
+             */
+            bool has_uniform_weight() const;
+
             CompactCoordinatesData& operator[](unsigned int i);
             const CompactCoordinatesData& operator[](unsigned int i) const;
 
+            /**
+             * @brief Get the inverse width of the distance bins these coordinates are evaluated for.
+             *        This is fixed to the value of settings::axes::distance_bin_width at the time of construction.
+             */
+            float get_inv_bin_width() const {return inv_width;}
+
         protected: 
             std::vector<CompactCoordinatesData> data;
+            float inv_width = detail::get_inv_bin_width();
     };
+
+    /**
+     * @brief Get an upper bound on the number of distance bins needed for all distances within and between the given sets of coordinates.
+     *        This is calculated from the diagonal of their common bounding box, such that the histograms can be sized to the molecule instead of the full distance axis. 
+     *        The bound is never smaller than the 10 bins always kept by the histogram managers.
+     *
+     * @throws except::size_error if the bound is larger than the number of bins of get_distance_axis().
+     */
+    [[nodiscard]] unsigned int get_required_bins(std::initializer_list<std::reference_wrapper<const CompactCoordinates>> data);
 }
\ No newline at end of file
@@ -156,8 +156,10 @@ namespace hist::detail {
 
             /**
              * @brief Calculate the @a binned distance and combined weight between this and a single other CompactCoordinatesData.
+             *
+             * @param inv_width The inverse width of the distance bins.
              */
-            EvaluatedResultRounded evaluate_rounded(const CompactCoordinatesData& other) const;
+            EvaluatedResultRounded evaluate_rounded(const CompactCoordinatesData& other, float inv_width) const;
 
             /**
              * @brief Calculate the distance and combined weight between this and a single other CompactCoordinatesData.
@@ -167,8 +169,10 @@ namespace hist::detail {
             /**
              * @brief Calculate the @a binned distance and combined weight between this and four other CompactCoordinatesData.
              *        This leverages more efficient SIMD instructions by using a 128-bit registers (SSE).
+             *
+             * @param inv_width The inverse width of the distance bins.
              */
-            QuadEvaluatedResultRounded evaluate_rounded(const CompactCoordinatesData& v1, const CompactCoordinatesData& v2, const CompactCoordinatesData& v3, const CompactCoordinatesData& v4) const;
+            QuadEvaluatedResultRounded evaluate_rounded(const CompactCoordinatesData& v1, const CompactCoordinatesData& v2, const CompactCoordinatesData& v3, const CompactCoordinatesData& v4, float inv_width) const;
 
             /**
              * @brief Calculate the distance and combined weight between this and four other CompactCoordinatesData.
@@ -179,10 +183,12 @@ namespace hist::detail {
             /**
              * @brief Calculate the @a binned distance and combined weight between this and four other CompactCoordinatesData.
              *        This leverages more efficient SIMD instructions by using either two 128-bit registers (SSE) or one 256-bit register (AVX).
+             *
+             * @param inv_width The inverse width of the distance bins.
              */
             OctoEvaluatedResultRounded evaluate_rounded(
                 const CompactCoordinatesData& v1, const CompactCoordinatesData& v2, const CompactCoordinatesData& v3, const CompactCoordinatesData& v4,
-                const CompactCoordinatesData& v5, const CompactCoordinatesData& v6, const CompactCoordinatesData& v7, const CompactCoordinatesData& v8
+                const CompactCoordinatesData& v5, const CompactCoordinatesData& v6, const CompactCoordinatesData& v7, const CompactCoordinatesData& v8, float inv_width
             ) const;
 
             /**
@@ -200,15 +206,15 @@ namespace hist::detail {
             };
 
         protected:
-            EvaluatedResultRounded evaluate_rounded_scalar(const CompactCoordinatesData& other) const;
+            EvaluatedResultRounded evaluate_rounded_scalar(const CompactCoordinatesData& other, float inv_width) const;
             EvaluatedResult evaluate_scalar(const CompactCoordinatesData& other) const;
 
-            QuadEvaluatedResultRounded evaluate_rounded_scalar(const CompactCoordinatesData& v1, const CompactCoordinatesData& v2, const CompactCoordinatesData& v3, const CompactCoordinatesData& v4) const;
+            QuadEvaluatedResultRounded evaluate_rounded_scalar(const CompactCoordinatesData& v1, const CompactCoordinatesData& v2, const CompactCoordinatesData& v3, const CompactCoordinatesData& v4, float inv_width) const;
             QuadEvaluatedResult evaluate_scalar(const CompactCoordinatesData& v1, const CompactCoordinatesData& v2, const CompactCoordinatesData& v3, const CompactCoordinatesData& v4) const;
 
             OctoEvaluatedResultRounded evaluate_rounded_scalar(
                 const CompactCoordinatesData& v1, const CompactCoordinatesData& v2, const CompactCoordinatesData& v3, const CompactCoordinatesData& v4,
-                const CompactCoordinatesData& v5, const CompactCoordinatesData& v6, const CompactCoordinatesData& v7, const CompactCoordinatesData& v8
+                const CompactCoordinatesData& v5, const CompactCoordinatesData& v6, const CompactCoordinatesData& v7, const CompactCoordinatesData& v8, float inv_width
             ) const;
             OctoEvaluatedResult evaluate_scalar(
                 const CompactCoordinatesData& v1, const CompactCoordinatesData& v2, const CompactCoordinatesData& v3, const CompactCoordinatesData& v4,
@@ -216,15 +222,15 @@ namespace hist::detail {
             ) const;
 
             #if defined __SSE2__
-                EvaluatedResultRounded evaluate_rounded_sse(const CompactCoordinatesData& other) const;
+                EvaluatedResultRounded evaluate_rounded_sse(const CompactCoordinatesData& other, float inv_width) const;
                 EvaluatedResult evaluate_sse(const CompactCoordinatesData& other) const;
 
-                QuadEvaluatedResultRounded evaluate_rounded_sse(const CompactCoordinatesData& v1, const CompactCoordinatesData& v2, const CompactCoordinatesData& v3, const CompactCoordinatesData& v4) const;
+                QuadEvaluatedResultRounded evaluate_rounded_sse(const CompactCoordinatesData& v1, const CompactCoordinatesData& v2, const CompactCoordinatesData& v3, const CompactCoordinatesData& v4, float inv_width) const;
                 QuadEvaluatedResult evaluate_sse(const CompactCoordinatesData& v1, const CompactCoordinatesData& v2, const CompactCoordinatesData& v3, const CompactCoordinatesData& v4) const;
 
                 OctoEvaluatedResultRounded evaluate_rounded_sse(
                     const CompactCoordinatesData& v1, const CompactCoordinatesData& v2, const CompactCoordinatesData& v3, const CompactCoordinatesData& v4,
-                    const CompactCoordinatesData& v5, const CompactCoordinatesData& v6, const CompactCoordinatesData& v7, const CompactCoordinatesData& v8
+                    const CompactCoordinatesData& v5, const CompactCoordinatesData& v6, const CompactCoordinatesData& v7, const CompactCoordinatesData& v8, float inv_width
                 ) const;
                 OctoEvaluatedResult evaluate_sse(
                     const CompactCoordinatesData& v1, const CompactCoordinatesData& v2, const CompactCoordinatesData& v3, const CompactCoordinatesData& v4,
@@ -233,15 +239,15 @@ namespace hist::detail {
             #endif
 
             #if defined __AVX__
-                EvaluatedResultRounded evaluate_rounded_avx(const CompactCoordinatesData& other) const;
+                EvaluatedResultRounded evaluate_rounded_avx(const CompactCoordinatesData& other, float inv_width) const;
                 EvaluatedResult evaluate_avx(const CompactCoordinatesData& other) const;
 
-                QuadEvaluatedResultRounded evaluate_rounded_avx(const CompactCoordinatesData& v1, const CompactCoordinatesData& v2, const CompactCoordinatesData& v3, const CompactCoordinatesData& v4) const;
+                QuadEvaluatedResultRounded evaluate_rounded_avx(const CompactCoordinatesData& v1, const CompactCoordinatesData& v2, const CompactCoordinatesData& v3, const CompactCoordinatesData& v4, float inv_width) const;
                 QuadEvaluatedResult evaluate_avx(const CompactCoordinatesData& v1, const CompactCoordinatesData& v2, const CompactCoordinatesData& v3, const CompactCoordinatesData& v4) const;
 
                 OctoEvaluatedResultRounded evaluate_rounded_avx(
                     const CompactCoordinatesData& v1, const CompactCoordinatesData& v2, const CompactCoordinatesData& v3, const CompactCoordinatesData& v4,
-                    const CompactCoordinatesData& v5, const CompactCoordinatesData& v6, const CompactCoordinatesData& v7, const CompactCoordinatesData& v8
+                    const CompactCoordinatesData& v5, const CompactCoordinatesData& v6, const CompactCoordinatesData& v7, const CompactCoordinatesData& v8, float inv_width
                 ) const;
                 OctoEvaluatedResult evaluate_avx(
                     const CompactCoordinatesData& v1, const CompactCoordinatesData& v2, const CompactCoordinatesData& v3, const CompactCoordinatesData& v4,
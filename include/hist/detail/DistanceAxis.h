@@ -0,0 +1,33 @@
+#pragma once
+
+#include <utility/Axis.h>
+
+namespace hist::detail {
+    /**
+     * @brief Get the axis of the distance histograms, as defined by settings::axes::distance_bin_width and settings::axes::max_distance.
+     *        Since the settings are local to each thread, this must be called from the thread setting up the calculation.
+     */
+    [[nodiscard]] Axis get_distance_axis();
+
+    /**
+     * @brief Get the width of the distance bins of the calling thread.
+     */
+    [[nodiscard]] double get_bin_width();
+
+    /**
+     * @brief Get the inverse width of the distance bins of the calling thread.
+     */
+    [[nodiscard]] float get_inv_bin_width();
+
+    /**
+     * @brief Get the number of bins of @a axis needed for all distances up to @a distance.
+     *
+     * @throws except::size_error if the distances do not fit on @a axis.
+     */
+    [[nodiscard]] unsigned int get_required_bins(double distance, const Axis& axis);
+
+    /**
+     * @brief Check if a histogram with the given bin width can use the precalculated default sinc table.
+     */
+    [[nodiscard]] bool is_default_bin_width(double width) noexcept;
+}
\ No newline at end of file
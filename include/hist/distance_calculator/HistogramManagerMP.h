@@ -0,0 +1,30 @@
+#pragma once
+
+#include <hist/distance_calculator/HistogramManagerMT.h>
+
+namespace hist {
+	/**
+	 * @brief A multi-process simple distance calculator.
+	 *        The pair triangle is split into settings::general::processes disjoint tiles of roughly equal size, each of which is calculated by a worker process forked from the caller.
+	 *        The workers share the coordinates of the caller, and write their partial histograms to a shared memory segment which is then reduced in a fixed order.
+	 *        This avoids contention on the global thread pool and the allocator, and allows each worker to run under its own per-process memory limit.
+	 *        On platforms without fork, this falls back to the multi-threaded implementation.
+	 */
+	template<bool use_weighted_distribution>
+	class HistogramManagerMP : public HistogramManagerMT<use_weighted_distribution> {
+		public:
+			using HistogramManagerMT<use_weighted_distribution>::HistogramManagerMT;
+
+			virtual ~HistogramManagerMP() override;
+
+			/**
+			 * @brief Calculate only the total scattering histogram.
+			 */
+			std::unique_ptr<DistanceHistogram> calculate() override;
+
+			/**
+			 * @brief Calculate all contributions to the scattering histogram.
+			 */
+			std::unique_ptr<ICompositeDistanceHistogram> calculate_all() override;
+	};
+}
\ No newline at end of file
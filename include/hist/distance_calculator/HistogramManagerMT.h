@@ -28,5 +28,16 @@ namespace hist {
 		protected:
 			std::unique_ptr<hist::detail::CompactCoordinates> data_a_ptr;
 		    std::unique_ptr<hist::detail::CompactCoordinates> data_w_ptr;
+
+		private:
+			/**
+			 * @brief Calculate all contributions when all atoms share a single weight, and all waters share another. 
+			 *        The pairs are then counted in integer histograms, which are only scaled by the weights at the end. 
+			 *        This is only used for unweighted bins, since the weighted bins must still track the distances of all pairs.
+			 *
+			 * @tparam count_t The integer type of the counts. This must be wide enough to hold the count of any single bin.
+			 */
+			template<typename count_t>
+			std::unique_ptr<ICompositeDistanceHistogram> calculate_uniform();
 	};
 }
\ No newline at end of file
@@ -51,6 +51,14 @@ namespace hist {
 			container::Container1D<detail::HydrationHistogram<use_weighted_distribution>> partials_aw;	// the partial hydration-atom histograms
 			detail::HydrationHistogram<use_weighted_distribution> partials_ww;               			// the partial histogram for the hydration layer
 
+			/**
+			 * @brief Get the number of bins needed for all distances of the molecule. 
+			 * 		  The partial histograms always span the full distance axis, so this must be checked before any distances are calculated.
+			 * 
+			 * @throws except::size_error if the molecule does not fit on the distance axis.
+			 */
+			unsigned int get_required_bins() const;
+
 		private:
 			/**
 			 * @brief Initialize this object. The internal distances between atoms in each body is constant and cannot change. 
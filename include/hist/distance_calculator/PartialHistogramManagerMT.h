@@ -7,6 +7,7 @@
 #include <container/ThreadLocalWrapper.h>
 #include <container/Container1D.h>
 #include <container/Container2D.h>
+#include <utility/TaskScheduler.h>
 
 #include <memory>
 #include <mutex>
@@ -14,6 +15,9 @@
 namespace hist {
 	/**
 	 * @brief A multi-threaded smart distance calculator.
+	 * 
+	 *        With unweighted bins, the pairs between two sets which each share a single weight are counted in integer histograms, 
+	 *        and only scaled by the weights when they are added to the partial histograms. This covers EM maps with settings::em::fixed_weights.
 	 */
     template<bool use_weighted_distribution> 
 	class PartialHistogramManagerMT : public PartialHistogramManager<use_weighted_distribution> {
@@ -38,6 +42,8 @@ namespace hist {
 			container::ThreadLocalWrapper<container::Container1D<GenericDistribution1D_t>> partials_aw_all;
 			container::ThreadLocalWrapper<						 GenericDistribution1D_t>  partials_ww_all;
 			std::mutex master_hist_mutex;
+			int job_size = 0; // The number of rows of each job, limited by the memory budget.
+			utility::multi_threading::TaskGroup tasks; // All calculations of this manager. Declared last so it is finished before the partials are destroyed.
 
 			/**
 			 * @brief Initialize this object. The internal distances between atoms in each body is constant and cannot change. 
@@ -45,6 +51,17 @@ namespace hist {
 			 */
 			void initialize();
 
+			/**
+			 * @brief Determine the job size such that the thread-local copies of the partial histograms fit in the memory budget.
+			 */
+			void update_job_size();
+
+			/**
+			 * @brief Reset the partial histograms which will be recalculated in the existing thread-local copies. 
+			 * 		  The copies are only created by the threads taking part in the calculations, so this must be done before any calculations are submitted.
+			 */
+			void reset_partials();
+
 			/**
 			 * @brief Calculate the atom-atom distances between body @a index and all others. 
 			 * 		  This only adds jobs to the thread pool, and does not wait for them to complete.
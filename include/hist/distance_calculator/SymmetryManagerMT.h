@@ -0,0 +1,43 @@
+#pragma once
+
+#include <hist/distance_calculator/HistogramManager.h>
+#include <hist/symmetry/Symmetry.h>
+
+#include <memory>
+
+namespace hist {
+	/**
+	 * @brief A multi-threaded distance calculator for symmetric assemblies such as homo-oligomers, capsids, or filaments.
+	 *        The molecule is only the asymmetric unit, and the assembly is generated by applying a symmetry to it. 
+	 *        The histogram of the asymmetric unit with itself is calculated once, and each distinct cross histogram with one of its copies is calculated once and weighted by its multiplicity.
+	 *        For an assembly of n copies this is roughly n times faster than calculating the histogram of the full assembly. 
+	 *        Since the copies are regenerated from the asymmetric unit for each calculation, rigid-body moves of the unit are applied to all copies at once.
+	 * 
+	 *        The symmetry elements are defined in the coordinate frame of the asymmetric unit, so the unit must not be recentred. 
+	 *        Construct it with settings::molecule::center disabled, since centering would move the unit relative to the symmetry axes and change the assembly.
+	 */
+	template<bool use_weighted_distribution>
+	class SymmetryManagerMT : public HistogramManager<use_weighted_distribution> {
+		public:
+			/**
+			 * @param protein The asymmetric unit.
+			 * @param symmetry The symmetry generating the assembly from the asymmetric unit.
+			 */
+			SymmetryManagerMT(observer_ptr<const data::Molecule> protein, std::shared_ptr<const symmetry::Symmetry> symmetry);
+
+			virtual ~SymmetryManagerMT() override;
+
+			/**
+			 * @brief Calculate only the total scattering histogram of the assembly. 
+			 */
+			std::unique_ptr<DistanceHistogram> calculate() override;
+
+			/**
+			 * @brief Calculate all contributions to the scattering histogram of the assembly. 
+			 */
+			std::unique_ptr<ICompositeDistanceHistogram> calculate_all() override;
+
+		private:
+			std::shared_ptr<const symmetry::Symmetry> symmetry;
+	};
+}
\ No newline at end of file
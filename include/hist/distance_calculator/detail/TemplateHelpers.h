@@ -2,6 +2,7 @@
 
 #include <hist/distribution/GenericDistribution1D.h>
 #include <hist/detail/CompactCoordinates.h>
+#include <container/Container1D.h>
 
 namespace detail::add8 {
     template<int use_weighted_distribution>
@@ -9,7 +10,7 @@ namespace detail::add8 {
 
     template<>
     inline auto evaluate<false>(const hist::detail::CompactCoordinates& data_i, const hist::detail::CompactCoordinates& data_j, int i, int j) {
-        return data_i[i].evaluate_rounded(data_j[j], data_j[j+1], data_j[j+2], data_j[j+3], data_j[j+4], data_j[j+5], data_j[j+6], data_j[j+7]);
+        return data_i[i].evaluate_rounded(data_j[j], data_j[j+1], data_j[j+2], data_j[j+3], data_j[j+4], data_j[j+5], data_j[j+6], data_j[j+7], data_i.get_inv_bin_width());
     }
 
     template<>
@@ -24,7 +25,7 @@ namespace detail::add4 {
 
     template<>
     inline auto evaluate<false>(const hist::detail::CompactCoordinates& data_i, const hist::detail::CompactCoordinates& data_j, int i, int j) {
-        return data_i[i].evaluate_rounded(data_j[j], data_j[j+1], data_j[j+2], data_j[j+3]);
+        return data_i[i].evaluate_rounded(data_j[j], data_j[j+1], data_j[j+2], data_j[j+3], data_i.get_inv_bin_width());
     }
 
     template<>
@@ -39,7 +40,7 @@ namespace detail::add1 {
 
     template<>
     inline auto evaluate<false>(const hist::detail::CompactCoordinates& data_i, const hist::detail::CompactCoordinates& data_j, int i, int j) {
-        return data_i[i].evaluate_rounded(data_j[j]);
+        return data_i[i].evaluate_rounded(data_j[j], data_i.get_inv_bin_width());
     }
 
     template<>
@@ -113,4 +114,59 @@ inline void evaluate1(typename hist::GenericDistribution1D<use_weighted_distribu
     } else {
         p.add2(res.distance, res.weight);
     }
+}
+
+/**
+ * @brief Calculate the distances between eight atoms and count them in an integer histogram. The weights are ignored.
+ *        This is only valid if all atoms have the same weight, in which case the counts are scaled by the squared weight afterwards.
+ * 
+ * @tparam factor The number to add to the count of each distance. 
+ * @param p The histogram to count the distances in.
+ * @param data_i The first atom.
+ * @param data_j The second atom.
+ * @param i The index of the first atom.
+ * @param j The index of the second atom.
+ */
+template<int factor, typename count_t>
+inline void count8(container::Container1D<count_t>& p, const hist::detail::CompactCoordinates& data_i, const hist::detail::CompactCoordinates& data_j, int i, int j) {
+    auto res = detail::add8::evaluate<false>(data_i, data_j, i, j);
+    for (unsigned int k = 0; k < 8; ++k) {
+        p.index(res.distances[k]) += factor;
+    }
+}
+
+/**
+ * @brief Calculate the distances between four atoms and count them in an integer histogram. The weights are ignored.
+ *        This is only valid if all atoms have the same weight, in which case the counts are scaled by the squared weight afterwards.
+ * 
+ * @tparam factor The number to add to the count of each distance. 
+ * @param p The histogram to count the distances in.
+ * @param data_i The first atom.
+ * @param data_j The second atom.
+ * @param i The index of the first atom.
+ * @param j The index of the second atom.
+ */
+template<int factor, typename count_t>
+inline void count4(container::Container1D<count_t>& p, const hist::detail::CompactCoordinates& data_i, const hist::detail::CompactCoordinates& data_j, int i, int j) {
+    auto res = detail::add4::evaluate<false>(data_i, data_j, i, j);
+    for (unsigned int k = 0; k < 4; ++k) {
+        p.index(res.distances[k]) += factor;
+    }
+}
+
+/**
+ * @brief Calculate the distance between two atoms and count it in an integer histogram. The weights are ignored.
+ *        This is only valid if all atoms have the same weight, in which case the counts are scaled by the squared weight afterwards.
+ * 
+ * @tparam factor The number to add to the count of the distance. 
+ * @param p The histogram to count the distance in.
+ * @param data_i The first atom.
+ * @param data_j The second atom.
+ * @param i The index of the first atom.
+ * @param j The index of the second atom.
+ */
+template<int factor, typename count_t>
+inline void count1(container::Container1D<count_t>& p, const hist::detail::CompactCoordinates& data_i, const hist::detail::CompactCoordinates& data_j, int i, int j) {
+    auto res = detail::add1::evaluate<false>(data_i, data_j, i, j);
+    p.index(res.distance) += factor;
 }
\ No newline at end of file
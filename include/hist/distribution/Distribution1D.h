@@ -7,7 +7,7 @@
 namespace hist {
     /**
      * @brief This is a small wrapper around the Container1D class, indicating that the data
-     *        is distributed along the constants::axes::d_vals axis.
+     *        is distributed along the distance axis of hist::detail::get_distance_axis().
      */
     class Distribution1D : public container::Container1D<constants::axes::d_type> {
         public:
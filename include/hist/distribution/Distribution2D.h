@@ -7,7 +7,7 @@
 namespace hist {
     /**
      * @brief This is a small wrapper around the Container2D class, indicating that the data
-     *        is distributed along the constants::axes::d_vals axis.
+     *        is distributed along the distance axis of hist::detail::get_distance_axis().
      */
     class Distribution2D : public container::Container2D<constants::axes::d_type> {
         public:
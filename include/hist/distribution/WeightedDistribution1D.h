@@ -3,13 +3,14 @@
 #include <container/Container1D.h>
 #include <constants/Axes.h>
 #include <hist/distribution/detail/WeightedEntry.h>
+#include <hist/detail/DistanceAxis.h>
 
 namespace hist {
     class Distribution1D;
 
     /**
      * @brief This is a small wrapper around the Container1D class, indicating that the data
-     *        is distributed along the constants::axes::d_vals axis.
+     *        is distributed along the distance axis of hist::detail::get_distance_axis().
      */
     class WeightedDistribution1D : public container::Container1D<detail::WeightedEntry> {
         public:
@@ -73,5 +74,9 @@ namespace hist {
 
             WeightedDistribution1D& operator+=(const WeightedDistribution1D& other);
             WeightedDistribution1D& operator-=(const WeightedDistribution1D& other);
+
+        private:
+            double width = detail::get_bin_width(); // The width of the distance bins, fixed at construction.
+            double inv_width = 1./width;
     };
 }
\ No newline at end of file
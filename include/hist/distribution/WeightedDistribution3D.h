@@ -3,13 +3,14 @@
 #include <container/Container3D.h>
 #include <constants/Axes.h>
 #include <hist/distribution/detail/WeightedEntry.h>
+#include <hist/detail/DistanceAxis.h>
 
 namespace hist {
     class Distribution3D;
 
     /**
      * @brief This is a small wrapper around the Container3D class, indicating that the data
-     *        is distributed along the constants::axes::d_vals axis. Anything added to this
+     *        is distributed along the distance axis of hist::detail::get_distance_axis(). Anything added to this
      *        distribution will be tracked by the WeightedDistribution class, which may add
      *        a significant overhead compared to a pure Distribution1D class.
      */
@@ -42,5 +43,9 @@ namespace hist {
              * @brief Extract the weights from this distribution.
              */
             std::vector<double> get_weights() const;
+
+        private:
+            double width = detail::get_bin_width(); // The width of the distance bins, fixed at construction.
+            double inv_width = 1./width;
     };
 }
\ No newline at end of file
@@ -2,6 +2,7 @@
 
 #include <constants/Axes.h>
 #include <iosfwd>
+#include <cstdint>
 
 namespace hist {
     namespace detail {
@@ -11,7 +12,7 @@ namespace hist {
          */
         struct WeightedEntry {
             WeightedEntry();
-            WeightedEntry(constants::axes::d_type value, unsigned int count, double bin_center);
+            WeightedEntry(constants::axes::d_type value, std::uint64_t count, double bin_center);
 
             /**
              * @brief Add the distance to this bin, and increase the counter by one.
@@ -30,7 +31,7 @@ namespace hist {
             bool operator==(double other) const;
             
             constants::axes::d_type value = 0;
-            unsigned int count = 0;
+            std::uint64_t count = 0; // 64-bit since a single bin of a large system may receive more than 2^32 pairs
             double bin_center = 0;
         };
 
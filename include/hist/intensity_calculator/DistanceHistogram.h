@@ -33,6 +33,7 @@ namespace hist {
 
             /**
              * @brief Create an unweighted distance histogram.
+             *        The bins are assumed to have the width given by settings::axes::distance_bin_width.
              */
             DistanceHistogram(hist::Distribution1D&& p_tot);
 
@@ -71,6 +72,7 @@ namespace hist {
 
             /**
              * @brief Get the q axis used in the Fourier transform. 
+             *        The axis follows the q-range of the calling thread, and the returned reference is only valid until that range changes. 
              */
             static const std::vector<double>& get_q_axis();
 
@@ -99,6 +101,7 @@ namespace hist {
             /**
              * @brief Use a weighted sinc table for the Debye transform.
              *        This defines the weighted_sinc_table member based on the current d_axis and sets use_weighted_table to true.
+             *        This is also used for histograms with a non-default bin width, since the default table cannot be used for those.
              */
             void use_weighted_sinc_table();
 
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <hist/symmetry/Symmetry.h>
+#include <math/Matrix.h>
+#include <math/Vector3.h>
+
+namespace hist::symmetry {
+    /**
+     * @brief A helical symmetry, generating a finite number of repeats of the asymmetric unit.
+     *        Each repeat is rotated by a fixed angle around the helical axis and translated by a fixed rise along it relative to the previous one.
+     *        This describes filaments and other helical assemblies.
+     */
+    class HelicalSymmetry : public Symmetry {
+        public:
+            /**
+             * @param axis The direction of the helical axis.
+             * @param center A point on the helical axis.
+             * @param twist The rotation between consecutive repeats in radians.
+             * @param rise The translation between consecutive repeats along the axis in Ångström.
+             * @param repeats The total number of repeats, including the asymmetric unit.
+             *
+             * @throws except::invalid_argument if @a repeats is zero or the axis has no length.
+             */
+            HelicalSymmetry(const Vector3<double>& axis, const Vector3<double>& center, double twist, double rise, unsigned int repeats);
+
+            ~HelicalSymmetry() override = default;
+
+            unsigned int copies() const override;
+
+            Vector3<double> apply(const Vector3<double>& v, unsigned int copy) const override;
+
+            /**
+             * @brief All pairs of repeats k steps apart have identical cross histograms. Since the helix is finite, there are repeats-k such pairs.
+             */
+            std::vector<CrossTerm> get_cross_terms() const override;
+
+        private:
+            Vector3<double> center;
+            Vector3<double> step;                  // The translation between consecutive repeats.
+            std::vector<Matrix<double>> rotations; // The rotation of each repeat.
+    };
+}
\ No newline at end of file
@@ -3,17 +3,20 @@
 #include <hist/symmetry/Symmetry.h>
 #include <math/Vector3.h>
 
-namespace hist::detail {class CompactCoordinates;}
 namespace hist::symmetry {
     namespace detail {
         struct Plane {
-            Plane(Vector3<double>&& x, Vector3<double>&& y) : x(std::move(x)), y(std::move(y)) {normal = x.cross(y).normalize();}
+            Plane(Vector3<double>&& x, Vector3<double>&& y) : x(std::move(x)), y(std::move(y)) {normal = this->x.cross(this->y).normalize();}
             Plane(const Vector3<double>& x, const Vector3<double>& y) : x(x), y(y) {normal = x.cross(y).normalize();}
 
             Vector3<double> x, y, normal;
         };
     }
 
+    /**
+     * @brief A mirror symmetry across a plane through the origin, spanned by two vectors. 
+     *        This generates a single mirrored copy of the asymmetric unit.
+     */
     class PlaneSymmetry : public Symmetry {
         public:
             PlaneSymmetry(Vector3<double>&& x, Vector3<double>&& y) : plane(std::move(x), std::move(y)) {}
@@ -26,7 +29,11 @@ namespace hist::symmetry {
              */
             Vector3<double> mirror(const Vector3<double>& v) const;
 
-            std::vector<double> calculate_cross_terms(hist::detail::CompactCoordinates& body1, hist::detail::CompactCoordinates& body2);
+            unsigned int copies() const override;
+
+            Vector3<double> apply(const Vector3<double>& v, unsigned int copy) const override;
+
+            std::vector<CrossTerm> get_cross_terms() const override;
 
         private:
             detail::Plane plane;
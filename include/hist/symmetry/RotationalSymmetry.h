@@ -0,0 +1,38 @@
+#pragma once
+
+#include <hist/symmetry/Symmetry.h>
+#include <math/Matrix.h>
+#include <math/Vector3.h>
+
+namespace hist::symmetry {
+    /**
+     * @brief A cyclic point-group symmetry C_n, generating @a n copies of the asymmetric unit rotated by multiples of 360/n degrees around an axis.
+     *        This describes homo-oligomers such as dimers, trimers, or rings of subunits.
+     */
+    class RotationalSymmetry : public Symmetry {
+        public:
+            /**
+             * @param axis The direction of the rotation axis.
+             * @param center A point on the rotation axis.
+             * @param n The order of the symmetry, i.e. the total number of copies including the asymmetric unit.
+             *
+             * @throws except::invalid_argument if @a n is zero or the axis has no length.
+             */
+            RotationalSymmetry(const Vector3<double>& axis, const Vector3<double>& center, unsigned int n);
+
+            ~RotationalSymmetry() override = default;
+
+            unsigned int copies() const override;
+
+            Vector3<double> apply(const Vector3<double>& v, unsigned int copy) const override;
+
+            /**
+             * @brief Copies k and n-k have identical cross histograms with the asymmetric unit, so only the first half of the copies are needed.
+             */
+            std::vector<CrossTerm> get_cross_terms() const override;
+
+        private:
+            Vector3<double> center;
+            std::vector<Matrix<double>> rotations; // The rotation of each copy.
+    };
+}
\ No newline at end of file
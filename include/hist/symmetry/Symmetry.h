@@ -1,13 +1,43 @@
 #pragma once
 
+#include <math/Vector3.h>
+
+#include <vector>
+
 namespace hist::symmetry {
+    /**
+     * @brief A distinct cross term between the asymmetric unit and one of its copies.
+     *        All pairs of copies related by the same operator have identical cross histograms, so each distinct term is only calculated once.
+     */
+    struct CrossTerm {
+        unsigned int copy;          // The index of the copy paired with the asymmetric unit.
+        unsigned int multiplicity;  // The number of unordered pairs of copies sharing this cross histogram.
+    };
+
     /**
      * @brief A class for storing symmetry information. 
+     *        A symmetry generates a number of copies of an asymmetric unit, where copy 0 is the asymmetric unit itself.
      */
     class Symmetry {
         public:
             Symmetry() = default;
 
             virtual ~Symmetry() = default;
+
+            /**
+             * @brief Get the total number of copies generated by this symmetry, including the asymmetric unit itself.
+             */
+            virtual unsigned int copies() const = 0;
+
+            /**
+             * @brief Get the position of @a v in the given copy of the asymmetric unit.
+             */
+            virtual Vector3<double> apply(const Vector3<double>& v, unsigned int copy) const = 0;
+
+            /**
+             * @brief Get the distinct cross terms between the copies. 
+             *        The multiplicities sum to the total number of unordered pairs of copies, copies()*(copies()-1)/2.
+             */
+            virtual std::vector<CrossTerm> get_cross_terms() const = 0;
     };
 }
\ No newline at end of file
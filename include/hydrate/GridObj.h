@@ -3,6 +3,7 @@
 #include <utility/Concepts.h>
 #include <math/MathFwd.h>
 #include <container/Container3D.h>
+#include <utility/Memory.h>
 
 namespace grid {
     namespace detail {
@@ -112,6 +113,9 @@ namespace grid {
                 using container::Container3D<State>::index;
                 State& index(const Vector3<int>& v);
                 const State& index(const Vector3<int>& v) const;
+
+            private:
+                utility::memory::Account account{utility::memory::Subsystem::Grid};
         };
     }
 }
\ No newline at end of file
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <vector>
+
+namespace math {
+    /**
+     * @brief Resample curves defined on a fixed x-axis onto a fixed set of evaluation points using a cubic spline.
+     *
+     * The spline is linear in the y-values, so for fixed x and z everything except the y-dependent parts can be precalculated once.
+     * This includes the tridiagonal elimination coefficients, the interval index of each evaluation point, and the powers of the offsets within each interval.
+     * The remaining work per curve is a single O(n) forward/backward sweep and an O(m) evaluation, all in preallocated buffers.
+     * The results are identical to those of CubicSpline up to floating-point rounding.
+     */
+    class CubicSplineResampler {
+        public:
+            /**
+             * @brief Precalculate the resampling operator.
+             *
+             * @param x The x-axis of the curves to be resampled. Must be strictly increasing.
+             * @param z The points to evaluate the resampled curves at.
+             */
+            CubicSplineResampler(const std::vector<double>& x, const std::vector<double>& z);
+
+            /**
+             * @brief Resample the curve @a y into the preallocated @a out.
+             *        No allocations are performed if @a out already has the correct size.
+             *
+             * @param y The y-values of the curve. Must have the same size as the x-axis.
+             * @param out The output buffer. It will be resized to the number of evaluation points if necessary.
+             */
+            void resample(const std::vector<double>& y, std::vector<double>& out) const;
+
+            /**
+             * @brief Resample the curve @a y.
+             */
+            [[nodiscard]] std::vector<double> resample(const std::vector<double>& y) const;
+
+            /**
+             * @brief Get the number of points on the input x-axis.
+             */
+            [[nodiscard]] unsigned int size_in() const noexcept;
+
+            /**
+             * @brief Get the number of evaluation points.
+             */
+            [[nodiscard]] unsigned int size_out() const noexcept;
+
+        private:
+            // x-dependent parts of the spline
+            std::vector<double> inv_h, inv_h2, h_ratio, inv_D, Q;
+
+            // z-dependent parts of the evaluation
+            std::vector<unsigned int> index;
+            std::vector<double> dz, dz2, dz3;
+
+            // y-dependent scratch buffers
+            mutable std::vector<double> p, B, b;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <vector>
+#include <complex>
+
+namespace math {
+    /**
+     * @brief Calculate the discrete Fourier transform of @a data in place with the iterative radix-2 Cooley-Tukey algorithm.
+     *        The forward transform is defined as X[k] = sum_n x[n] exp(-2 pi i kn/N), and is unnormalized in both directions.
+     *
+     * Complexity: O(N log N)
+     *
+     * @param data The data to transform. The size must be a power of two.
+     * @param inverse Whether to calculate the inverse transform instead.
+     */
+    void fft(std::vector<std::complex<double>>& data, bool inverse = false);
+
+    /**
+     * @brief Calculate the three-dimensional discrete Fourier transform of @a data in place.
+     *        The data is stored in row-major order, i.e. the element (i, j, k) is located at index (i*ny + j)*nz + k.
+     *        The one-dimensional transforms along each axis are distributed over the global thread pool.
+     *
+     * @param data The data to transform.
+     * @param nx, ny, nz The size of each dimension. Each must be a power of two.
+     * @param inverse Whether to calculate the inverse transform instead.
+     */
+    void fft3(std::vector<std::complex<double>>& data, unsigned int nx, unsigned int ny, unsigned int nz, bool inverse = false);
+
+    /**
+     * @brief Get the smallest power of two which is at least @a n.
+     */
+    unsigned int next_power_of_two(unsigned int n);
+}
\ No newline at end of file
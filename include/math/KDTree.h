@@ -0,0 +1,64 @@
+#pragma once
+
+#include <math/Vector3.h>
+
+#include <vector>
+#include <limits>
+#include <utility>
+
+namespace math {
+    /**
+     * @brief A static three-dimensional kd-tree for nearest-neighbour and radius queries.
+     *
+     * The tree is built once in O(n log n) and cannot be modified afterwards.
+     * It is stored implicitly in a single permuted array, where the node of the range [begin, end) is the median element (begin+end)/2,
+     * and its left and right subtrees are the ranges to either side of it. Each range is split along the axis with the largest extent.
+     */
+    class KDTree {
+        public:
+            KDTree() = default;
+
+            /**
+             * @brief Build a tree over the given points.
+             *        All queries return indices into this vector.
+             */
+            KDTree(const std::vector<Vector3<double>>& points);
+
+            /**
+             * @brief Find the point closest to @a p.
+             *
+             * Complexity: O(log n) on average.
+             *
+             * @param p The query point.
+             * @param max_distance Only points strictly closer than this distance are considered.
+             *
+             * @return The index of the closest point and its distance to @a p. The index is -1 if no point was found.
+             *         If several points are equally close, the one with the largest index is returned.
+             */
+            [[nodiscard]] std::pair<int, double> nearest(const Vector3<double>& p, double max_distance = std::numeric_limits<double>::infinity()) const;
+
+            /**
+             * @brief Find all points within a distance @a r of @a p, in no particular order.
+             */
+            [[nodiscard]] std::vector<unsigned int> radius_search(const Vector3<double>& p, double r) const;
+
+            /**
+             * @brief Get the number of points in this tree.
+             */
+            [[nodiscard]] unsigned int size() const noexcept;
+
+            /**
+             * @brief Check if this tree is empty.
+             */
+            [[nodiscard]] bool empty() const noexcept;
+
+        private:
+            std::vector<Vector3<double>> points; // The points in tree order.
+            std::vector<unsigned int> indices;   // The original index of each point, in tree order.
+            std::vector<unsigned char> axes;     // The split axis of each node.
+
+            void build(const std::vector<Vector3<double>>& source, unsigned int begin, unsigned int end);
+            void nearest(unsigned int begin, unsigned int end, const Vector3<double>& p, int& best, double& best_d2) const;
+            void radius_search(unsigned int begin, unsigned int end, const Vector3<double>& p, double r2, std::vector<unsigned int>& out) const;
+    };
+}
\ No newline at end of file
@@ -5,6 +5,7 @@
 
 #include <vector>
 #include <memory>
+#include <span>
 
 namespace fitter {
     /**
@@ -46,6 +47,26 @@ namespace fitter {
 
             [[nodiscard]] virtual double fit_chi2_only() override;
 
+            /**
+             * @brief Perform a weighted linear least-squares fit directly on raw arrays, without copying them into a dataset. 
+             *        No allocations are performed, making this suitable for use inside minimizer loops. 
+             * 
+             * @param x The x-values. 
+             * @param y The y-values. 
+             * @param w The weight of each point, typically 1/yerr^2.
+             * @return The fitted parameters (a, b) for the equation y = ax+b.
+             */
+            [[nodiscard]] static std::pair<double, double> fit_params_only(std::span<const double> x, std::span<const double> y, std::span<const double> w);
+
+            /**
+             * @brief Calculate chi2 of the line y = ax+b directly on raw arrays. No allocations are performed. 
+             * 
+             * @param x The x-values. 
+             * @param y The y-values. 
+             * @param w The weight of each point, typically 1/yerr^2.
+             */
+            [[nodiscard]] static double chi2(std::span<const double> x, std::span<const double> y, std::span<const double> w, double a, double b);
+
             /**
              * @brief Perform a linear least-squares fit. 
              * @return A Fit object containing various information for the fit. 
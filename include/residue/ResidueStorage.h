@@ -2,9 +2,12 @@
 
 #include <residue/ResidueParser.h>
 
+#include <shared_mutex>
+
 namespace residue {
     /**
      * @brief A storage container for residues.
+     *        Lookups are safe to perform from multiple threads at the same time.
      */
     class ResidueStorage {
         public: 
@@ -51,5 +54,6 @@ namespace residue {
             void write_residue(const std::string& name);
 
             std::unordered_map<std::string, detail::ResidueMap> data;
+            std::shared_mutex mutex; // Guards the map, since missing residues are inserted during lookups.
     };
 }
\ No newline at end of file
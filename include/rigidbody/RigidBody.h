@@ -5,7 +5,9 @@
 #include <fitter/FitterFwd.h>
 #include <data/Molecule.h>
 
+#include <cstdint>
 #include <memory>
+#include <string>
 
 namespace rigidbody {
 	namespace detail {
@@ -31,6 +33,12 @@ namespace rigidbody {
 
 			/**
 			 * @brief Perform a rigid-body optimization for this structure. 
+			 * 
+			 * If settings::rigidbody::replicas is larger than one, the optimization is performed with parallel tempering instead. 
+			 * Otherwise, if settings::rigidbody::speculative_moves is larger than one, each step evaluates that many candidate moves concurrently. 
+			 * Both cannot be enabled at the same time. 
+			 * 
+			 * @throws except::invalid_argument if both settings::rigidbody::replicas and settings::rigidbody::speculative_moves are larger than one.
 			 */
 			std::shared_ptr<fitter::Fit> optimize(const std::string& measurement_path);
 
@@ -58,6 +66,7 @@ namespace rigidbody {
 			std::unique_ptr<transform::TransformStrategy> transform;
 			std::unique_ptr<parameter::ParameterGenerationStrategy> parameter_generator;
 			std::shared_ptr<fitter::LinearFitter> fitter;
+			std::uint64_t checkpoint_key = 0; // Identifies the measurement and initial structure of the current optimization. Checkpoints with a different key are rejected.
 
 			/**
 			 * @brief Perform an optimization step.
@@ -66,11 +75,102 @@ namespace rigidbody {
 			 */
 			bool optimize_step(detail::BestConf& best);
 
+			/**
+			 * @brief Perform a Metropolis optimization step at the given temperature. 
+			 *        At zero temperature this is equivalent to optimize_step(BestConf&). 
+			 * 
+			 * @param current The current configuration. It is updated if the step is accepted. 
+			 * @param temperature The temperature of the chain in units of chi2. 
+			 * @param u A uniform random number in [0, 1) used for the acceptance test. 
+			 * 
+			 * @return True if the step was accepted, false otherwise.
+			 */
+			bool optimize_step(detail::BestConf& current, double temperature, double u);
+
+			/**
+			 * @brief Perform a parallel-tempering optimization for this structure. 
+			 * 
+			 * settings::rigidbody::replicas copies of this structure are optimized concurrently at different temperatures, 
+			 * each with its own grid, histogram manager and fitter. Every settings::rigidbody::swap_interval steps, 
+			 * neighbouring temperatures are exchanged with the usual replica-exchange acceptance criterion. 
+			 * The best configuration found by any replica is transferred back to this structure. 
+			 */
+			std::shared_ptr<fitter::Fit> optimize_tempered(const std::string& measurement_path);
+
+			/**
+			 * @brief Perform a greedy optimization where each step evaluates several candidate moves concurrently. 
+			 * 
+			 * The candidates are drawn in the same order as in the serial optimization, and the first one which improves the chi2 is committed. 
+			 * The candidates drawn after it are evaluated again from the new configuration in the next step, 
+			 * so the accepted moves and the result are the same as for the serial optimization with the same seed. 
+			 * 
+			 * This structure is the first of settings::rigidbody::speculative_moves workers. The other workers each hold a full copy of it, 
+			 * since their histogram managers must see all bodies. The copies are only made once. 
+			 * After each step, the workers which did not produce the committed move only copy the moved bodies and the new hydration shell from the winner. 
+			 * Checkpoints are written like in the serial optimization. 
+			 */
+			std::shared_ptr<fitter::Fit> optimize_speculative(const std::string& measurement_path);
+
+			/**
+			 * @brief Replace the current configuration of this structure with the given bodies and hydration shell. 
+			 *        The grid is discarded and will be regenerated when needed. 
+			 */
+			void adopt_configuration(const std::vector<data::Body>& bodies, std::vector<data::record::Water>&& waters);
+
+			/**
+			 * @brief Save a checkpoint of the current optimization state. 
+			 * 
+			 * The body coordinates, hydration shell and the states of the body selection and parameter generation strategies are written to a temporary file, 
+			 * which then atomically replaces the previous checkpoint. 
+			 * 
+			 * @param iteration The number of completed iterations.
+			 */
+			void save_checkpoint(unsigned int iteration) const;
+
+			/**
+			 * @brief Save a checkpoint of the current configuration, but with previously saved states of the body selection and parameter generation strategies. 
+			 * 
+			 * @param iteration The number of completed iterations.
+			 * @param generator_state The strategy states, as returned by save_generator_state().
+			 */
+			void save_checkpoint(unsigned int iteration, const std::string& generator_state) const;
+
+			/**
+			 * @brief Get the serialized states of the body selection and parameter generation strategies, in the format used by the checkpoints. 
+			 */
+			std::string save_generator_state() const;
+
+			/**
+			 * @brief Calculate the checkpoint key of an optimization of the current structure against the given measurement. 
+			 *        This must be called before any moves are made, since it hashes the contents of the measurement file together with the current coordinates. 
+			 * 
+			 * @throws except::io_error if the measurement file cannot be read.
+			 */
+			std::uint64_t checkpoint_hash(const std::string& measurement_path) const;
+
+			/**
+			 * @brief Load a checkpoint of the optimization state. 
+			 * 
+			 * @return The number of completed iterations. Returns 0 if no checkpoint file exists.
+			 * @throws except::unexpected if the checkpoint was written for different settings, a different measurement, or a different initial structure.
+			 */
+			unsigned int load_checkpoint();
+
+			/**
+			 * @brief Remove the checkpoint file, if any. This must be done when an optimization completes, since it would otherwise be resumed by the next run.
+			 */
+			void remove_checkpoint() const;
+
 			/**
 			 * @brief Prepare the fitter for this rigidbody.
 			 */
 			void prepare_fitter(const std::string& measurement_path); 
 
+			/**
+			 * @brief Reseed the body selection and parameter generation strategies. 
+			 */
+			void seed(unsigned int seed);
+
 			/**
 			 * @brief Small initialization function.
 			 */
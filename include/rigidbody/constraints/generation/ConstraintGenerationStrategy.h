@@ -1,8 +1,12 @@
 #pragma once
 
 #include <rigidbody/detail/RigidbodyInternalFwd.h>
+#include <data/DataFwd.h>
+#include <math/KDTree.h>
 
 #include <vector>
+#include <tuple>
+#include <limits>
 
 namespace rigidbody::constraints {
     class ConstraintGenerationStrategy {
@@ -16,5 +20,31 @@ namespace rigidbody::constraints {
             virtual std::vector<DistanceConstraint> generate() const = 0;
 
             const ConstraintManager* manager;
+
+        protected:
+            /**
+             * @brief The carbon atoms of a body, indexed by a kd-tree for fast closest-pair queries. 
+             */
+            struct CarbonIndex {
+                std::vector<unsigned int> atoms; // The indices of the carbon atoms in the body.
+                math::KDTree tree;               // A tree over the coordinates of the carbon atoms.
+            };
+
+            /**
+             * @brief Build a carbon index for each body of the molecule. 
+             */
+            std::vector<CarbonIndex> index_carbons() const;
+
+            /**
+             * @brief Find the closest pair of carbon atoms between two bodies. 
+             * 
+             * Complexity: O(n log m) where n is the number of carbon atoms in the smaller body, and m in the larger. 
+             * 
+             * @param max_distance Only pairs strictly closer than this distance are considered.
+             * 
+             * @return The indices of the two atoms in their respective bodies and their distance. The indices are -1 if no pair was found. 
+             *         If several pairs are equally close, the last one is returned, ordered first by the atom of @a body1.
+             */
+            static std::tuple<int, int, double> closest_carbons(const data::Body& body1, const CarbonIndex& index1, const data::Body& body2, const CarbonIndex& index2, double max_distance = std::numeric_limits<double>::infinity());
     };
 }
\ No newline at end of file
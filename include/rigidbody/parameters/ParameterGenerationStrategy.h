@@ -7,6 +7,7 @@
 #include <tuple>
 #include <atomic>
 #include <random>
+#include <iosfwd>
 
 namespace rigidbody::parameter {    
     /**
@@ -30,6 +31,21 @@ namespace rigidbody::parameter {
 
             Parameter next();
 
+            /**
+             * @brief Reseed the random number generator, making the sequence of generated parameters reproducible. 
+             */
+            void seed(unsigned int seed);
+
+            /**
+             * @brief Write the current iteration and random number generator state to a checkpoint. 
+             */
+            void save_state(std::ostream& out) const;
+
+            /**
+             * @brief Restore the current iteration and random number generator state from a checkpoint. 
+             */
+            void load_state(std::istream& in);
+
         protected:
             std::atomic_uint iteration = 0;                          // Current iteration. 
             int iterations;                                          // The total number of iterations. Used to determine the current scaling. 
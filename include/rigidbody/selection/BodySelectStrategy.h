@@ -3,6 +3,7 @@
 #include <rigidbody/RigidbodyFwd.h>
 
 #include <utility>
+#include <iosfwd>
 
 namespace rigidbody {
     namespace selection {
@@ -27,6 +28,21 @@ namespace rigidbody {
                  */
                 virtual std::pair<unsigned int, unsigned int> next() = 0;
 
+                /**
+                 * @brief Reseed the random number generator of this strategy, if any. 
+                 */
+                virtual void seed(unsigned int seed);
+
+                /**
+                 * @brief Write the internal state of this strategy to a checkpoint. 
+                 */
+                virtual void save_state(std::ostream& out) const;
+
+                /**
+                 * @brief Restore the internal state of this strategy from a checkpoint. 
+                 */
+                virtual void load_state(std::istream& in);
+
             protected: 
                 const RigidBody* rigidbody;
                 unsigned int N;
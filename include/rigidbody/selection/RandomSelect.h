@@ -26,6 +26,12 @@ namespace rigidbody {
                  */
                 std::pair<unsigned int, unsigned int> next() override;
 
+                void seed(unsigned int seed) override;
+
+                void save_state(std::ostream& out) const override;
+
+                void load_state(std::istream& in) override;
+
             private:
                 std::mt19937 generator;                          // The random number generator. 
                 std::uniform_int_distribution<int> distribution; // The random number distribution. 
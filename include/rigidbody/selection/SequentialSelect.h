@@ -28,6 +28,10 @@ namespace rigidbody {
 				 */
 				std::pair<unsigned int, unsigned int> next() override;
 
+				void save_state(std::ostream& out) const override;
+
+				void load_state(std::istream& in) override;
+
 			private:
 				unsigned int ibody = 0; 		// The index of the body to be transformed. 
 				unsigned int iconstraint = 0; 	// The index of the constraint to be transformed.
@@ -42,6 +42,11 @@ namespace rigidbody::transform {
              */
             virtual void undo();
 
+            /**
+             * @brief Get the indices of the bodies modified by the most recent transformation. 
+             */
+            std::vector<unsigned int> get_modified_bodies() const;
+
         protected: 
             RigidBody* rigidbody;
 
@@ -9,4 +9,5 @@
 #include <settings/PlotSettings.h>
 #include <settings/MoleculeSettings.h>
 #include <settings/RigidBodySettings.h>
-#include <settings/SettingsIO.h>
\ No newline at end of file
+#include <settings/SettingsIO.h>
+#include <settings/SettingsContext.h>
\ No newline at end of file
@@ -8,6 +8,8 @@ namespace settings {
 
         extern double max_q;          // The maximum length of the Miller indices. 
         extern double grid_expansion; // The factor by which the grid is expanded when loading a pdb structure. 
+        extern bool use_fft;          // Whether to calculate all structure factors with a single FFT instead of a direct summation for each Miller index. The direct summation is still used if the FFT grid exceeds the memory budget or detail::max_fft_memory.
+        extern bool use_symmetry;     // Whether to only calculate the structure factors of the asymmetric unit of the Miller indices, using the detected symmetry of the unit cell. Enabled by default, since the resulting profile only differs by rounding.
 
         namespace reduced {
             extern double basis_q;    // The maximum q value for which the basis is generated.
@@ -15,6 +17,7 @@ namespace settings {
 
         namespace detail {
             extern bool use_checkpointing; // Whether to use checkpointing during the calculation. 
+            extern unsigned int max_fft_memory; // The largest FFT grid in MB. Larger grids always use the direct summation, even without a memory budget.
         }
     }
 }
@@ -27,4 +30,11 @@ namespace settings::crystal {
         Fibonacci // Similar to Reduced, but uses a Fibonacci sphere to make the basis more uniform. Experimental and not recommended for general usage.
     };
     extern MillerGenerationChoice miller_generation_strategy;
+
+    // The choice of orientations used for rotational averaging. 
+    enum class OrientationChoice {
+        Random,   // Uniformly distributed random orientations. 
+        Fibonacci // Orientations spread evenly over the sphere with a Fibonacci lattice. 
+    };
+    extern OrientationChoice orientation_strategy;
 }
\ No newline at end of file
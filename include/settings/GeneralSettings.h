@@ -8,9 +8,13 @@ namespace settings {
         extern bool verbose;                        // Whether to print out extra information.
         extern bool warnings;                       // Whether to print out warnings.
         extern unsigned int threads;                // The number of threads to use for parallelization.
+        extern bool pin_threads;                    // Whether to pin each worker thread to a single core, grouped by NUMA node. Only supported on Linux.
+        extern unsigned int processes;              // The number of worker processes used by the multi-process histogram manager. 0 means one per thread.
         extern std::string output;                  // The output directory.
         extern bool keep_hydrogens;                 // Whether to keep bound hydrogens when reading a structure.
         extern bool supplementary_plots;            // Whether to generate supplementary plots when possible.
+        extern unsigned int memory_budget;          // The soft memory budget in MB. Memory-intensive calculations use less parallelism or slower strategies to stay within it. 0 means no budget.
+        extern std::string table_store;             // Directory of the table store shared between processes. If empty, each process calculates its own tables.
 
         namespace detail {
             extern unsigned int job_size;           // The number of atoms to process in each job.
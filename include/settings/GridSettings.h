@@ -4,16 +4,16 @@
 
 namespace settings {
     namespace grid {
-        extern double water_scaling; // The number of generated water molecules as a percent of the number of atoms.
-        extern double width;         // Width of each bin of the grid used to represent this protein in Å.
-        extern double scaling;       // The percent increase in grid size in all dimensions when the grid size is automatically deduced based on an input vector of atoms.
-        extern bool   cubic;         // Whether to generate a cubic grid. This is primarily intended for rigid body optimization, to ensure there's enough space for all possible conformations.
-        extern double rvol;          // The radius of the excluded volume sphere around each atom.
-        extern double exv_radius;    // The radius of the excluded volume sphere used for the grid-based excluded volume calculations in Å.
-        extern bool   save_exv;      // Whether to save the excluded volume grid when using the grid-based excluded volume calculations.
+        extern thread_local double water_scaling; // The number of generated water molecules as a percent of the number of atoms.
+        extern thread_local double width;         // Width of each bin of the grid used to represent this protein in Å.
+        extern thread_local double scaling;       // The percent increase in grid size in all dimensions when the grid size is automatically deduced based on an input vector of atoms.
+        extern thread_local bool   cubic;         // Whether to generate a cubic grid. This is primarily intended for rigid body optimization, to ensure there's enough space for all possible conformations.
+        extern thread_local double rvol;          // The radius of the excluded volume sphere around each atom.
+        extern thread_local double exv_radius;    // The radius of the excluded volume sphere used for the grid-based excluded volume calculations in Å.
+        extern thread_local bool   save_exv;      // Whether to save the excluded volume grid when using the grid-based excluded volume calculations.
 
         namespace detail {
-            extern double min_score; // (0.5 + min_score) is the minimum percentage of radial lines which must not intersect anything to place a water molecule.
+            extern thread_local double min_score; // (0.5 + min_score) is the minimum percentage of radial lines which must not intersect anything to place a water molecule.
         }
     }
 }
@@ -24,7 +24,7 @@ namespace settings::grid {
         RadialStrategy, 
         JanStrategy
     };
-    extern PlacementStrategy placement_strategy;
+    extern thread_local PlacementStrategy placement_strategy;
 }
 
 namespace settings::grid {
@@ -33,5 +33,5 @@ namespace settings::grid {
         OutlierStrategy, 
         RandomStrategy
     };
-    extern CullingStrategy culling_strategy;
+    extern thread_local CullingStrategy culling_strategy;
 }
\ No newline at end of file
@@ -2,9 +2,11 @@
 
 namespace settings {
     namespace axes {
-        extern unsigned int skip;   // The number of points to skip from the top of the scattering curve.
-        extern double qmin;         // Lower limit on the used q-values
-        extern double qmax;         // Upper limit on the used q-values
+        extern thread_local unsigned int skip;   // The number of points to skip from the top of the scattering curve.
+        extern thread_local double qmin;         // Lower limit on the used q-values
+        extern thread_local double qmax;         // Upper limit on the used q-values
+        extern thread_local double distance_bin_width; // The width of the distance bins of the histograms in Ångström.
+        extern thread_local double max_distance;       // The largest distance representable by the histograms in Ångström.
     }
 }
 
@@ -21,9 +23,10 @@ namespace settings::hist {
         PartialHistogramManagerMTFFAvg,      // A multithreaded implementation of the partial manager that uses precalculated form factor products and an average for the excluded volume.
         PartialHistogramManagerMTFFExplicit, // A multithreaded implementation of the partial manager that uses precalculated form factor products for both the protein and the excluded volume. 
         PartialHistogramManagerMTFFGrid,     // A multithreaded implementation of the partial manager using a grid-based approach to evaluate the excluded volume.
+        HistogramManagerMP,                  // A multi-process implementation of the simple manager, sharding the calculation across worker processes on the same host.
         DebugManager,
     };
-    extern bool use_foxs_method; // Whether to use the FoXS methods to evaluate the scattering intensity.
-    extern bool weighted_bins;   // Whether to use weighted p(r) bins or not.
-    extern HistogramManagerChoice histogram_manager;
+    extern thread_local bool use_foxs_method; // Whether to use the FoXS methods to evaluate the scattering intensity.
+    extern thread_local bool weighted_bins;   // Whether to use weighted p(r) bins or not.
+    extern thread_local HistogramManagerChoice histogram_manager;
 }
\ No newline at end of file
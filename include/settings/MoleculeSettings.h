@@ -2,9 +2,9 @@
 
 namespace settings {
     namespace molecule {
-        extern bool center;               // Decides if the structure will be centered at origo.
-        extern bool use_effective_charge; // Decides whether the charge of the displaced water will be included.
-        extern bool throw_on_unknown_atom;// Decides whether an exception will be thrown if an unknown atom is encountered.
-        extern bool implicit_hydrogens;   // Decides whether implicit hydrogens will be added to the structure.
+        extern thread_local bool center;               // Decides if the structure will be centered at origo.
+        extern thread_local bool use_effective_charge; // Decides whether the charge of the displaced water will be included.
+        extern thread_local bool throw_on_unknown_atom;// Decides whether an exception will be thrown if an unknown atom is encountered.
+        extern thread_local bool implicit_hydrogens;   // Decides whether implicit hydrogens will be added to the structure.
     }
 }
\ No newline at end of file
@@ -8,8 +8,15 @@
 
 namespace settings {
     namespace rigidbody {
-        extern unsigned int iterations;   // The number of iterations to run the rigid body optimization for.
-        extern double bond_distance;      // The maximum distance in Ångström between two atoms that allows for a constraint.
+        extern unsigned int iterations;          // The number of iterations to run the rigid body optimization for.
+        extern double bond_distance;             // The maximum distance in Ångström between two atoms that allows for a constraint.
+        extern unsigned int replicas;            // The number of parallel-tempering replicas. A single replica is the classic greedy optimization.
+        extern double max_temperature;           // The temperature of the hottest replica, in units of chi2. The coldest replica always has zero temperature.
+        extern unsigned int swap_interval;       // The number of steps each replica performs between attempted configuration swaps.
+        extern unsigned int speculative_moves;   // The number of candidate moves evaluated concurrently in each optimization step. A single move is the classic serial optimization. The result is the same, and this cannot be combined with replicas.
+        extern bool use_checkpointing;           // Whether to periodically write a checkpoint during the optimization, and resume from it if one already exists.
+        extern unsigned int checkpoint_interval; // The number of iterations between checkpoints.
+        extern unsigned int seed;                // The seed of the random number generators. Zero draws a new random seed for each run.
 
         namespace detail {
             extern std::vector<int> constraints; // The residue ids to place a constraint at.
@@ -6,6 +6,7 @@
 #include <vector>
 #include <string>
 #include <memory>
+#include <functional>
 #include <unordered_map>
 #include <stdexcept>
 
@@ -35,26 +36,27 @@ namespace settings {
 
             /**
              * @brief A reference to a setting. 
+             *        The setting is accessed through a function which is called on every use, such that thread-local settings always refer to the value of the calling thread. 
              */
             template<typename T> struct SettingRef : public ISettingRef {
-                SettingRef(T& setting, const std::vector<std::string>& names) : ISettingRef(names), settingref(setting) {}
+                SettingRef(std::function<T&()> setting, const std::vector<std::string>& names) : ISettingRef(names), settingref(std::move(setting)) {}
                 virtual ~SettingRef() = default;
 
                 /**
                  * @brief Set the setting value.
                  */
                 void set(const std::vector<std::string>&) override {
-                    throw std::runtime_error("settings::io::detail::SettingRef::set: missing implementation for type \"" + type(settingref) + "\".");
+                    throw std::runtime_error("settings::io::detail::SettingRef::set: missing implementation for type \"" + type(settingref()) + "\".");
                 }
 
                 /**
                  * @brief Get the setting value as a string.
                  */
                 std::string get() const override {
-                    throw std::runtime_error("settings::io::detail::SettingRef::get: missing implementation for type \"" + type(settingref) + "\".");
+                    throw std::runtime_error("settings::io::detail::SettingRef::get: missing implementation for type \"" + type(settingref()) + "\".");
                 }
 
-                T& settingref; // A reference to the setting.
+                std::function<T&()> settingref; // Get a reference to the setting of the calling thread.
             };
 
         }
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <settings/GridSettings.h>
+#include <settings/HistogramSettings.h>
+
+namespace settings {
+    /**
+     * @brief An immutable snapshot of the settings of a single calculation.
+     *
+     * The axes, grid, histogram, molecule and fit settings are local to each thread, such that independent calculations with different settings
+     * can run concurrently in the same process. A new thread starts with the default values, and must be given the context of the thread starting it.
+     * This is done automatically for all tasks submitted through a utility::multi_threading::TaskGroup.
+     * All other settings are shared by the entire process.
+     */
+    class Context {
+        public:
+            /**
+             * @brief Capture the current settings of the calling thread.
+             */
+            Context();
+
+            /**
+             * @brief Replace the settings of the calling thread with this context.
+             */
+            void apply() const;
+
+        private:
+            struct {
+                unsigned int skip;
+                double qmin, qmax;
+                double distance_bin_width, max_distance;
+            } axes;
+
+            struct {
+                double water_scaling, width, scaling, rvol, exv_radius, min_score;
+                bool cubic, save_exv;
+                grid::PlacementStrategy placement_strategy;
+                grid::CullingStrategy culling_strategy;
+            } grid;
+
+            struct {
+                bool use_foxs_method, weighted_bins;
+                hist::HistogramManagerChoice histogram_manager;
+            } hist;
+
+            struct {
+                bool center, use_effective_charge, throw_on_unknown_atom, implicit_hydrogens;
+            } molecule;
+
+            struct {
+                bool verbose;
+                unsigned int N, max_iterations;
+            } fit;
+    };
+
+    /**
+     * @brief Apply a context to the calling thread for the lifetime of this object, and restore the previous settings afterwards.
+     */
+    class ScopedContext {
+        public:
+            ScopedContext(const Context& context);
+            ~ScopedContext();
+
+            ScopedContext(const ScopedContext&) = delete;
+            ScopedContext& operator=(const ScopedContext&) = delete;
+
+        private:
+            Context previous;
+    };
+}
\ No newline at end of file
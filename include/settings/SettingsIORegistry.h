@@ -5,6 +5,8 @@
 #include <string>
 #include <vector>
 #include <memory>
+#include <concepts>
+#include <type_traits>
 
 namespace settings {
     namespace io {
@@ -22,12 +24,24 @@ namespace settings {
             static std::vector<SettingSection> sections;
         };
 
-        template<typename T> std::unique_ptr<detail::SettingRef<T>> create(T& setting, const std::string& name) {
-            return std::make_unique<detail::SettingRef<T>>(setting, std::vector<std::string>({name}));
+        /**
+         * @brief Register a setting shared by the entire process. 
+         */
+        template<typename T> requires (!std::invocable<T&>) std::unique_ptr<detail::SettingRef<T>> create(T& setting, const std::string& name) {
+            return std::make_unique<detail::SettingRef<T>>([&setting] () -> T& {return setting;}, std::vector<std::string>({name}));
+        }
+
+        template<typename T> requires (!std::invocable<T&>) std::unique_ptr<detail::SettingRef<T>> create(T& setting, const std::initializer_list<std::string>& names) {
+            return std::make_unique<detail::SettingRef<T>>([&setting] () -> T& {return setting;}, names);
         }
 
-        template<typename T> std::unique_ptr<detail::SettingRef<T>> create(T& setting, const std::initializer_list<std::string>& names) {
-            return std::make_unique<detail::SettingRef<T>>(setting, names);
+        /**
+         * @brief Register a setting through a function returning a reference to it. 
+         *        This must be used for thread-local settings, since a plain reference is bound once and would always refer to the value of the registering thread. 
+         */
+        template<std::invocable F> auto create(F&& setting, const std::string& name) {
+            using T = std::remove_reference_t<std::invoke_result_t<F>>;
+            return std::make_unique<detail::SettingRef<T>>(std::forward<F>(setting), std::vector<std::string>({name}));
         }
     }
 }
\ No newline at end of file
@@ -94,11 +94,12 @@
         };
     }
 #else
-    #include <table/VectorDebyeTable.h>
+    #include <table/MappedDebyeTable.h>
     namespace table {
         /**
-         * @brief Your compiler does not support large constexpr arrays, so ArrayDebyeTable is just an alias for VectorDebyeTable.
+         * @brief Your compiler does not support large constexpr arrays, so the default table is calculated at runtime instead.
+         *        It is shared between processes through the table store if settings::general::table_store is set.
          */
-        using ArrayDebyeTable = VectorDebyeTable;
+        using ArrayDebyeTable = MappedDebyeTable;
     }
 #endif
\ No newline at end of file
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <table/DebyeTable.h>
+#include <table/TableStore.h>
+
+#include <vector>
+#include <memory>
+
+namespace table {
+    /**
+     * @brief A read-only sinc(x) lookup table backed by a segment of the table store.
+     *        If the table store is enabled, the default table is only calculated by the first process, and its memory is shared by all processes on the same node.
+     */
+    class MappedDebyeTable : public DebyeTable {
+        public:
+            /**
+             * @brief Create a table from a segment containing @a size_q rows of @a size_d values.
+             */
+            MappedDebyeTable(std::shared_ptr<const store::Segment> segment, std::size_t size_q, std::size_t size_d);
+
+            ~MappedDebyeTable() override;
+
+            /**
+             * @brief Look up a value in the table based on indices. This is a constant-time operation.
+             */
+            [[nodiscard]] double lookup(unsigned int q_index, unsigned int d_index) const override;
+
+            /**
+             * @brief Get the size of the table in the q-direction.
+             */
+            [[nodiscard]] std::size_t size_q() const noexcept override;
+
+            /**
+             * @brief Get the size of the table in the d-direction.
+             */
+            [[nodiscard]] std::size_t size_d() const noexcept override;
+
+            /**
+             * @brief Get an iterator to the beginning of the d-values for the given q-index.
+             */
+            [[nodiscard]] const constants::axes::d_type* begin(unsigned int q_index) const override;
+
+            /**
+             * @brief Get an iterator to the end of the d-values for the given q-index.
+             */
+            [[nodiscard]] const constants::axes::d_type* end(unsigned int q_index) const override;
+
+            /**
+             * @brief Get the default table for the default q and d axes defined in the constants namespace.
+             */
+            [[nodiscard]] static const MappedDebyeTable& get_default_table();
+
+            /**
+             * @brief Check if the two vectors are compatible with the default table.
+             *        Note that this check is only performed in debug mode.
+             */
+            static void check_default(const std::vector<double>& q, const std::vector<constants::axes::d_type>& d);
+
+            /**
+             * @brief Check if the vector is compatible with the default table.
+             *        Note that this check is only performed in debug mode.
+             */
+            static void check_default(const std::vector<constants::axes::d_type>& d);
+
+        private:
+            std::shared_ptr<const store::Segment> segment;
+            std::size_t N, M; // The number of q and d values.
+    };
+}
\ No newline at end of file
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <string>
+#include <memory>
+#include <vector>
+#include <functional>
+
+#include <utility/Memory.h>
+
+namespace table::store {
+    /**
+     * @brief The version of the file format of the table store. Stored tables with a different version are rebuilt.
+     */
+    inline constexpr unsigned int version = 1;
+
+    /**
+     * @brief A read-only block of doubles.
+     *        It is either mapped from a file of the table store, in which case its memory is shared by all processes mapping the same file,
+     *        or owned privately by this process if the store is disabled or unavailable.
+     */
+    class Segment {
+        public:
+            /**
+             * @brief Create a private segment.
+             */
+            Segment(std::vector<double>&& data);
+
+            /**
+             * @brief Create a segment from a read-only mapping of a file. The mapping is released when the segment is destroyed.
+             *
+             * @param mapping The start of the mapping.
+             * @param bytes The size of the mapping.
+             * @param offset The offset of the first table element in the mapping.
+             * @param size The number of table elements.
+             */
+            Segment(void* mapping, std::size_t bytes, std::size_t offset, std::size_t size);
+
+            ~Segment();
+
+            Segment(const Segment&) = delete;
+            Segment& operator=(const Segment&) = delete;
+
+            [[nodiscard]] const double* data() const noexcept;
+
+            [[nodiscard]] std::size_t size() const noexcept;
+
+            /**
+             * @brief Check if this segment is shared with other processes.
+             */
+            [[nodiscard]] bool is_shared() const noexcept;
+
+        private:
+            std::vector<double> owned;
+            void* mapping = nullptr;
+            std::size_t bytes = 0;
+            const double* begin;
+            std::size_t count;
+            utility::memory::Account account{utility::memory::Subsystem::Table}; // shared segments are accounted for in every process mapping them
+    };
+
+    /**
+     * @brief Get a table from the store in settings::general::table_store, or calculate and store it if it does not exist yet.
+     *        The first process to request a table calculates it, and all later processes map the stored file read-only.
+     *        A stored table is only reused if its version, name and size all match; otherwise it is recalculated and replaced.
+     *        If the store is disabled or cannot be used, the table is calculated privately instead.
+     *
+     * @param name The unique name of the table. Must change whenever its contents change, e.g. by including the axes it was calculated for.
+     * @param size The number of elements of the table.
+     * @param fill Calculate the contents of the table. It is given a pointer to @a size elements.
+     */
+    [[nodiscard]] std::shared_ptr<const Segment> get(const std::string& name, std::size_t size, const std::function<void(double*)>& fill);
+}
\ No newline at end of file
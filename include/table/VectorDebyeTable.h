@@ -3,6 +3,7 @@
 #include <table/Table.h>
 #include <table/DebyeTable.h>
 #include <utility/Concepts.h>
+#include <utility/Memory.h>
 
 namespace table {
     class VectorDebyeTable : public DebyeTable, private Table {
@@ -92,5 +93,7 @@ namespace table {
              * @brief Check if a DebyeTable is empty.
              */
             bool is_empty() const;
+
+            utility::memory::Account account{utility::memory::Subsystem::Table};
     };
 }
\ No newline at end of file
@@ -57,4 +57,7 @@ namespace except {
 
     // Not implemented. Used when a method is not implemented yet.
     struct not_implemented : public base {using base::base;};
+
+    // Cancelled. Used to stop a job which was cancelled by its owner. 
+    struct cancelled : public base {using base::base;};
 }
\ No newline at end of file
@@ -0,0 +1,194 @@
+#pragma once
+
+#include <settings/SettingsContext.h>
+
+#include <string>
+#include <memory>
+#include <atomic>
+#include <thread>
+#include <future>
+#include <functional>
+#include <type_traits>
+
+namespace utility::job {
+    /**
+     * @brief The progress of a single stage of a job.
+     */
+    struct Progress {
+        std::string stage;  // The name of the stage currently running.
+        unsigned int step;  // The number of finished steps of the stage.
+        unsigned int total; // The total number of steps of the stage, or 0 if unknown.
+    };
+
+    /**
+     * @brief The state shared between a job and its owner, through which the job is cancelled and reports its progress.
+     *        Long-running calculations check the token bound to their thread at regular intervals, and stop by throwing except::cancelled.
+     */
+    class Token {
+        public:
+            Token() = default;
+
+            /**
+             * @param on_progress Called whenever the job reports its progress. Note that this may be called from any thread running parts of the job.
+             */
+            Token(std::function<void(const Progress&)> on_progress);
+
+            /**
+             * @brief Request the job to stop. The job stops at its next cancellation check.
+             */
+            void cancel() noexcept;
+
+            [[nodiscard]] bool is_cancelled() const noexcept;
+
+            /**
+             * @brief Report the progress of the job to its owner.
+             */
+            void report(const Progress& progress) const;
+
+        private:
+            std::atomic<bool> cancelled = false;
+            std::function<void(const Progress&)> on_progress;
+    };
+
+    /**
+     * @brief Get the token bound to the calling thread, or nullptr if the thread is not running a job.
+     */
+    [[nodiscard]] std::shared_ptr<Token> get_token() noexcept;
+
+    /**
+     * @brief Bind a token to the calling thread for the lifetime of this object. The previous token is restored afterwards.
+     */
+    class ScopedToken {
+        public:
+            ScopedToken(std::shared_ptr<Token> token) noexcept;
+            ~ScopedToken();
+
+            ScopedToken(const ScopedToken&) = delete;
+            ScopedToken& operator=(const ScopedToken&) = delete;
+
+        private:
+            std::shared_ptr<Token> previous;
+    };
+
+    /**
+     * @brief Check if the job running on the calling thread has been cancelled.
+     */
+    [[nodiscard]] bool is_cancelled() noexcept;
+
+    /**
+     * @brief Throw except::cancelled if the job running on the calling thread has been cancelled.
+     */
+    void check_cancelled();
+
+    /**
+     * @brief Report the progress of the job running on the calling thread. Does nothing if the thread is not running a job.
+     *
+     * @param stage The name of the current stage.
+     * @param step The number of finished steps of the stage.
+     * @param total The total number of steps of the stage, or 0 if unknown.
+     */
+    void report_progress(const std::string& stage, unsigned int step, unsigned int total = 0);
+
+    /**
+     * @brief A handle to a job running asynchronously on its own thread.
+     *        Destroying or reassigning the handle cancels the job and waits for it to stop, such that stale work is dropped as soon as it is replaced.
+     */
+    template<typename T>
+    class Job {
+        public:
+            Job() = default;
+
+            /**
+             * @brief Create a handle from its parts. Use utility::job::run instead.
+             */
+            Job(std::shared_ptr<Token> token, std::future<T>&& result, std::thread&& thread) noexcept
+                : token(std::move(token)), result(std::move(result)), thread(std::move(thread))
+            {}
+
+            Job(Job&& other) noexcept = default;
+
+            Job& operator=(Job&& other) noexcept {
+                if (this == &other) {return *this;}
+                stop();
+                token = std::move(other.token);
+                result = std::move(other.result);
+                thread = std::move(other.thread);
+                return *this;
+            }
+
+            ~Job() {stop();}
+
+            /**
+             * @brief Request the job to stop. This does not wait for it.
+             */
+            void cancel() noexcept {if (token) {token->cancel();}}
+
+            /**
+             * @brief Check if this handle refers to a job.
+             */
+            [[nodiscard]] bool valid() const noexcept {return result.valid();}
+
+            /**
+             * @brief Check if the job has finished, either by completing, failing, or being cancelled.
+             */
+            [[nodiscard]] bool is_done() const {
+                return result.valid() && result.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+            }
+
+            /**
+             * @brief Wait for the job to finish.
+             */
+            void wait() const {result.wait();}
+
+            /**
+             * @brief Wait for the job to finish and get its result.
+             *        Any exception thrown by the job is rethrown, including except::cancelled if it was cancelled.
+             *        This can only be called once.
+             */
+            T get() {
+                result.wait();
+                if (thread.joinable()) {thread.join();}
+                return result.get();
+            }
+
+        private:
+            std::shared_ptr<Token> token;
+            std::future<T> result;
+            std::thread thread;
+
+            void stop() noexcept {
+                cancel();
+                if (thread.joinable()) {thread.join();}
+            }
+    };
+
+    /**
+     * @brief Run a function asynchronously as a cancellable job on a new thread.
+     *        The job runs with the settings context of the calling thread, and its token is also bound to all tasks it submits through a TaskGroup.
+     *
+     * @param f The function to run.
+     * @param on_progress Called whenever the job reports its progress. Note that this may be called from any thread running parts of the job.
+     */
+    template<typename F>
+    [[nodiscard]] Job<std::invoke_result_t<std::decay_t<F>>> run(F&& f, std::function<void(const Progress&)> on_progress = {}) {
+        using T = std::invoke_result_t<std::decay_t<F>>;
+        auto token = std::make_shared<Token>(std::move(on_progress));
+        std::promise<T> promise;
+        auto result = promise.get_future();
+        std::thread thread([f = std::forward<F>(f), token, promise = std::move(promise), context = settings::Context()] () mutable {
+            settings::ScopedContext scope(context);
+            ScopedToken bind(token);
+            try {
+                if constexpr (std::is_void_v<T>) {
+                    f();
+                    promise.set_value();
+                } else {
+                    promise.set_value(f());
+                }
+            } catch (...) {
+                promise.set_exception(std::current_exception());
+            }
+        });
+        return Job<T>(std::move(token), std::move(result), std::move(thread));
+    }
+}
\ No newline at end of file
@@ -0,0 +1,121 @@
+#pragma once
+
+#include <string>
+#include <cstddef>
+#include <ranges>
+#include <vector>
+#include <initializer_list>
+
+namespace utility::memory {
+    /**
+     * @brief The subsystems whose memory usage is accounted for.
+     */
+    enum class Subsystem {
+        Histogram,  // Thread-local scratch copies of the distance histograms.
+        Grid,       // The volumes of the hydration grids.
+        Molecule,   // The atoms and waters of the molecules and their bodies.
+        EM,         // The layers of the EM image stacks.
+        Table,      // The lookup tables.
+        count
+    };
+
+    /**
+     * @brief The current and peak number of bytes of a subsystem.
+     */
+    struct Usage {
+        std::size_t current, peak;
+    };
+
+    /**
+     * @brief An accounting handle for a block of memory owned by a subsystem.
+     *        The bytes are registered on construction and released on destruction, so the handle is meant to be a member of the object owning the memory.
+     *        Copying the handle registers the bytes again, since copying the owner also copies its memory.
+     */
+    class Account {
+        public:
+            Account(Subsystem subsystem, std::size_t bytes = 0) noexcept;
+            Account(const Account& other) noexcept;
+            Account(Account&& other) noexcept;
+            Account& operator=(const Account& other) noexcept;
+            Account& operator=(Account&& other) noexcept;
+            ~Account();
+
+            /**
+             * @brief Change the number of bytes accounted for by this handle.
+             */
+            void set(std::size_t bytes) noexcept;
+
+            [[nodiscard]] std::size_t get() const noexcept;
+
+            /**
+             * @brief Accounting handles never affect the equality of their owners.
+             */
+            friend bool operator==(const Account&, const Account&) noexcept {return true;}
+
+        private:
+            Subsystem subsystem;
+            std::size_t bytes = 0;
+    };
+
+    /**
+     * @brief Get the number of bytes used by the elements of a container.
+     */
+    template<std::ranges::sized_range T>
+    std::size_t size_of(const T& container) {
+        return std::ranges::size(container)*sizeof(std::ranges::range_value_t<T>);
+    }
+
+    /**
+     * @brief Get the current and peak usage of a single subsystem.
+     */
+    [[nodiscard]] Usage get_usage(Subsystem subsystem) noexcept;
+
+    /**
+     * @brief Get the current and peak usage of all subsystems combined.
+     */
+    [[nodiscard]] Usage get_total_usage() noexcept;
+
+    /**
+     * @brief Reset the peak usage of all subsystems to their current usage.
+     */
+    void reset_peak() noexcept;
+
+    /**
+     * @brief Get a summary of the current and peak usage of all subsystems.
+     */
+    [[nodiscard]] std::string summary();
+
+    /**
+     * @brief Print the summary if verbose output is enabled.
+     */
+    void print_summary();
+
+    /**
+     * @brief Get the number of bytes which can still be allocated within settings::general::memory_budget.
+     *        Returns the maximum size_t value if no budget is set.
+     */
+    [[nodiscard]] std::size_t get_remaining_budget() noexcept;
+
+    /**
+     * @brief A loop of @a n iterations which is split into jobs, where each job may create a thread-local copy of @a bytes_per_copy.
+     */
+    struct Loop {
+        int n;
+        std::size_t bytes_per_copy;
+    };
+
+    /**
+     * @brief Get the job sizes of loops which run at the same time, and therefore share the remaining memory budget.
+     *        Without a memory budget these are just settings::general::detail::job_size. Otherwise the job sizes are increased such that the copies of all jobs of all loops fit in the remaining budget,
+     *        at the cost of less parallelism.
+     *
+     *        The budget is a soft limit: each loop always gets at least one job, and memory allocated outside the accounted subsystems is not seen.
+     */
+    [[nodiscard]] std::vector<int> job_sizes(std::initializer_list<Loop> loops);
+
+    /**
+     * @brief Get the job size of a single loop of @a n iterations, where each job may create a thread-local copy of @a bytes_per_copy.
+     *        Loops running at the same time as other budgeted loops should use job_sizes instead.
+     */
+    [[nodiscard]] int job_size(int n, std::size_t bytes_per_copy);
+}
\ No newline at end of file
@@ -1,13 +1,13 @@
 #pragma once
 
 #include <utility/observer_ptr.h>
-
-#include <BS_thread_pool.hpp>
+#include <utility/TaskScheduler.h>
 
 namespace utility::multi_threading {
     /**
-     * @brief Get the global thread pool.
-     *        This pool is initialized upon first call, so make sure to set the number of threads (settings::general::threads) before calling this function.
+     * @brief Get the global task scheduler.
+     *        The scheduler is initialized upon first call, so make sure to set the number of threads (settings::general::threads) 
+     *        and settings::general::pin_threads before calling this function.
      */
-    observer_ptr<BS::thread_pool> get_global_pool();
+    observer_ptr<TaskScheduler> get_global_scheduler();
 }
\ No newline at end of file
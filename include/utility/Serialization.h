@@ -0,0 +1,66 @@
+#pragma once
+
+#include <utility/Exceptions.h>
+
+#include <istream>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <type_traits>
+
+/**
+ * @brief Small helpers for writing and reading the raw binary checkpoint files.
+ *        The format is native-endian and only intended to be read back by the same build.
+ */
+namespace utility::serialization {
+    template<typename T> requires std::is_trivially_copyable_v<T>
+    void write(std::ostream& out, const T& val) {
+        out.write(reinterpret_cast<const char*>(&val), sizeof(T));
+    }
+
+    template<typename T> requires std::is_trivially_copyable_v<T>
+    void read(std::istream& in, T& val) {
+        in.read(reinterpret_cast<char*>(&val), sizeof(T));
+        if (!in) {throw except::io_error("serialization::read: Unexpected end of stream.");}
+    }
+
+    template<typename T> requires std::is_trivially_copyable_v<T>
+    void write(std::ostream& out, const std::vector<T>& val) {
+        write(out, val.size());
+        out.write(reinterpret_cast<const char*>(val.data()), val.size()*sizeof(T));
+    }
+
+    template<typename T> requires std::is_trivially_copyable_v<T>
+    void read(std::istream& in, std::vector<T>& val) {
+        std::size_t size;
+        read(in, size);
+        val.resize(size);
+        in.read(reinterpret_cast<char*>(val.data()), size*sizeof(T));
+        if (!in) {throw except::io_error("serialization::read: Unexpected end of stream.");}
+    }
+
+    /**
+     * @brief Write the state of a standard random number engine.
+     *        The engines only define a textual representation, so it is stored as a length-prefixed string.
+     */
+    template<typename Engine>
+    void write_engine(std::ostream& out, const Engine& engine) {
+        std::ostringstream ss;
+        ss << engine;
+        std::string state = ss.str();
+        write(out, state.size());
+        out.write(state.data(), state.size());
+    }
+
+    template<typename Engine>
+    void read_engine(std::istream& in, Engine& engine) {
+        std::size_t size;
+        read(in, size);
+        std::string state(size, ' ');
+        in.read(state.data(), size);
+        if (!in) {throw except::io_error("serialization::read_engine: Unexpected end of stream.");}
+        std::istringstream ss(state);
+        ss >> engine;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,222 @@
+#pragma once
+
+#include <utility/observer_ptr.h>
+#include <settings/SettingsContext.h>
+#include <utility/Trace.h>
+#include <utility/Job.h>
+
+#include <vector>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <atomic>
+#include <functional>
+#include <exception>
+#include <condition_variable>
+
+namespace utility::multi_threading {
+    /**
+     * @brief A work-stealing task scheduler.
+     *
+     * Each worker thread has its own task deque. Tasks submitted from a worker are pushed to the back of its own deque,
+     * and tasks submitted from any other thread are distributed round-robin between the workers.
+     * A worker takes tasks from the back of its own deque, and when it runs dry it steals from the front of the other deques,
+     * trying the workers on its own NUMA node first. Idle workers sleep until new tasks are submitted.
+     *
+     * Tasks are normally submitted through a TaskGroup, which can be waited on independently of all other tasks.
+     */
+    class TaskScheduler {
+        private:
+            struct Slot;
+
+        public:
+            using Task = std::function<void()>;
+
+            /**
+             * @brief The queued tasks of a group. 
+             *        A task submitted with a group is queued both in a worker deque and in its group, and is taken from whichever is reached first. 
+             *        This allows a waiting worker to find the tasks of its group without scanning the deques of all workers.
+             */
+            class Group {
+                public:
+                    Group();
+                    ~Group();
+
+                private:
+                    friend class TaskScheduler;
+                    std::mutex mutex;
+                    std::deque<std::shared_ptr<Slot>> tasks; // May also contain tasks which were already taken from a deque.
+            };
+
+            /**
+             * @brief Start the worker threads.
+             *
+             * @param threads The number of worker threads. If zero, the number of hardware threads is used.
+             * @param pin Whether to pin each worker to a single core. The cores are assigned node by node, so neighbouring workers share a NUMA node.
+             *            Pinning is only supported on Linux, and is ignored elsewhere.
+             */
+            TaskScheduler(unsigned int threads, bool pin = false);
+
+            /**
+             * @brief Finish all queued tasks and stop the worker threads.
+             */
+            ~TaskScheduler();
+
+            /**
+             * @brief Queue a task for execution.
+             *
+             * @param group The optional group the task belongs to. This allows a waiting worker to only execute the tasks of the group it is waiting on.
+             *              The group must outlive the task.
+             */
+            void submit(Task&& task, Group* group = nullptr);
+
+            /**
+             * @brief Execute a single queued task on the calling thread.
+             *        This is only done if the calling thread is a worker of this scheduler, since tasks may rely on running on a worker thread.
+             *
+             * @return True if a task was executed.
+             */
+            bool try_run_task();
+
+            /**
+             * @brief Execute a single queued task of the given group on the calling thread. 
+             *        This is only done if the calling thread is a worker of this scheduler, since tasks may rely on running on a worker thread.
+             *
+             * @return True if a task was executed.
+             */
+            bool try_run_task(Group& group);
+
+            /**
+             * @brief Check if the calling thread is a worker of this scheduler.
+             */
+            [[nodiscard]] bool is_worker() const noexcept;
+
+            /**
+             * @brief Get the number of worker threads.
+             */
+            [[nodiscard]] unsigned int get_thread_count() const noexcept;
+
+            /**
+             * @brief Get the ids of all worker threads.
+             */
+            [[nodiscard]] std::vector<std::thread::id> get_thread_ids() const;
+
+        private:
+            /**
+             * @brief A task shared between a worker deque and a group. It is only executed by the thread which claims it first.
+             */
+            struct Slot {
+                Task task;
+                std::atomic<bool> taken = false;
+            };
+
+            /**
+             * @brief An entry of a worker deque. Tasks without a group are stored directly, while grouped tasks are stored in a slot.
+             */
+            struct Entry {
+                Task task;
+                std::shared_ptr<Slot> slot;
+            };
+
+            struct Worker {
+                std::mutex mutex;
+                std::deque<Entry> tasks;
+                std::vector<unsigned int> victims;  // The other workers in the order they are stolen from.
+                std::thread thread;
+            };
+            std::vector<std::unique_ptr<Worker>> workers;
+
+            std::atomic<unsigned int> queued = 0;   // The number of tasks in all deques.
+            std::atomic<unsigned int> sleeping = 0; // The number of sleeping workers.
+            std::atomic<unsigned int> next = 0;     // The next worker to receive an external task.
+            std::mutex sleep_mutex;
+            std::condition_variable sleep_cv;
+            bool stop = false;
+
+            void run(unsigned int index);
+
+            bool pop(unsigned int index, Task& task);
+
+            bool pop(Task& task, Group& group);
+
+            static bool claim(Entry& entry, Task& task);
+    };
+
+    /**
+     * @brief A group of tasks which can be waited on as a whole.
+     *
+     * Groups are independent of each other, so any number of threads can use their own groups on the same scheduler at the same time.
+     * When a worker thread waits on a group, it executes the queued tasks of that group in the meantime, so groups can be nested inside tasks.
+     * Tasks of other groups are never picked up while waiting, since they could delay the return by an arbitrary amount. Once no task of the group is queued
+     * anymore, the remaining ones are all running on other threads, and the waiting thread sleeps until they are done.
+     * Each task runs with the settings context and job token of the thread which queued it, and any exception thrown by a task is rethrown by wait().
+     * Tasks queued after their job was cancelled are skipped, such that wait() returns quickly and throws except::cancelled.
+     */
+    class TaskGroup {
+        public:
+            /**
+             * @brief Create a group on the global scheduler.
+             */
+            TaskGroup();
+
+            TaskGroup(observer_ptr<TaskScheduler> scheduler);
+
+            /**
+             * @brief Wait for all tasks to finish. Any exceptions are discarded.
+             */
+            ~TaskGroup();
+
+            /**
+             * @brief Queue a task in this group.
+             *        The task runs with the current settings context and job token of the calling thread.
+             */
+            template<typename F>
+            void run(F&& f) {
+                pending.fetch_add(1);
+                queued.fetch_add(1);
+                scheduler->submit([this, f = std::forward<F>(f), context = settings::Context(), token = utility::job::get_token()] () mutable {
+                    queued.fetch_sub(1);
+                    try {
+                        TRACE_ZONE("task");
+                        settings::ScopedContext scope(context);
+                        utility::job::ScopedToken bind(std::move(token));
+                        utility::job::check_cancelled();
+                        f();
+                    } catch (...) {
+                        std::lock_guard lock(mutex);
+                        if (!error) {error = std::current_exception();}
+                    }
+                    finish();
+                }, &group);
+
+                // wake up a worker waiting on this group, such that it can help with the new task
+                if (waiting.load() != 0) {
+                    std::lock_guard lock(mutex);
+                    cv.notify_all();
+                }
+            }
+
+            /**
+             * @brief Wait for all tasks in this group to finish, and rethrow the first exception thrown by any of them.
+             */
+            void wait();
+
+            /**
+             * @brief Get the scheduler of this group.
+             */
+            [[nodiscard]] observer_ptr<TaskScheduler> get_scheduler() const noexcept;
+
+        private:
+            observer_ptr<TaskScheduler> scheduler;
+            TaskScheduler::Group group;            // The queued tasks of this group.
+            std::atomic<unsigned int> pending = 0; // The number of unfinished tasks.
+            std::atomic<unsigned int> queued = 0;  // The number of tasks which have not started yet.
+            std::atomic<unsigned int> waiting = 0; // The number of worker threads waiting on this group.
+            std::mutex mutex;
+            std::condition_variable cv;
+            std::exception_ptr error;
+
+            void finish();
+    };
+}
\ No newline at end of file
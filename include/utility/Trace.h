@@ -0,0 +1,69 @@
+#pragma once
+
+#include <string>
+#include <chrono>
+#include <cstdint>
+
+namespace utility::trace {
+    constexpr unsigned int buffer_capacity = 1 << 16; // The number of zones kept for each thread.
+
+    /**
+     * @brief Start recording all trace zones, and save the trace to the given path when the program exits.
+     *        The trace is saved in the Chrome trace event format, which can be opened in Perfetto or chrome://tracing.
+     *        The TRACE_ZONE macros only create zones if the library was compiled with the TRACE option.
+     */
+    void start(const std::string& path);
+
+    /**
+     * @brief Stop recording, and save all recorded zones in the Chrome trace event format.
+     *        Zones which are still open on other threads are waited for briefly. 
+     *        Threads which do not leave their zones in time, such as detached threads busy with a long calculation, are left out of the trace.
+     */
+    void save(const std::string& path);
+
+    /**
+     * @brief Check if zones are currently being recorded.
+     */
+    [[nodiscard]] bool is_enabled() noexcept;
+
+    /**
+     * @brief A scoped trace zone. The time between its construction and destruction is recorded in the buffer of the calling thread.
+     *        Each thread has its own fixed-size ring buffer, so recording never blocks, and only the most recent zones are kept.
+     *        Use the TRACE_ZONE macro instead of creating zones directly, such that they are removed when tracing is disabled at compile time.
+     */
+    class Zone {
+        public:
+            /**
+             * @param name The name of the zone. Must be a string literal, since only the pointer is stored.
+             */
+            Zone(const char* name) noexcept : name(enter() ? name : nullptr) {
+                if (this->name) {begin = now();}
+            }
+
+            ~Zone() {
+                if (name) {record(name, begin, now());}
+            }
+
+            Zone(const Zone&) = delete;
+            Zone& operator=(const Zone&) = delete;
+
+        private:
+            const char* name;
+            std::int64_t begin;
+
+            static std::int64_t now() noexcept {
+                return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+            }
+
+            static bool enter() noexcept;
+            static void record(const char* name, std::int64_t begin, std::int64_t end) noexcept;
+    };
+}
+
+#define TRACE_CONCAT_DETAIL(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_DETAIL(a, b)
+#if defined(TRACE_ENABLED)
+    #define TRACE_ZONE(name) utility::trace::Zone TRACE_CONCAT(trace_zone_, __LINE__)(name)
+#else
+    #define TRACE_ZONE(name)
+#endif
\ No newline at end of file
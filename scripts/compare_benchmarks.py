@@ -0,0 +1,61 @@
+# Compare the results of the Catch2 benchmarks against a stored baseline.
+# Usage: python3 compare_benchmarks.py <baseline.xml> <results.xml> [--tolerance 0.05]
+# A benchmark is reported as a regression if its mean is more than the tolerance slower than the baseline, and the confidence
+# intervals of the two means do not overlap. The exit code is 1 if any regressions were found.
+import argparse
+import os
+import sys
+import xml.etree.ElementTree as ET
+
+def read(path):
+    """Read the mean and confidence interval of each benchmark in a Catch2 XML report. All values are in nanoseconds."""
+    results = {}
+    for test in ET.parse(path).getroot().iter("TestCase"):
+        for benchmark in test.iter("BenchmarkResults"):
+            mean = benchmark.find("mean")
+            name = test.get("name") + "/" + benchmark.get("name")
+            results[name] = (float(mean.get("value")), float(mean.get("lowerBound")), float(mean.get("upperBound")))
+    return results
+
+def format_time(ns):
+    for unit, scale in [("s", 1e9), ("ms", 1e6), ("us", 1e3)]:
+        if scale <= ns:
+            return f"{ns/scale:.3g} {unit}"
+    return f"{ns:.3g} ns"
+
+parser = argparse.ArgumentParser(description="Compare the results of the Catch2 benchmarks against a stored baseline.")
+parser.add_argument("baseline", help="The Catch2 XML report of the baseline.")
+parser.add_argument("results", help="The Catch2 XML report of the new run.")
+parser.add_argument("--tolerance", type=float, default=0.05, help="The relative slowdown allowed before a benchmark is reported as a regression.")
+args = parser.parse_args()
+
+if not os.path.exists(args.baseline):
+    print(f"No baseline found at \"{args.baseline}\". Store the current results as the baseline with the benchmark_baseline target.")
+    sys.exit(0)
+
+baseline = read(args.baseline)
+results = read(args.results)
+width = max([len(name) for name in results] + [9])
+print(f"{'benchmark':<{width}}  {'baseline':>10}  {'current':>10}  {'change':>8}")
+
+regressions = []
+for name, (mean, lower, upper) in results.items():
+    if name not in baseline:
+        print(f"{name:<{width}}  {'-':>10}  {format_time(mean):>10}  {'new':>8}")
+        continue
+    base_mean, base_lower, base_upper = baseline[name]
+    change = mean/base_mean - 1
+    status = ""
+    if args.tolerance < change and base_upper < lower:
+        status = "  REGRESSION"
+        regressions.append(name)
+    elif change < -args.tolerance and upper < base_lower:
+        status = "  improved"
+    print(f"{name:<{width}}  {format_time(base_mean):>10}  {format_time(mean):>10}  {100*change:>+7.1f}%{status}")
+
+for name in baseline.keys() - results.keys():
+    print(f"{name:<{width}}  {format_time(baseline[name][0]):>10}  {'-':>10}  {'removed':>8}")
+
+if regressions:
+    print(f"\n{len(regressions)} benchmark(s) regressed by more than {100*args.tolerance:.0f}%.")
+    sys.exit(1)
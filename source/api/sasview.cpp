@@ -6,67 +6,136 @@ For more information, please refer to the LICENSE file in the project root.
 #include <api/sasview.h>
 
 #include <settings/All.h>
-#include <dataset/Dataset.h>
-#include <dataset/SimpleDataset.h>
 #include <data/record/Atom.h>
+#include <data/Body.h>
 #include <data/Molecule.h>
-#include <hist/intensity_calculator/CompositeDistanceHistogram.h>
-#include <utility/Utility.h>
-#include <utility/MultiThreading.h>
+#include <hist/intensity_calculator/ICompositeDistanceHistogram.h>
+#include <table/VectorDebyeTable.h>
+
+#include <vector>
+#include <memory>
+#include <numeric>
+#include <algorithm>
 
 using namespace data;
 using namespace data::record;
 
-void evaluate_sans_debye(double* _q, double* _x, double* _y, double* _z, double* _w, int _nq, int _nc, int* _return_status, double* _return_Iq) {
-    // default state is error since we don't trust the input enough to assume success
-    *_return_status = 1;
-
-    // use the multithreaded version of the simple histogram manager
-    settings::hist::histogram_manager = settings::hist::HistogramManagerChoice::HistogramManagerMT;
-
-    // do not subtract the solvent charge from the atoms
-    settings::molecule::use_effective_charge = false;
+namespace {
+    /**
+     * @brief Get the settings used by all SasView models. The settings of the calling thread are left untouched.
+     */
+    settings::Context sasview_context() {
+        settings::ScopedContext restore{settings::Context()};
 
-    // do not subtract the charge of bound hydrogens
-    settings::molecule::implicit_hydrogens = false;
+        // use the multithreaded version of the simple histogram manager
+        settings::hist::histogram_manager = settings::hist::HistogramManagerChoice::HistogramManagerMT;
 
-    // use weighted bins for the histogram approach - this dramatically improves the accuracy
-    settings::hist::weighted_bins = true;
+        // do not subtract the solvent charge from the atoms
+        settings::molecule::use_effective_charge = false;
 
-    // set qmax as high as it can go. Values beyond this are suppoted, but will recalculate the sinc(x) lookup table at runtime
-    settings::axes::qmax = 1;
+        // do not subtract the charge of bound hydrogens
+        settings::molecule::implicit_hydrogens = false;
 
-    // convert C input to C++
-    std::vector<double> q(_q, _q+_nq);
-    std::vector<double> x(_x, _x+_nc);
-    std::vector<double> y(_y, _y+_nc);
-    std::vector<double> z(_z, _z+_nc);
-    std::vector<double> w(_w, _w+_nc);
+        // use weighted bins for the histogram approach - this dramatically improves the accuracy
+        settings::hist::weighted_bins = true;
 
-    // convert coordinate input to the Atom object
-    std::vector<Atom> atoms(_nc);
-    for (int i = 0; i < _nc; ++i) {
-        atoms[i] = Atom({x[i], y[i], z[i]}, w[i], constants::atom_t::dummy, "", i);
+        // set qmax as high as it can go. Values beyond this are supported, but will recalculate the sinc(x) lookup table at runtime
+        settings::axes::qmax = 1;
+        return settings::Context();
     }
+}
 
-    // construct a protein from the collection of atom
-    Molecule protein(atoms);
+struct sasview_model {
+    sasview_model(const settings::Context& context, const std::vector<Atom>& atoms) : context(context), protein(atoms) {}
 
-    // calculate the distance histogram for the protein
-    auto dist = protein.get_histogram();
+    settings::Context context;      // The settings of this model. They are applied to the calling thread for the duration of each call.
+    Molecule protein;               // The scatterers of this model.
+    std::unique_ptr<hist::ICompositeDistanceHistogram> histogram; // The cached histogram. Reset whenever the scatterers are changed.
+    std::vector<double> q, d;       // The axes of the cached sinc table.
+    std::unique_ptr<table::VectorDebyeTable> sinc_table; // The cached sinc table.
+};
 
-    // perform the Debye transform
-    auto Iq = dist->debye_transform(q);
+sasview_model* create_sans_model(const double* _x, const double* _y, const double* _z, const double* _w, int _nc, int* _return_status) {
+    // default state is error since we don't trust the input enough to assume success
+    *_return_status = 1;
+    if (_nc < 0) {return nullptr;}
+
+    try {
+        auto context = sasview_context();
+        settings::ScopedContext scope(context);
+
+        // convert coordinate input to the Atom object
+        std::vector<Atom> atoms(_nc);
+        for (int i = 0; i < _nc; ++i) {
+            atoms[i] = Atom({_x[i], _y[i], _z[i]}, _w[i], constants::atom_t::dummy, "", i);
+        }
+
+        auto model = new sasview_model(context, atoms);
+        *_return_status = 0;
+        return model;
+    } catch (const std::exception&) {
+        return nullptr;
+    }
+}
 
-    // sanity check - the number of q values should match the number of I(q) values
-    if ((int) Iq.size() != _nq) {
-        *_return_status = 2;
+void update_sans_model(sasview_model* _model, const double* _x, const double* _y, const double* _z, const double* _w, int* _return_status) {
+    *_return_status = 1;
+    if (_model == nullptr) {return;}
+
+    try {
+        settings::ScopedContext scope(_model->context);
+
+        // the atoms are updated in place, such that the molecule and its histogram manager can be reused
+        auto& body = _model->protein.get_body(0);
+        auto& atoms = body.get_atoms();
+        bool update_coordinates = _x != nullptr && _y != nullptr && _z != nullptr;
+        for (unsigned int i = 0; i < atoms.size(); ++i) {
+            if (update_coordinates) {atoms[i].set_coordinates({_x[i], _y[i], _z[i]});}
+            if (_w != nullptr) {atoms[i].set_occupancy(_w[i]);}
+        }
+        body.changed_internal_state();
+        _model->histogram.reset();
+        *_return_status = 0;
+    } catch (const std::exception&) {
         return;
     }
+}
 
-    // remove the form factor applied by the debye transform
-    for (unsigned int i = 0; i < Iq.size(); ++i) {
-        _return_Iq[i] =  Iq.y(i) / std::exp(-std::pow(Iq.x(i), 2));
+void evaluate_sans_model(sasview_model* _model, const double* _q, int _nq, double* _return_Iq, int* _return_status) {
+    *_return_status = 1;
+    if (_model == nullptr || _nq < 0) {return;}
+
+    try {
+        settings::ScopedContext scope(_model->context);
+        if (!_model->histogram) {_model->histogram = _model->protein.get_histogram();}
+
+        // the sinc table only has to be recalculated if either of its axes has changed.
+        // with weighted bins, the d-axis depends on the coordinates, but is unaffected by changes of the weights
+        const auto& d = _model->histogram->get_d_axis();
+        if (!_model->sinc_table || d != _model->d || !std::equal(_q, _q+_nq, _model->q.begin(), _model->q.end())) {
+            _model->q.assign(_q, _q+_nq);
+            _model->d = d;
+            _model->sinc_table = std::make_unique<table::VectorDebyeTable>(_model->d, _model->q);
+        }
+
+        // perform the Debye transform directly into the output buffer
+        const auto& p = _model->histogram->get_total_counts();
+        for (int i = 0; i < _nq; ++i) {
+            _return_Iq[i] = std::inner_product(p.begin(), p.end(), _model->sinc_table->begin(i), 0.0);
+        }
+        *_return_status = 0;
+    } catch (const std::exception&) {
+        return;
     }
-    *_return_status = 0;
+}
+
+void destroy_sans_model(sasview_model* _model) {
+    delete _model;
+}
+
+void evaluate_sans_debye(double* _q, double* _x, double* _y, double* _z, double* _w, int _nq, int _nc, int* _return_status, double* _return_Iq) {
+    auto model = create_sans_model(_x, _y, _z, _w, _nc, _return_status);
+    if (*_return_status != 0) {return;}
+    evaluate_sans_model(model, _q, _nq, _return_Iq, _return_status);
+    destroy_sans_model(model);
 }
\ No newline at end of file
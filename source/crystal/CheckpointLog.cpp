@@ -0,0 +1,166 @@
+/*
+This software is distributed under the GNU General Public License v3.0. 
+For more information, please refer to the LICENSE file in the project root.
+*/
+
+#include <crystal/CheckpointLog.h>
+#include <crystal/Fval.h>
+#include <crystal/miller/Miller.h>
+#include <settings/GeneralSettings.h>
+#include <utility/Exceptions.h>
+#include <io/File.h>
+
+#include <filesystem>
+#include <cstring>
+#include <iostream>
+#include <limits>
+
+#if defined(__unix__) || defined(__APPLE__)
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <fcntl.h>
+    #include <unistd.h>
+#endif
+
+using namespace crystal;
+
+static constexpr unsigned int terminate_marker = std::numeric_limits<unsigned int>::max();
+
+CheckpointLog::CheckpointLog(const std::string& file, const std::vector<Miller>& millers, std::vector<Fval>& fvals, unsigned int block_size)
+    : fvals(fvals), block_size(block_size), blocks((fvals.size() + block_size - 1)/block_size), done(blocks, false), slots(blocks+1), ready(blocks+1)
+{
+    if (millers.size() != fvals.size()) {throw except::invalid_argument("CheckpointLog::CheckpointLog: The number of Miller indices and F values must be equal.");}
+    if (block_size == 0) {throw except::invalid_argument("CheckpointLog::CheckpointLog: The block size must be positive.");}
+
+    // discard any partially written record at the end, and then continue appending to the log
+    std::size_t valid = std::filesystem::exists(file) ? replay(file, millers) : 0;
+    if (valid == 0) {
+        ::io::File(file).create();
+        out.open(file, std::ios::binary | std::ios::trunc);
+        Header header{magic, block_size, fvals.size()};
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    } else {
+        std::filesystem::resize_file(file, valid);
+        out.open(file, std::ios::binary | std::ios::app);
+    }
+    if (!out.is_open()) {throw except::io_error("CheckpointLog::CheckpointLog: Could not open checkpoint file \"" + file + "\".");}
+    out.flush();
+
+    writer = std::jthread([this] () {write();});
+}
+
+CheckpointLog::~CheckpointLog() {
+    close();
+}
+
+std::size_t CheckpointLog::replay(const std::string& file, const std::vector<Miller>& millers) {
+    #if defined(__unix__) || defined(__APPLE__)
+        int fd = ::open(file.c_str(), O_RDONLY);
+        if (fd == -1) {throw except::io_error("CheckpointLog::replay: Could not open checkpoint file \"" + file + "\".");}
+        struct stat st;
+        if (::fstat(fd, &st) == -1 || st.st_size == 0) {
+            ::close(fd);
+            return 0;
+        }
+        std::size_t size = st.st_size;
+        void* data = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);
+        if (data == MAP_FAILED) {throw except::io_error("CheckpointLog::replay: Could not map checkpoint file \"" + file + "\".");}
+        std::size_t valid;
+        try {
+            valid = replay(static_cast<const char*>(data), size, millers);
+        } catch (...) {
+            ::munmap(data, size);
+            throw;
+        }
+        ::munmap(data, size);
+        return valid;
+    #else
+        std::ifstream in(file, std::ios::binary);
+        if (!in.is_open()) {throw except::io_error("CheckpointLog::replay: Could not open checkpoint file \"" + file + "\".");}
+        std::vector<char> data{std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>()};
+        return replay(data.data(), data.size(), millers);
+    #endif
+}
+
+std::size_t CheckpointLog::replay(const char* data, std::size_t size, const std::vector<Miller>& millers) {
+    if (size < sizeof(Header)) {return 0;}
+    Header header;
+    std::memcpy(&header, data, sizeof(header));
+    if (header.magic != magic || header.block_size != block_size || header.size != fvals.size()) {
+        throw except::unexpected("CheckpointLog::replay: incompatible checkpoint file. Did you change the settings?");
+    }
+
+    std::size_t pos = sizeof(Header);
+    unsigned int loaded = 0;
+    while (pos + sizeof(std::uint32_t) <= size) {
+        std::uint32_t block;
+        std::memcpy(&block, data + pos, sizeof(block));
+        if (blocks <= block) {break;}
+
+        auto [begin, end] = block_range(block);
+        std::size_t record_size = sizeof(block) + (end - begin)*sizeof(Record);
+        if (size < pos + record_size) {break;} // the last record was only partially written
+
+        // the Miller indices are stored with the values, so we can check that the log belongs to this calculation
+        const char* records = data + pos + sizeof(block);
+        for (unsigned int i = begin; i < end; ++i) {
+            Record record;
+            std::memcpy(&record, records + (i - begin)*sizeof(Record), sizeof(Record));
+            if (Miller(record.h, record.k, record.l) != millers[i]) {throw except::unexpected("CheckpointLog::replay: incompatible checkpoint file. Did you change the settings?");}
+            fvals[i] = Fval(record.h, record.k, record.l, {record.re, record.im});
+        }
+        loaded += !done[block];
+        done[block] = true;
+        pos += record_size;
+    }
+
+    if (settings::general::verbose) {std::cout << "Loaded " << loaded << " of " << blocks << " blocks from checkpoint file." << std::endl;}
+    return pos;
+}
+
+std::vector<unsigned int> CheckpointLog::remaining_blocks() const {
+    std::vector<unsigned int> remaining;
+    for (unsigned int i = 0; i < blocks; ++i) {
+        if (!done[i]) {remaining.push_back(i);}
+    }
+    return remaining;
+}
+
+std::pair<unsigned int, unsigned int> CheckpointLog::block_range(unsigned int block) const {
+    unsigned int begin = block*block_size;
+    return {begin, std::min<unsigned int>(begin + block_size, fvals.size())};
+}
+
+void CheckpointLog::commit(unsigned int block) {
+    unsigned int pos = tail.fetch_add(1, std::memory_order_relaxed);
+    slots[pos] = block;
+    ready[pos].store(true, std::memory_order_release);
+    ready[pos].notify_one();
+}
+
+void CheckpointLog::close() {
+    if (!writer.joinable()) {return;}
+    commit(terminate_marker);
+    writer.join();
+    out.close();
+}
+
+void CheckpointLog::write() {
+    std::vector<Record> records;
+    for (unsigned int pos = 0; pos < slots.size(); ++pos) {
+        ready[pos].wait(false, std::memory_order_acquire);
+        std::uint32_t block = slots[pos];
+        if (block == terminate_marker) {break;}
+
+        auto [begin, end] = block_range(block);
+        records.resize(end - begin);
+        for (unsigned int i = begin; i < end; ++i) {
+            const auto& f = fvals[i];
+            records[i - begin] = Record{f.hkl.h, f.hkl.k, f.hkl.l, 0, f.fval.real(), f.fval.imag()};
+        }
+        out.write(reinterpret_cast<const char*>(&block), sizeof(block));
+        out.write(reinterpret_cast<const char*>(records.data()), records.size()*sizeof(Record));
+        out.flush();
+    }
+}
\ No newline at end of file
@@ -5,6 +5,9 @@ For more information, please refer to the LICENSE file in the project root.
 
 #include <crystal/CrystalScattering.h>
 #include <crystal/Fval.h>
+#include <crystal/StructureFactorGrid.h>
+#include <crystal/CheckpointLog.h>
+#include <crystal/RotationalAverager.h>
 #include <utility/Exceptions.h>
 #include <crystal/miller/AllMillers.h>
 #include <crystal/miller/FibonacciMillers.h>
@@ -12,6 +15,7 @@ For more information, please refer to the LICENSE file in the project root.
 #include <crystal/io/CrystalReaderFactory.h>
 #include <crystal/miller/MillerGenerationFactory.h>
 #include <crystal/miller/MillerGenerationStrategy.h>
+#include <crystal/miller/MillerSymmetry.h>
 #include <crystal/io/CrystalReader.h>
 #include <settings/CrystalSettings.h>
 #include <settings/GeneralSettings.h>
@@ -21,13 +25,12 @@ For more information, please refer to the LICENSE file in the project root.
 #include <utility/Basis3D.h>
 #include <io/ExistingFile.h>
 #include <constants/Constants.h>
+#include <utility/TaskScheduler.h>
+#include <utility/Memory.h>
 
-#include <atomic>
-#include <thread>
-#include <random>
 #include <fstream>
 #include <csignal>
-#include <mutex>
+#include <numeric>
 
 using namespace crystal;
 
@@ -42,37 +45,14 @@ CrystalScattering::CrystalScattering(const std::string& input) {
     Fval::set_basis(bases);
 }
 
-void CrystalScattering::random_rotation() {
-    std::random_device rd;
-    std::mt19937 gen(rd());
-    std::uniform_real_distribution<> dis(0, 1);
-    double theta = std::acos(2*dis(gen) - 1);
-    double phi = 2*constants::pi*dis(gen);
-    double psi = 2*constants::pi*dis(gen);
-    auto v = Vector3<double>(std::cos(theta)*std::cos(phi), std::sin(theta)*std::cos(phi), std::sin(phi));
-    rotate(v, psi);
-}
-
-void CrystalScattering::rotate(const Vector3<double>& axis, double angle) {
-    auto p = Fval::get_points();
-    for (auto& point : p) {
-        point.rotate(axis, angle);
-    }
-}
-
 SimpleDataset CrystalScattering::rotational_average(unsigned int n) {
-    settings::crystal::detail::use_checkpointing = false;
-    std::vector<SimpleDataset> datasets;
-    for (unsigned int i = 0; i < n; i++) {
-        datasets.push_back(calculate());
-        random_rotation();
-    }
+    if (Fval::get_points().empty()) {throw except::invalid_argument("CrystalScattering::rotational_average: No points were set.");}
+    if (n == 0) {throw except::invalid_argument("CrystalScattering::rotational_average: At least one orientation is required.");}
 
-    SimpleDataset result(datasets[0].x(), std::vector<double>(datasets[0].size_rows()));
-    for (const auto& dataset : datasets) {
-        std::transform(result.y().begin(), result.y().end(), dataset.y().begin(), result.y().begin(), std::plus<>());
-    }
-    return result;
+    // the lattice symmetries do not hold for the individual orientations, so only Friedel pairs are reduced
+    auto millers = MillerSymmetry().reduce(factory::construct_miller_strategy(settings::crystal::miller_generation_strategy)->generate());
+    auto orientations = RotationalAverager::generate_orientations(n, settings::crystal::orientation_strategy);
+    return bin(millers, RotationalAverager(Fval::get_points()).average(millers, orientations));
 }
 
 CrystalScattering::CrystalScattering(const grid::Grid& grid) {
@@ -84,116 +64,96 @@ void CrystalScattering::initialize() {
     miller_strategy = factory::construct_miller_strategy();
 }
 
-std::mutex checkpointMutex;
-void CrystalScattering::save_checkpoint(unsigned int stop, const std::vector<Fval>& fvals) {
-    std::lock_guard<std::mutex> lock(checkpointMutex); // Lock the mutex
-    ::io::File file(settings::general::output + "temp/checkpoint.dat"); 
-    file.create();
-
-    std::ofstream checkpoint_file(file, std::ios::binary);
-    if (!checkpoint_file.is_open()) {throw except::io_error("CrystalScattering::save_checkpoint: Could not open checkpoint file.");}
-
-    // we need to know the current number of calculated points
-    checkpoint_file.write(reinterpret_cast<const char*>(&stop), sizeof(stop));
-
-    // we also save the total size of the fvals vector so we can make a simple consistency check when loading
-    std::size_t fvals_size = fvals.size();
-    checkpoint_file.write(reinterpret_cast<const char*>(&fvals_size), sizeof(fvals_size));
-
-    // finally we write the first 'stop' elements of the fvals vector
-    checkpoint_file.write(reinterpret_cast<const char*>(fvals.data()), stop*sizeof(Fval));
-    checkpoint_file.close();
-}
-
-unsigned int CrystalScattering::load_checkpoint(std::vector<Fval>& fvals) {
-    ::io::File file(settings::general::output + "temp/checkpoint.dat"); 
-
-    std::ifstream checkpoint_file(file, std::ios::binary);
-    if (!checkpoint_file.is_open()) {
-        if (settings::general::verbose) {std::cout << "Could not load any points from checkpoint file.";}
-        return 0;
-    }
-
-    // first we read the number of saved points
-    unsigned int stop = 0;
-    checkpoint_file.read(reinterpret_cast<char*>(&stop), sizeof(stop));
-    if (stop > fvals.size()) {throw except::unexpected("CrystalScattering::load_checkpoint: incompatible checkpoint file. Did you change the settings?.");}
-
-    // then we read the previous size of the fvals vector
-    std::size_t fvals_size = 0;
-    checkpoint_file.read(reinterpret_cast<char*>(&fvals_size), sizeof(fvals_size));
-    if (fvals_size != fvals.size()) {throw except::unexpected("CrystalScattering::load_checkpoint: incompatible checkpoint file. Did you change the settings?.");}
-
-    // finally we read the first 'stop' elements of the fvals vector
-    checkpoint_file.read(reinterpret_cast<char*>(fvals.data()), stop*sizeof(Fval));
-    checkpoint_file.close();
-
-    if (settings::general::verbose) {std::cout << "Loaded " << stop << " points from checkpoint file." << std::endl;}
-    return stop;
-}
-
 bool interrupt_signal = false;
 void interrupt_handler(int signal) {
-    std::cout << "Interrupt signal received. Finishing current calculations and writing a checkpoint before exiting. \nInterrupt again to exit immediately and lose current progress." << std::endl;
+    std::cout << "Interrupt signal received. Finishing current calculations and writing a checkpoint before exiting. \nInterrupt again to exit immediately and lose the calculations currently in progress." << std::endl;
     std::signal(SIGINT, SIG_DFL);
     if (signal == SIGINT) {interrupt_signal = true;}
 }
 
-void interrupt_handler_save(int) {
-    std::cout << "Program cannot be interrupted while writing a checkpoint file. Please wait." << std::endl;
-}
-
 SimpleDataset CrystalScattering::calculate() const {
     if (Fval::get_points().empty()) {throw except::invalid_argument("CrystalScattering::calculate: No points were set.");}
     if (Fval::get_basis().x.x() == 0 || Fval::get_basis().y.y() == 0 || Fval::get_basis().z.z() == 0) {throw except::invalid_argument("CrystalScattering::calculate: No basis was set.");}
     auto millers = miller_strategy->generate();
 
     std::vector<Fval> fvals(millers.size());
-    std::atomic<unsigned int> index = settings::crystal::detail::use_checkpointing ? load_checkpoint(fvals) : 0;
-
-    auto dispatcher = [&] () {
-        while (true) {
-            unsigned int start = index.fetch_add(settings::general::detail::job_size);
-            unsigned int end = std::min<unsigned int>(start + settings::general::detail::job_size, millers.size());
-            if (start >= millers.size() || interrupt_signal) {
-                index = std::min(index.load(), end);
-                break;
-            }
+    int hmax = 0, kmax = 0, lmax = 0;
+    for (const auto& m : millers) {
+        hmax = std::max(hmax, std::abs(m.h));
+        kmax = std::max(kmax, std::abs(m.k));
+        lmax = std::max(lmax, std::abs(m.l));
+    }
 
-            std::cout << start << "/" << millers.size() << "          \r" << std::flush;
-            for (unsigned int i = start; i < end; i++) {
-                fvals[i] = Fval(millers[i].h, millers[i].k, millers[i].l);
-            }
+    // the transform needs a grid covering all indices, so the slower direct sum is used if it would not fit in the memory budget
+    // the hard size limit also applies without a budget, since the grid grows with the cube of the maximum index
+    std::size_t grid_bytes = StructureFactorGrid::bytes(hmax, kmax, lmax);
+    bool fft_fits = grid_bytes <= std::size_t(settings::crystal::detail::max_fft_memory) << 20 && grid_bytes <= utility::memory::get_remaining_budget();
+    if (settings::crystal::use_fft && fft_fits) {
+        // all structure factors are obtained from a single transform of the unit cell
+        Basis3D basis = Fval::get_basis();
+        Vector3<double> cell(2*constants::pi/basis.x.x(), 2*constants::pi/basis.y.y(), 2*constants::pi/basis.z.z());
+        StructureFactorGrid F(Fval::get_points(), cell, hmax, kmax, lmax);
+        for (unsigned int i = 0; i < millers.size(); i++) {
+            fvals[i] = Fval(millers[i].h, millers[i].k, millers[i].l, F.F(millers[i].h, millers[i].k, millers[i].l));
         }
-    };
-
-    // if the checkpoint file does not contain all points, we need to calculate the remaining points
-    if (index < millers.size()) {
-        // register the interrupt signal handler. we need this to ensure that the checkpoint file is saved properly before the program exits
-        if (settings::crystal::detail::use_checkpointing) {std::signal(SIGINT, interrupt_handler);}
-
-        // start threads
-        std::vector<std::thread> threads;
-        for (unsigned int i = 0; i < settings::general::threads; i++) {
-            threads.push_back(std::thread(dispatcher));
+    } else {
+        // the indices are calculated in blocks. with checkpointing, each finished block is appended to the log, and blocks already in the log are skipped
+        // the blocks only write to the preallocated structure factors, so they need no memory of their own
+        unsigned int job_size = settings::general::detail::job_size;
+        std::unique_ptr<CheckpointLog> log;
+        std::vector<unsigned int> blocks;
+        if (settings::crystal::detail::use_checkpointing) {
+            log = std::make_unique<CheckpointLog>(settings::general::output + "temp/checkpoint.log", millers, fvals, job_size);
+            blocks = log->remaining_blocks();
+        } else {
+            blocks.resize((millers.size() + job_size - 1)/job_size);
+            std::iota(blocks.begin(), blocks.end(), 0);
         }
 
-        // wait for threads to finish
-        for (auto& thread : threads) {
-            thread.join();
-        }
+        // if the checkpoint file does not contain all points, we need to calculate the remaining points
+        if (!blocks.empty()) {
+            // register the interrupt signal handler. we need this to ensure that the calculations in progress are finished and logged before the program exits
+            if (log) {std::signal(SIGINT, interrupt_handler);}
+
+            // each block is a separate task, so this calculation can itself be nested inside other tasks
+            // a worker waiting on the group only runs the queued blocks of this group, never unrelated tasks, and sleeps once the rest are running elsewhere
+            utility::multi_threading::TaskGroup tasks;
+            for (unsigned int i = 0; i < blocks.size(); ++i) {
+                tasks.run([&, i] () {
+                    if (interrupt_signal) {return;}
+                    unsigned int start = blocks[i]*job_size;
+                    unsigned int end = std::min<unsigned int>(start + job_size, millers.size());
+
+                    std::cout << i*job_size << "/" << millers.size() << "          \r" << std::flush;
+                    for (unsigned int j = start; j < end; j++) {
+                        fvals[j] = Fval(millers[j].h, millers[j].k, millers[j].l);
+                    }
+                    if (log) {log->commit(blocks[i]);}
+                });
+            }
+            tasks.wait();
 
-        // save final checkpoint
-        if (settings::crystal::detail::use_checkpointing) {
-            std::signal(SIGINT, interrupt_handler_save);
-            save_checkpoint(millers.size(), fvals);
-            std::signal(SIGINT, SIG_DFL); // reset the interrupt signal handler
-            if (interrupt_signal) {raise(SIGINT);} // raise the interrupt signal again to ensure that the program exits
+            // wait for the remaining records to be written
+            if (log) {
+                log->close();
+                std::signal(SIGINT, SIG_DFL); // reset the interrupt signal handler
+                if (interrupt_signal) {raise(SIGINT);} // raise the interrupt signal again to ensure that the program exits
+            }
         }
     }
 
-    // sort fvals by q
-    std::sort(fvals.begin(), fvals.end(), [] (const Fval& a, const Fval& b) {return a.qlength < b.qlength;});
+    std::vector<double> I(fvals.size());
+    std::transform(fvals.begin(), fvals.end(), I.begin(), [] (const Fval& f) {return f.I();});
+    return bin(millers, I);
+}
+
+SimpleDataset CrystalScattering::bin(const std::vector<Miller>& millers, const std::vector<double>& I) {
+    // sort the indices by q
+    std::vector<double> q(millers.size());
+    std::transform(millers.begin(), millers.end(), q.begin(), [] (const Miller& m) {return Fval::Q(m).norm();});
+    std::vector<unsigned int> order(millers.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&q] (unsigned int a, unsigned int b) {return q[a] < q[b];});
 
     // prepare the q profile
     std::vector<double> bins(constants::axes::q_axis.get_bin(settings::axes::qmax));
@@ -207,15 +167,17 @@ SimpleDataset CrystalScattering::calculate() const {
     // bin the data
     SimpleDataset data;
     unsigned int bin_index = 0;
-    while (bin_index < fvals.size() && fvals[bin_index].qlength < bins[0]) {bin_index++;} // skip all values below the first bin
+    while (bin_index < order.size() && q[order[bin_index]] < bins[0]) {bin_index++;} // skip all values below the first bin
     for (unsigned int i = 0; i < bins.size()-1; i++) {
         double qmin = bins[i];
         double qmax = bins[i+1];
         double Isum = 0;
         unsigned int count = 0;
-        while (bin_index < fvals.size() && fvals[bin_index].qlength < qmax) {
-            Isum += fvals[bin_index].I();
-            count++;
+        while (bin_index < order.size() && q[order[bin_index]] < qmax) {
+            // each index represents all of its symmetry-equivalent indices
+            unsigned int j = order[bin_index];
+            Isum += millers[j].multiplicity*I[j];
+            count += millers[j].multiplicity;
             bin_index++;
         }
         data.push_back(qmin, count == 0 ? 0 : Isum/count);
@@ -18,6 +18,11 @@ Fval::Fval(int h, int k, int l) : hkl(h, k, l) {
     fval = F();
 }
 
+Fval::Fval(int h, int k, int l, std::complex<double> fval) : hkl(h, k, l), fval(fval) {
+    q = Q();
+    qlength = q.norm();
+}
+
 void Fval::set_points(std::vector<Vector3<double>>&& points) {
     Fval::points = std::move(points);
 }
@@ -0,0 +1,98 @@
+/*
+This software is distributed under the GNU General Public License v3.0. 
+For more information, please refer to the LICENSE file in the project root.
+*/
+
+#include <crystal/RotationalAverager.h>
+#include <crystal/miller/Miller.h>
+#include <crystal/Fval.h>
+#include <math/MatrixUtils.h>
+#include <settings/CrystalSettings.h>
+#include <settings/GeneralSettings.h>
+#include <utility/MultiThreading.h>
+#include <utility/Exceptions.h>
+#include <constants/Constants.h>
+
+#include <algorithm>
+#include <random>
+#include <complex>
+
+using namespace crystal;
+
+RotationalAverager::RotationalAverager(const std::vector<Vector3<double>>& points) : points(points) {}
+
+std::vector<Matrix<double>> RotationalAverager::generate_orientations(unsigned int n, settings::crystal::OrientationChoice choice) {
+    std::vector<Matrix<double>> orientations;
+    orientations.reserve(n);
+    switch (choice) {
+        case settings::crystal::OrientationChoice::Random: {
+            // uniformly distributed unit quaternions (Shoemake), converted to their axis-angle representation
+            std::random_device rd;
+            std::mt19937 gen(rd());
+            std::uniform_real_distribution<> dis(0, 1);
+            for (unsigned int i = 0; i < n; ++i) {
+                double u1 = dis(gen), u2 = 2*constants::pi*dis(gen), u3 = 2*constants::pi*dis(gen);
+                double a = std::sqrt(u1)*std::cos(u3);
+                Vector3<double> axis(std::sqrt(1-u1)*std::sin(u2), std::sqrt(1-u1)*std::cos(u2), std::sqrt(u1)*std::sin(u3));
+                if (axis.norm() == 0) {axis = {0, 0, 1};}
+                orientations.push_back(matrix::rotation_matrix(axis, 2*std::acos(std::clamp(a, -1., 1.))));
+            }
+            break;
+        }
+        case settings::crystal::OrientationChoice::Fibonacci: {
+            // the z-axis is rotated onto the points of a Fibonacci sphere, with the rotation around it following the golden angle
+            double phi = (1 + std::sqrt(5))/2;
+            for (unsigned int i = 0; i < n; ++i) {
+                double z = 1 - 2*(i + 0.5)/n;
+                double azimuth = 2*constants::pi*i/phi;
+                double twist = 2*constants::pi*i/(phi*phi);
+                orientations.push_back(
+                    matrix::rotation_matrix({0, 0, 1}, azimuth)*matrix::rotation_matrix({0, 1, 0}, std::acos(z))*matrix::rotation_matrix({0, 0, 1}, twist)
+                );
+            }
+            break;
+        }
+        default: {
+            throw except::unknown_argument("RotationalAverager::generate_orientations: Unknown OrientationChoice. Did you forget to add it to the switch statement?");
+        }
+    }
+    return orientations;
+}
+
+std::vector<double> RotationalAverager::average(const std::vector<Miller>& millers, const std::vector<Matrix<double>>& orientations) const {
+    if (orientations.empty()) {throw except::invalid_argument("RotationalAverager::average: At least one orientation is required.");}
+
+    // rotating the points by R is equivalent to rotating the scattering vectors by R^T
+    std::vector<Vector3<double>> q(millers.size());
+    std::transform(millers.begin(), millers.end(), q.begin(), [] (const Miller& m) {return Fval::Q(m);});
+    std::vector<Matrix<double>> inverse(orientations.size());
+    std::transform(orientations.begin(), orientations.end(), inverse.begin(), [] (const Matrix<double>& R) {return R.T();});
+
+    utility::multi_threading::TaskGroup tasks;
+    unsigned int batches = std::min<unsigned int>(orientations.size(), std::max(1u, tasks.get_scheduler()->get_thread_count()));
+    std::vector<std::vector<double>> accumulators(batches, std::vector<double>(millers.size(), 0));
+    for (unsigned int b = 0; b < batches; ++b) {
+        tasks.run([&, b] () {
+            auto& accumulator = accumulators[b];
+            for (unsigned int r = b*inverse.size()/batches; r < (b+1)*inverse.size()/batches; ++r) {
+                const auto& R = inverse[r];
+                for (unsigned int i = 0; i < q.size(); ++i) {
+                    Vector3<double> qr = R*q[i];
+                    std::complex<double> F = 0;
+                    for (const auto& p : points) {
+                        F += std::polar(1.0, -qr.dot(p));
+                    }
+                    accumulator[i] += std::norm(F);
+                }
+            }
+        });
+    }
+    tasks.wait();
+
+    std::vector<double> result(millers.size(), 0);
+    for (const auto& accumulator : accumulators) {
+        std::transform(result.begin(), result.end(), accumulator.begin(), result.begin(), std::plus<>());
+    }
+    std::transform(result.begin(), result.end(), result.begin(), [n = orientations.size()] (double I) {return I/n;});
+    return result;
+}
\ No newline at end of file
@@ -0,0 +1,89 @@
+/*
+This software is distributed under the GNU General Public License v3.0. 
+For more information, please refer to the LICENSE file in the project root.
+*/
+
+#include <crystal/StructureFactorGrid.h>
+#include <math/FFT.h>
+#include <utility/Exceptions.h>
+
+#include <cmath>
+#include <string>
+#include <numbers>
+
+using namespace crystal;
+
+// half-width of the spreading kernel in grid points. the wide kernel keeps the relative accuracy at about 1e-5 even at the lowest oversampling ratio
+constexpr int spread = 12;
+
+// the smallest allowed ratio between the grid size and the number of Miller indices along an axis
+constexpr double min_oversampling = 1.25;
+
+namespace {
+    // the size of the oversampled grid along an axis with @a n Miller indices
+    unsigned int grid_size(unsigned int n) {
+        return math::next_power_of_two(std::max<unsigned int>(std::ceil(min_oversampling*n), 2*spread));
+    }
+}
+
+StructureFactorGrid::StructureFactorGrid(const std::vector<Vector3<double>>& points, const Vector3<double>& cell, unsigned int h, unsigned int k, unsigned int l) : max{int(h), int(k), int(l)} {
+    std::array<double, 3> tau;
+    for (unsigned int d = 0; d < 3; ++d) {
+        unsigned int n = 2*max[d] + 1;
+        size[d] = grid_size(n);
+        double R = double(size[d])/n; // the oversampling ratio
+        tau[d] = std::numbers::pi*spread/(double(n)*n*R*(R - 0.5));
+    }
+    grid.assign(std::size_t(size[0])*size[1]*size[2], 0);
+
+    // spread each point onto the grid. the Gaussian is separable, so the weights are calculated once per axis
+    std::array<std::array<double, 2*spread>, 3> weights;
+    std::array<std::array<unsigned int, 2*spread>, 3> indices;
+    for (const auto& p : points) {
+        for (unsigned int d = 0; d < 3; ++d) {
+            double u = p[d]/cell[d];
+            u -= std::floor(u);                         // fractional coordinate in [0, 1)
+            int m0 = std::floor(u*size[d]);
+            double x = 2*std::numbers::pi*u;
+            for (int a = 0; a < 2*spread; ++a) {
+                int m = m0 - spread + 1 + a;
+                double dx = x - 2*std::numbers::pi*m/size[d];
+                weights[d][a] = std::exp(-dx*dx/(4*tau[d]));
+                indices[d][a] = (m + int(size[d])) % size[d];
+            }
+        }
+
+        for (int a = 0; a < 2*spread; ++a) {
+            for (int b = 0; b < 2*spread; ++b) {
+                double wab = weights[0][a]*weights[1][b];
+                std::size_t row = (std::size_t(indices[0][a])*size[1] + indices[1][b])*size[2];
+                for (int c = 0; c < 2*spread; ++c) {
+                    grid[row + indices[2][c]] += wab*weights[2][c];
+                }
+            }
+        }
+    }
+
+    math::fft3(grid, size[0], size[1], size[2]);
+
+    // deconvolution factors sqrt(pi/tau) exp(k^2 tau)/M of the Gaussian kernel
+    for (unsigned int d = 0; d < 3; ++d) {
+        deconvolve[d].resize(2*max[d] + 1);
+        for (int i = -max[d]; i <= max[d]; ++i) {
+            deconvolve[d][i + max[d]] = std::sqrt(std::numbers::pi/tau[d])*std::exp(i*i*tau[d])/size[d];
+        }
+    }
+}
+
+std::complex<double> StructureFactorGrid::F(int h, int k, int l) const {
+    if (std::abs(h) > max[0] || std::abs(k) > max[1] || std::abs(l) > max[2]) [[unlikely]] {
+        throw except::out_of_bounds("StructureFactorGrid::F: Miller index (" + std::to_string(h) + ", " + std::to_string(k) + ", " + std::to_string(l) + ") is outside the calculated range.");
+    }
+    std::size_t i = (h + size[0]) % size[0], j = (k + size[1]) % size[1], m = (l + size[2]) % size[2];
+    double factor = deconvolve[0][h + max[0]]*deconvolve[1][k + max[1]]*deconvolve[2][l + max[2]];
+    return grid[(i*size[1] + j)*size[2] + m]*factor;
+}
+
+std::size_t StructureFactorGrid::bytes(unsigned int h, unsigned int k, unsigned int l) {
+    return std::size_t(grid_size(2*h + 1))*grid_size(2*k + 1)*grid_size(2*l + 1)*sizeof(std::complex<double>);
+}
\ No newline at end of file
@@ -7,11 +7,14 @@ For more information, please refer to the LICENSE file in the project root.
 #include <crystal/miller/AllMillers.h>
 #include <crystal/miller/ReducedMillers.h>
 #include <crystal/miller/FibonacciMillers.h>
+#include <crystal/miller/SymmetryReducedMillers.h>
 #include <settings/CrystalSettings.h>
 #include <residue/ResidueMap.h>
 
 std::unique_ptr<crystal::MillerGenerationStrategy> crystal::factory::construct_miller_strategy() {
-    return construct_miller_strategy(settings::crystal::miller_generation_strategy);
+    auto strategy = construct_miller_strategy(settings::crystal::miller_generation_strategy);
+    if (settings::crystal::use_symmetry) {return std::make_unique<crystal::SymmetryReducedMillers>(std::move(strategy));}
+    return strategy;
 }
 
 std::unique_ptr<crystal::MillerGenerationStrategy> crystal::factory::construct_miller_strategy(const settings::crystal::MillerGenerationChoice& choice) {
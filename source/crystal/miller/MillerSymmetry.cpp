@@ -0,0 +1,138 @@
+/*
+This software is distributed under the GNU General Public License v3.0. 
+For more information, please refer to the LICENSE file in the project root.
+*/
+
+#include <crystal/miller/MillerSymmetry.h>
+#include <crystal/miller/Miller.h>
+#include <crystal/Fval.h>
+#include <math/KDTree.h>
+#include <utility/Basis3D.h>
+#include <constants/Constants.h>
+
+#include <algorithm>
+#include <unordered_map>
+#include <tuple>
+#include <cmath>
+#include <cstdint>
+
+using namespace crystal;
+
+Miller MillerSymmetry::Operation::apply(const Miller& m) const {
+    std::array<int, 3> in = {m.h, m.k, m.l};
+    return Miller(signs[0]*in[axes[0]], signs[1]*in[axes[1]], signs[2]*in[axes[2]]);
+}
+
+std::vector<MillerSymmetry::Operation> MillerSymmetry::all_operations() {
+    std::vector<Operation> ops;
+    std::array<unsigned int, 3> axes = {0, 1, 2};
+    do {
+        for (int s = 0; s < 8; ++s) {
+            ops.push_back({axes, {s & 1 ? -1 : 1, s & 2 ? -1 : 1, s & 4 ? -1 : 1}});
+        }
+    } while (std::next_permutation(axes.begin(), axes.end()));
+    return ops;
+}
+
+MillerSymmetry::MillerSymmetry() : operations{{{0, 1, 2}, {1, 1, 1}}, {{0, 1, 2}, {-1, -1, -1}}} {}
+
+MillerSymmetry MillerSymmetry::detect() {
+    Basis3D basis = Fval::get_basis();
+    Vector3<double> cell(2*constants::pi/basis.x.x(), 2*constants::pi/basis.y.y(), 2*constants::pi/basis.z.z());
+    return detect(Fval::get_points(), cell);
+}
+
+MillerSymmetry MillerSymmetry::detect(const std::vector<Vector3<double>>& points, const Vector3<double>& cell, double tolerance) {
+    MillerSymmetry symmetry;
+    if (points.empty()) {return symmetry;}
+    tolerance *= std::min({cell.x(), cell.y(), cell.z()});
+
+    // wrap all points into the unit cell
+    auto wrap = [&cell] (const Vector3<double>& p) {
+        Vector3<double> w;
+        for (unsigned int d = 0; d < 3; ++d) {
+            w[d] = p[d] - cell[d]*std::floor(p[d]/cell[d]);
+        }
+        return w;
+    };
+    std::vector<Vector3<double>> wrapped(points.size());
+    std::transform(points.begin(), points.end(), wrapped.begin(), wrap);
+    math::KDTree tree(wrapped);
+
+    // check if a point has a partner in the cell, including the periodic images of the points close to the cell boundaries
+    auto has_partner = [&] (const Vector3<double>& p) {
+        std::array<std::vector<double>, 3> shifts;
+        for (unsigned int d = 0; d < 3; ++d) {
+            shifts[d] = {0};
+            if (p[d] < tolerance) {shifts[d].push_back(cell[d]);}
+            if (cell[d] - tolerance < p[d]) {shifts[d].push_back(-cell[d]);}
+        }
+        for (double dx : shifts[0]) {
+            for (double dy : shifts[1]) {
+                for (double dz : shifts[2]) {
+                    if (tree.nearest(p + Vector3<double>(dx, dy, dz), tolerance).first != -1) {return true;}
+                }
+            }
+        }
+        return false;
+    };
+
+    symmetry.operations.clear();
+    for (const auto& op : all_operations()) {
+        bool identity = op.axes == std::array<unsigned int, 3>{0, 1, 2};
+        if (identity && (op.signs == std::array<int, 3>{1, 1, 1} || op.signs == std::array<int, 3>{-1, -1, -1})) {
+            symmetry.operations.push_back(op);
+            continue;
+        }
+
+        // permuted axes must have the same length
+        bool compatible = true;
+        for (unsigned int d = 0; d < 3; ++d) {
+            if (tolerance < std::abs(cell[d] - cell[op.axes[d]])) {compatible = false;}
+        }
+        if (!compatible) {continue;}
+
+        // the operation is a symmetry if every transformed point coincides with another point
+        bool invariant = std::all_of(wrapped.begin(), wrapped.end(), [&] (const Vector3<double>& p) {
+            Vector3<double> q(op.signs[0]*p[op.axes[0]], op.signs[1]*p[op.axes[1]], op.signs[2]*p[op.axes[2]]);
+            return has_partner(wrap(q));
+        });
+        if (invariant) {symmetry.operations.push_back(op);}
+    }
+    return symmetry;
+}
+
+Miller MillerSymmetry::canonical(const Miller& m) const {
+    Miller best = m;
+    for (const auto& op : operations) {
+        Miller n = op.apply(m);
+        if (std::tie(best.h, best.k, best.l) < std::tie(n.h, n.k, n.l)) {best = n;}
+    }
+    return best;
+}
+
+std::vector<Miller> MillerSymmetry::reduce(const std::vector<Miller>& millers) const {
+    // pack the canonical index into a single integer. each component is offset to be positive and given 21 bits
+    auto key = [this] (const Miller& m) {
+        Miller c = canonical(m);
+        constexpr std::int64_t offset = 1 << 20;
+        return ((c.h + offset) << 42) | ((c.k + offset) << 21) | (c.l + offset);
+    };
+
+    std::vector<Miller> reduced;
+    std::unordered_map<std::int64_t, unsigned int> groups;
+    groups.reserve(millers.size()/operations.size() + 1);
+    for (const auto& m : millers) {
+        auto [it, inserted] = groups.try_emplace(key(m), reduced.size());
+        if (inserted) {
+            reduced.push_back(m);
+        } else {
+            reduced[it->second].multiplicity += m.multiplicity;
+        }
+    }
+    return reduced;
+}
+
+unsigned int MillerSymmetry::order() const noexcept {
+    return operations.size();
+}
\ No newline at end of file
@@ -0,0 +1,25 @@
+/*
+This software is distributed under the GNU General Public License v3.0. 
+For more information, please refer to the LICENSE file in the project root.
+*/
+
+#include <crystal/miller/SymmetryReducedMillers.h>
+#include <crystal/miller/MillerSymmetry.h>
+#include <crystal/miller/Miller.h>
+#include <settings/GeneralSettings.h>
+
+#include <iostream>
+
+using namespace crystal;
+
+SymmetryReducedMillers::SymmetryReducedMillers(std::unique_ptr<MillerGenerationStrategy> strategy) : strategy(std::move(strategy)) {}
+
+std::vector<Miller> SymmetryReducedMillers::generate() const {
+    auto millers = strategy->generate();
+    auto symmetry = MillerSymmetry::detect();
+    auto reduced = symmetry.reduce(millers);
+    if (settings::general::verbose) {
+        std::cout << "Detected " << symmetry.order() << " symmetry operations. Reduced " << millers.size() << " Miller indices to " << reduced.size() << "." << std::endl;
+    }
+    return reduced;
+}
\ No newline at end of file
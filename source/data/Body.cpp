@@ -46,6 +46,11 @@ Body::~Body() = default;
 
 void Body::initialize() {
     signal = std::make_shared<signaller::UnboundSignaller>();
+    update_account();
+}
+
+void Body::update_account() const {
+    account.set(utility::memory::size_of(get_atoms()) + utility::memory::size_of(get_waters()));
 }
 
 void Body::save(const io::File& path) {file.write(path);}
@@ -166,7 +171,10 @@ bool Body::equals_content(const Body& rhs) const {
 
 void Body::changed_external_state() const {signal->external_change();}
 
-void Body::changed_internal_state() const {signal->internal_change();}
+void Body::changed_internal_state() const {
+    update_account();
+    signal->internal_change();
+}
 
 std::shared_ptr<signaller::Signaller> Body::get_signaller() const {
     return signal;
@@ -80,6 +80,7 @@ Molecule::Molecule(const std::vector<std::string>& input) {
 Molecule::~Molecule() = default;
 
 void Molecule::initialize() {
+    hydration_account.set(utility::memory::size_of(hydration_atoms));
     set_histogram_manager(hist::factory::construct_histogram_manager(this, settings::hist::weighted_bins));
     if (!centered && settings::molecule::center) {center();} // Centering *must* happen before generating the grid in 'update_effective_charge'!
     if (!updated_charge && settings::molecule::use_effective_charge) {update_effective_charge();}
@@ -224,6 +225,7 @@ void Molecule::generate_new_hydration() {
     if (grid == nullptr) {create_grid();}
     else {grid->clear_waters();}
     get_waters() = grid->hydrate();
+    hydration_account.set(utility::memory::size_of(hydration_atoms));
 }
 
 std::unique_ptr<hist::ICompositeDistanceHistogram> Molecule::get_histogram() const {
@@ -343,6 +345,7 @@ void Molecule::center() {
 }
 
 void Molecule::signal_modified_hydration_layer() const {
+    hydration_account.set(utility::memory::size_of(hydration_atoms));
     if (phm == nullptr) {return;}
     phm->signal_modified_hydration_layer();
 }
@@ -17,6 +17,7 @@ For more information, please refer to the LICENSE file in the project root.
 #include <utility/Console.h>
 #include <utility/Limit.h>
 #include <utility/Utility.h>
+#include <utility/Job.h>
 #include <constants/Constants.h>
 #include <hist/intensity_calculator/DistanceHistogram.h>
 #include <hist/intensity_calculator/CompositeDistanceHistogram.h>
@@ -434,6 +435,7 @@ std::function<double(std::vector<double>)> ImageStack::prepare_function(std::sha
         static unsigned int counter = 0;
         static double last_c = 5;
 
+        utility::job::check_cancelled();
         std::shared_ptr<Fit> fit;
         auto p = get_protein_manager()->get_protein(params[0]);
         if (settings::em::hydrate) {
@@ -459,6 +461,7 @@ std::function<double(std::vector<double>)> ImageStack::prepare_function(std::sha
 
         double val = fit->fval;
         progress.notify(counter++);
+        utility::job::report_progress("ImageStack::fit", counter, 2*settings::fit::max_iterations);
         if (settings::fit::verbose) {
             std::cout << "Step " << utility::print_element(counter, 4) << ": Evaluated cutoff value " << utility::print_element(params[0], 8) << " with chi2 " << utility::print_element(val, 8) << std::flush << "\r";
         }
@@ -95,11 +95,10 @@ std::unique_ptr<data::Molecule> SmartProteinManager::generate_protein(double cut
 }
 
 void SmartProteinManager::toggle_histogram_manager_init(bool state) {
-    static settings::hist::HistogramManagerChoice previous = settings::hist::histogram_manager;
     if (state) {
-        settings::hist::histogram_manager = previous;
+        settings::hist::histogram_manager = previous_histogram_manager;
     } else {
-        previous = settings::hist::histogram_manager;
+        previous_histogram_manager = settings::hist::histogram_manager;
         settings::hist::histogram_manager = settings::hist::HistogramManagerChoice::None;
     }
 }
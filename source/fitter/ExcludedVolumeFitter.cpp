@@ -17,6 +17,7 @@ For more information, please refer to the LICENSE file in the project root.
 #include <plots/All.h>
 #include <settings/GeneralSettings.h>
 #include <data/Molecule.h>
+#include <utility/Trace.h>
 
 using namespace fitter;
 
@@ -30,6 +31,7 @@ ExcludedVolumeFitter::ExcludedVolumeFitter(const io::ExistingFile& input, std::u
 }
 
 std::shared_ptr<Fit> ExcludedVolumeFitter::fit() {
+    TRACE_ZONE("ExcludedVolumeFitter::fit");
     fit_type = mini::type::DEFAULT;
     settings::general::verbose = false;
     std::function<double(std::vector<double>)> f = std::bind(&ExcludedVolumeFitter::chi2, this, std::placeholders::_1);
@@ -67,15 +69,8 @@ double ExcludedVolumeFitter::fit_chi2_only() {
 
     update_excluded_volume(res.get_parameter("d").value);
     cast_h()->apply_water_scaling_factor(res.get_parameter("c").value);
-    std::vector<double> ym = h->debye_transform().get_counts();
-    std::vector<double> Im = splice(ym);
-
-    // we want to fit a*Im + b to Io
-    SimpleDataset fit_data(Im, data.y(), data.yerr());
-    if (I0 > 0) {fit_data.normalize(I0);}
-
-    SimpleLeastSquares fitter(fit_data);
-    return fitter.fit_chi2_only();
+    auto I = h->debye_transform();
+    return chi2_spliced(I.get_counts());
 }
 
 FitPlots ExcludedVolumeFitter::plot() {
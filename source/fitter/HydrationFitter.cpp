@@ -19,6 +19,7 @@ For more information, please refer to the LICENSE file in the project root.
 #include <mini/All.h>
 #include <mini/detail/Parameter.h>
 #include <mini/Minimizer.h>
+#include <utility/Trace.h>
 
 using namespace fitter;
 
@@ -40,6 +41,7 @@ observer_ptr<hist::ICompositeDistanceHistogram> HydrationFitter::cast_h() const
 }
 
 std::shared_ptr<Fit> HydrationFitter::fit() {
+    TRACE_ZONE("HydrationFitter::fit");
     std::function<double(std::vector<double>)> f = std::bind(&HydrationFitter::chi2, this, std::placeholders::_1);
     auto mini = mini::create_minimizer(fit_type, f, guess, settings::fit::max_iterations);
     auto res = mini->minimize();
@@ -71,15 +73,8 @@ double HydrationFitter::fit_chi2_only() {
 
     // apply c
     cast_h()->apply_water_scaling_factor(res.get_parameter("c").value);
-    std::vector<double> ym = h->debye_transform().get_counts();
-    std::vector<double> Im = splice(ym);
-
-    // we want to fit a*Im + b to Io
-    SimpleDataset fit_data(Im, data.y(), data.yerr());
-    if (I0 > 0) {fit_data.normalize(I0);}
-
-    SimpleLeastSquares fitter(fit_data);
-    return fitter.fit_chi2_only();
+    auto I = h->debye_transform();
+    return chi2_spliced(I.get_counts());
 }
 
 FitPlots HydrationFitter::plot() {
@@ -138,24 +133,8 @@ double HydrationFitter::chi2(const std::vector<double>& params) {
 
     // apply c
     cast_h()->apply_water_scaling_factor(c);
-    std::vector<double> ym = h->debye_transform().get_counts();
-    std::vector<double> Im = splice(ym);
-
-    // we want to fit a*Im + b to Io
-    SimpleDataset fit_data(Im, data.y(), data.yerr());
-    if (I0 > 0) {fit_data.normalize(I0);}
-
-    SimpleLeastSquares fitter(fit_data);
-    auto[a, b] = fitter.fit_params_only();
-
-    // calculate chi2
-    double chi = 0;
-    for (int i = 0; i < static_cast<int>(data.size()); i++) {
-        double v = (data.y(i) - (a*Im[i]+b))/data.yerr(i);
-        chi += v*v;
-    }
-
-    return chi;
+    auto I = h->debye_transform();
+    return chi2_spliced(I.get_counts());
 }
 
 unsigned int HydrationFitter::dof() const {
@@ -5,7 +5,6 @@ For more information, please refer to the LICENSE file in the project root.
 
 #include <fitter/LinearFitter.h>
 #include <fitter/FitPlots.h>
-#include <math/CubicSpline.h>
 #include <math/SimpleLeastSquares.h>
 #include <hist/intensity_calculator/DistanceHistogram.h>
 #include <hist/Histogram.h>
@@ -15,6 +14,7 @@ For more information, please refer to the LICENSE file in the project root.
 #include <mini/detail/Evaluation.h>
 #include <dataset/Dataset2D.h>
 #include <settings/EMSettings.h>
+#include <utility/Trace.h>
 
 using namespace fitter;
 
@@ -39,6 +39,7 @@ void LinearFitter::model_setup(std::unique_ptr<hist::DistanceHistogram> model, c
     data.simulate_errors();
     if (I0 > 0) {data.normalize(I0);}
     if (settings::em::simulation::noise) {data.simulate_noise();}
+    reset_buffers();
 }
 
 double LinearFitter::fit_chi2_only() {
@@ -46,6 +47,7 @@ double LinearFitter::fit_chi2_only() {
 }
 
 std::shared_ptr<Fit> LinearFitter::fit() {
+    TRACE_ZONE("LinearFitter::fit");
     std::vector<double> ym = h->debye_transform().get_counts();
     std::vector<double> Im = splice(ym);
 
@@ -63,6 +65,7 @@ std::shared_ptr<Fit> LinearFitter::fit() {
 void LinearFitter::normalize_intensity(double new_I0) {
     if (I0 < 0) {data.normalize(new_I0);} // if y0 has not been set yet, we must rescale the data
     I0 = new_I0;
+    reset_buffers();
 }
 
 FitPlots LinearFitter::plot() {
@@ -125,28 +128,57 @@ observer_ptr<hist::DistanceHistogram> LinearFitter::get_scattering_hist() {
 }
 
 double LinearFitter::chi2(const std::vector<double>&) {
-    std::vector<double> ym = h->debye_transform().get_counts();
-    std::vector<double> Im = splice(ym);
+    auto I = h->debye_transform();
+    return chi2_spliced(I.get_counts());
+}
+
+double LinearFitter::chi2_spliced(const std::vector<double>& ym) {
+    if (y_buffer.size() != data.size()) {
+        double scale = I0 > 0 ? I0/data.y(0) : 1;
+        y_buffer.resize(data.size());
+        w_buffer.resize(data.size());
+        for (unsigned int i = 0; i < data.size(); ++i) {
+            y_buffer[i] = scale*data.y(i);
+            w_buffer[i] = 1./(scale*scale*data.yerr(i)*data.yerr(i)); // normalizing the data also scales its errors
+        }
+    }
 
     // we want to fit a*Im + b to Io
-    SimpleDataset fit_data(Im, data.y(), data.yerr());
-    if (I0 > 0) {fit_data.normalize(I0);}
-
-    SimpleLeastSquares fitter(fit_data);
-    return fitter.fit_chi2_only();
+    splice(ym, Im_buffer);
+    auto[a, b] = SimpleLeastSquares::fit_params_only(Im_buffer, y_buffer, w_buffer);
+    return SimpleLeastSquares::chi2(Im_buffer, y_buffer, w_buffer, a, b);
 }
 
 void LinearFitter::setup(const io::ExistingFile& file) {
     data = SimpleDataset(file); // read observed values from input file
+    reset_buffers();
 }
 
 std::vector<double> LinearFitter::splice(const std::vector<double>& ym) const {
-    std::vector<double> Im(data.size()); // spliced model values
-    math::CubicSpline s(h->get_q_axis(), ym);
-    for (unsigned int i = 0; i < data.size(); ++i) {
-        Im[i] = s.spline(data.x(i));
+    TRACE_ZONE("LinearFitter::splice");
+    return get_resampler().resample(ym);
+}
+
+void LinearFitter::splice(const std::vector<double>& ym, std::vector<double>& Im) const {
+    TRACE_ZONE("LinearFitter::splice");
+    get_resampler().resample(ym, Im);
+}
+
+const math::CubicSplineResampler& LinearFitter::get_resampler() const {
+    const auto& q = h->get_q_axis();
+    if (resampler == nullptr || q != resampler_axis) {
+        resampler = std::make_unique<math::CubicSplineResampler>(q, data.x());
+        resampler_axis = q;
     }
-    return Im;
+    return *resampler;
+}
+
+void LinearFitter::reset_buffers() {
+    resampler = nullptr;
+    resampler_axis.clear();
+    Im_buffer.clear();
+    y_buffer.clear();
+    w_buffer.clear();
 }
 
 unsigned int LinearFitter::size() const {
@@ -167,4 +199,5 @@ void LinearFitter::operator=(LinearFitter&& other) {
     data = std::move(other.data);
     I0 = other.I0;
     h = std::move(other.h);
+    reset_buffers();
 }
\ No newline at end of file
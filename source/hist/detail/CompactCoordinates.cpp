@@ -9,23 +9,39 @@ For more information, please refer to the LICENSE file in the project root.
 #include <data/record/Water.h>
 #include <data/Body.h>
 #include <constants/Constants.h>
+#include <utility/Exceptions.h>
+
+#include <limits>
+#include <algorithm>
+#include <array>
+#include <cmath>
 
 using namespace hist::detail;
 
-CompactCoordinates::CompactCoordinates(unsigned int size) : data(size) {}
+namespace {
+    // the distance calculations index atoms with 32-bit integers and partition them in jobs, so leave room for the last job
+    std::size_t check_size(std::size_t size) {
+        if (std::numeric_limits<int>::max()/2 < size) {
+            throw except::size_error("CompactCoordinates: Too many atoms (" + std::to_string(size) + ") for the distance calculations.");
+        }
+        return size;
+    }
+}
 
-CompactCoordinates::CompactCoordinates(std::vector<Vector3<double>>&& coordinates, double weight) : data(coordinates.size()) {
+CompactCoordinates::CompactCoordinates(std::size_t size) : data(check_size(size)) {}
+
+CompactCoordinates::CompactCoordinates(std::vector<Vector3<double>>&& coordinates, double weight) : data(check_size(coordinates.size())) {
     std::transform(coordinates.begin(), coordinates.end(), data.begin(), [weight] (const Vector3<double>& v) {return CompactCoordinatesData(v, weight);});
 }
 
-CompactCoordinates::CompactCoordinates(const data::Body& body) : data(body.atom_size()) {
+CompactCoordinates::CompactCoordinates(const data::Body& body) : data(check_size(body.atom_size())) {
     for (unsigned int i = 0; i < size(); ++i) {
         const auto& a = body.get_atom(i); 
         data[i] = CompactCoordinatesData(a.coords, a.effective_charge*a.occupancy);
     }
 }
 
-CompactCoordinates::CompactCoordinates(const std::vector<data::Body>& bodies) : data(std::accumulate(bodies.begin(), bodies.end(), 0, [](unsigned int sum, const data::Body& body) {return sum + body.atom_size();})) {
+CompactCoordinates::CompactCoordinates(const std::vector<data::Body>& bodies) : data(check_size(std::accumulate(bodies.begin(), bodies.end(), std::size_t(0), [](std::size_t sum, const data::Body& body) {return sum + body.atom_size();}))) {
     unsigned int i = 0;
     for (const auto& body : bodies) {
         for (const auto& a : body.get_atoms()) {
@@ -34,7 +50,7 @@ CompactCoordinates::CompactCoordinates(const std::vector<data::Body>& bodies) :
     }
 }
 
-CompactCoordinates::CompactCoordinates(const std::vector<data::record::Water>& atoms) : data(atoms.size()) {
+CompactCoordinates::CompactCoordinates(const std::vector<data::record::Water>& atoms) : data(check_size(atoms.size())) {
     for (unsigned int i = 0; i < size(); ++i) {
         const auto& a = atoms[i]; 
         data[i] = CompactCoordinatesData(a.coords, a.effective_charge*a.occupancy);
@@ -45,6 +61,36 @@ const std::vector<CompactCoordinatesData>& CompactCoordinates::get_data() const
 
 std::size_t CompactCoordinates::size() const {return data.size();}
 
+bool CompactCoordinates::has_uniform_weight() const {
+    return std::all_of(data.begin(), data.end(), [w = data.empty() ? 0 : data[0].value.w] (const CompactCoordinatesData& v) {return v.value.w == w;});
+}
+
 CompactCoordinatesData& CompactCoordinates::operator[](unsigned int i) {return data[i];}
 
-const CompactCoordinatesData& CompactCoordinates::operator[](unsigned int i) const {return data[i];}
\ No newline at end of file
+const CompactCoordinatesData& CompactCoordinates::operator[](unsigned int i) const {return data[i];}
+
+unsigned int hist::detail::get_required_bins(std::initializer_list<std::reference_wrapper<const CompactCoordinates>> data) {
+    const Axis axis = get_distance_axis();
+    const unsigned int min_bins = std::min(10u, static_cast<unsigned int>(axis.bins));
+    std::array<float, 3> min = {std::numeric_limits<float>::max(), std::numeric_limits<float>::max(), std::numeric_limits<float>::max()};
+    std::array<float, 3> max = {std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest()};
+    bool empty = true;
+    for (const CompactCoordinates& coords : data) {
+        for (const auto& v : coords.get_data()) {
+            for (unsigned int k = 0; k < 3; ++k) {
+                min[k] = std::min(min[k], v.data[k]);
+                max[k] = std::max(max[k], v.data[k]);
+            }
+            empty = false;
+        }
+    }
+    if (empty) {return min_bins;}
+
+    double diagonal = 0;
+    for (unsigned int k = 0; k < 3; ++k) {
+        double extent = double(max[k]) - double(min[k]);
+        diagonal += extent*extent;
+    }
+
+    return std::max(min_bins, get_required_bins(std::sqrt(diagonal), axis));
+}
\ No newline at end of file
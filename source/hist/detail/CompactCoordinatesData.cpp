@@ -9,8 +9,6 @@ For more information, please refer to the LICENSE file in the project root.
 
 using namespace hist::detail;
 
-constexpr float inv_width = constants::axes::d_inv_width;
-
 CompactCoordinatesData::CompactCoordinatesData() : data(std::array<float, 4>({0, 0, 0, 0})) {}
 
 EvaluatedResult CompactCoordinatesData::evaluate(const CompactCoordinatesData& other) const {
@@ -21,11 +19,11 @@ EvaluatedResult CompactCoordinatesData::evaluate(const CompactCoordinatesData& o
     #endif
 }
 
-EvaluatedResultRounded CompactCoordinatesData::evaluate_rounded(const CompactCoordinatesData& other) const {
+EvaluatedResultRounded CompactCoordinatesData::evaluate_rounded(const CompactCoordinatesData& other, float inv_width) const {
     #if defined __SSE2__
-        return evaluate_rounded_sse(other);
+        return evaluate_rounded_sse(other, inv_width);
     #else
-        return evaluate_rounded_scalar(other);
+        return evaluate_rounded_scalar(other, inv_width);
     #endif
 }
 
@@ -39,13 +37,13 @@ QuadEvaluatedResult CompactCoordinatesData::evaluate(const CompactCoordinatesDat
     #endif
 }
 
-QuadEvaluatedResultRounded CompactCoordinatesData::evaluate_rounded(const CompactCoordinatesData& v1, const CompactCoordinatesData& v2, const CompactCoordinatesData& v3, const CompactCoordinatesData& v4) const {
+QuadEvaluatedResultRounded CompactCoordinatesData::evaluate_rounded(const CompactCoordinatesData& v1, const CompactCoordinatesData& v2, const CompactCoordinatesData& v3, const CompactCoordinatesData& v4, float inv_width) const {
     #if defined __AVX__
-        return evaluate_rounded_avx(v1, v2, v3, v4);
+        return evaluate_rounded_avx(v1, v2, v3, v4, inv_width);
     #elif defined __SSE2__
-        return evaluate_rounded_sse(v1, v2, v3, v4);
+        return evaluate_rounded_sse(v1, v2, v3, v4, inv_width);
     #else
-        return evaluate_rounded_scalar(v1, v2, v3, v4);
+        return evaluate_rounded_scalar(v1, v2, v3, v4, inv_width);
     #endif
 }
 
@@ -59,13 +57,13 @@ OctoEvaluatedResult CompactCoordinatesData::evaluate(const CompactCoordinatesDat
     #endif
 }
 
-OctoEvaluatedResultRounded CompactCoordinatesData::evaluate_rounded(const CompactCoordinatesData& v1, const CompactCoordinatesData& v2, const CompactCoordinatesData& v3, const CompactCoordinatesData& v4, const CompactCoordinatesData& v5, const CompactCoordinatesData& v6, const CompactCoordinatesData& v7, const CompactCoordinatesData& v8) const {
+OctoEvaluatedResultRounded CompactCoordinatesData::evaluate_rounded(const CompactCoordinatesData& v1, const CompactCoordinatesData& v2, const CompactCoordinatesData& v3, const CompactCoordinatesData& v4, const CompactCoordinatesData& v5, const CompactCoordinatesData& v6, const CompactCoordinatesData& v7, const CompactCoordinatesData& v8, float inv_width) const {
     #if defined __AVX__
-        return evaluate_rounded_avx(v1, v2, v3, v4, v5, v6, v7, v8);
+        return evaluate_rounded_avx(v1, v2, v3, v4, v5, v6, v7, v8, inv_width);
     #elif defined __SSE2__
-        return evaluate_rounded_sse(v1, v2, v3, v4, v5, v6, v7, v8);
+        return evaluate_rounded_sse(v1, v2, v3, v4, v5, v6, v7, v8, inv_width);
     #else
-        return evaluate_rounded_scalar(v1, v2, v3, v4, v5, v6, v7, v8);
+        return evaluate_rounded_scalar(v1, v2, v3, v4, v5, v6, v7, v8, inv_width);
     #endif
 }
 
@@ -81,7 +79,7 @@ EvaluatedResult CompactCoordinatesData::evaluate_scalar(const CompactCoordinates
     return EvaluatedResult(dist, value.w*other.value.w);
 }
 
-EvaluatedResultRounded CompactCoordinatesData::evaluate_rounded_scalar(const CompactCoordinatesData& other) const {
+EvaluatedResultRounded CompactCoordinatesData::evaluate_rounded_scalar(const CompactCoordinatesData& other, float inv_width) const {
     int32_t dist = std::round(inv_width*std::sqrt(squared_dot_product(this->data.data(), other.data.data())));
     return EvaluatedResultRounded(dist, value.w*other.value.w);
 }
@@ -97,7 +95,7 @@ QuadEvaluatedResult CompactCoordinatesData::evaluate_scalar(const CompactCoordin
     );
 }
 
-QuadEvaluatedResultRounded CompactCoordinatesData::evaluate_rounded_scalar(const CompactCoordinatesData& v1, const CompactCoordinatesData& v2, const CompactCoordinatesData& v3, const CompactCoordinatesData& v4) const {
+QuadEvaluatedResultRounded CompactCoordinatesData::evaluate_rounded_scalar(const CompactCoordinatesData& v1, const CompactCoordinatesData& v2, const CompactCoordinatesData& v3, const CompactCoordinatesData& v4, float inv_width) const {
     int32_t dx1 = std::round(inv_width*std::sqrt(squared_dot_product(this->data.data(), v1.data.data())));
     int32_t dx2 = std::round(inv_width*std::sqrt(squared_dot_product(this->data.data(), v2.data.data())));
     int32_t dx3 = std::round(inv_width*std::sqrt(squared_dot_product(this->data.data(), v3.data.data())));
@@ -123,7 +121,7 @@ OctoEvaluatedResult CompactCoordinatesData::evaluate_scalar(const CompactCoordin
     );
 }
 
-OctoEvaluatedResultRounded CompactCoordinatesData::evaluate_rounded_scalar(const CompactCoordinatesData& v1, const CompactCoordinatesData& v2, const CompactCoordinatesData& v3, const CompactCoordinatesData& v4, const CompactCoordinatesData& v5, const CompactCoordinatesData& v6, const CompactCoordinatesData& v7, const CompactCoordinatesData& v8) const {
+OctoEvaluatedResultRounded CompactCoordinatesData::evaluate_rounded_scalar(const CompactCoordinatesData& v1, const CompactCoordinatesData& v2, const CompactCoordinatesData& v3, const CompactCoordinatesData& v4, const CompactCoordinatesData& v5, const CompactCoordinatesData& v6, const CompactCoordinatesData& v7, const CompactCoordinatesData& v8, float inv_width) const {
     int32_t dx1 = std::round(inv_width*std::sqrt(squared_dot_product(this->data.data(), v1.data.data())));
     int32_t dx2 = std::round(inv_width*std::sqrt(squared_dot_product(this->data.data(), v2.data.data())));
     int32_t dx3 = std::round(inv_width*std::sqrt(squared_dot_product(this->data.data(), v3.data.data())));
@@ -181,7 +179,7 @@ OctoEvaluatedResultRounded CompactCoordinatesData::evaluate_rounded_scalar(const
         return EvaluatedResult(dist, this->value.w*other.value.w);
     }
 
-    EvaluatedResultRounded CompactCoordinatesData::evaluate_rounded_sse(const CompactCoordinatesData& other) const {
+    EvaluatedResultRounded CompactCoordinatesData::evaluate_rounded_sse(const CompactCoordinatesData& other, float inv_width) const {
         __m128 dist2 = squared_dot_product(this->data.data(), other.data.data(), OutputControl::ALL);
         __m128 dist_sqrt = _mm_sqrt_ps(dist2);
         int32_t dist_bin = std::round(inv_width*_mm_cvtss_f32(dist_sqrt));
@@ -211,7 +209,7 @@ OctoEvaluatedResultRounded CompactCoordinatesData::evaluate_rounded_scalar(const
         return result;
     }
 
-    QuadEvaluatedResultRounded CompactCoordinatesData::evaluate_rounded_sse(const CompactCoordinatesData& v1, const CompactCoordinatesData& v2, const CompactCoordinatesData& v3, const CompactCoordinatesData& v4) const {
+    QuadEvaluatedResultRounded CompactCoordinatesData::evaluate_rounded_sse(const CompactCoordinatesData& v1, const CompactCoordinatesData& v2, const CompactCoordinatesData& v3, const CompactCoordinatesData& v4, float inv_width) const {
         __m128 dist2_1 = squared_dot_product(this->data.data(), v1.data.data(), OutputControl::FIRST);
         __m128 dist2_2 = squared_dot_product(this->data.data(), v2.data.data(), OutputControl::SECOND);
         __m128 dist2_3 = squared_dot_product(this->data.data(), v3.data.data(), OutputControl::THIRD);
@@ -277,7 +275,7 @@ OctoEvaluatedResultRounded CompactCoordinatesData::evaluate_rounded_scalar(const
         return result;
     }
 
-    OctoEvaluatedResultRounded CompactCoordinatesData::evaluate_rounded_sse(const CompactCoordinatesData& v1, const CompactCoordinatesData& v2, const CompactCoordinatesData& v3, const CompactCoordinatesData& v4, const CompactCoordinatesData& v5, const CompactCoordinatesData& v6, const CompactCoordinatesData& v7, const CompactCoordinatesData& v8) const {
+    OctoEvaluatedResultRounded CompactCoordinatesData::evaluate_rounded_sse(const CompactCoordinatesData& v1, const CompactCoordinatesData& v2, const CompactCoordinatesData& v3, const CompactCoordinatesData& v4, const CompactCoordinatesData& v5, const CompactCoordinatesData& v6, const CompactCoordinatesData& v7, const CompactCoordinatesData& v8, float inv_width) const {
         OctoEvaluatedResultRounded result;
         {   // first four
             __m128 dist2_1 = squared_dot_product(this->data.data(), v1.data.data(), OutputControl::FIRST);
@@ -352,8 +350,8 @@ OctoEvaluatedResultRounded CompactCoordinatesData::evaluate_rounded_scalar(const
         return evaluate_sse(other); // no way to optimize a single evaluation with AVX
     }
 
-    EvaluatedResultRounded CompactCoordinatesData::evaluate_rounded_avx(const CompactCoordinatesData& other) const {
-        return evaluate_rounded_sse(other); // no way to optimize a single evaluation with AVX
+    EvaluatedResultRounded CompactCoordinatesData::evaluate_rounded_avx(const CompactCoordinatesData& other, float inv_width) const {
+        return evaluate_rounded_sse(other, inv_width); // no way to optimize a single evaluation with AVX
     }
 
     QuadEvaluatedResult CompactCoordinatesData::evaluate_avx(const CompactCoordinatesData& v1, const CompactCoordinatesData& v2, const CompactCoordinatesData& v3, const CompactCoordinatesData& v4) const {
@@ -377,7 +375,7 @@ OctoEvaluatedResultRounded CompactCoordinatesData::evaluate_rounded_scalar(const
         return result;
     }
 
-    QuadEvaluatedResultRounded CompactCoordinatesData::evaluate_rounded_avx(const CompactCoordinatesData& v1, const CompactCoordinatesData& v2, const CompactCoordinatesData& v3, const CompactCoordinatesData& v4) const {
+    QuadEvaluatedResultRounded CompactCoordinatesData::evaluate_rounded_avx(const CompactCoordinatesData& v1, const CompactCoordinatesData& v2, const CompactCoordinatesData& v3, const CompactCoordinatesData& v4, float inv_width) const {
         __m256 dist2_1 = squared_dot_product(this->data.data(), v1.data.data(), v3.data.data(), OutputControl::FIRST); // |Δx1^2|0    |0    |0    |Δx3^2|0    |0    |0    |
         __m256 dist2_2 = squared_dot_product(this->data.data(), v2.data.data(), v4.data.data(), OutputControl::SECOND);// |0    |Δx2^2|0    |0    |0    |Δx4^2|0    |0    |
 
@@ -421,7 +419,7 @@ OctoEvaluatedResultRounded CompactCoordinatesData::evaluate_rounded_scalar(const
         return result;
     }
 
-    OctoEvaluatedResultRounded CompactCoordinatesData::evaluate_rounded_avx(const CompactCoordinatesData& v1, const CompactCoordinatesData& v2, const CompactCoordinatesData& v3, const CompactCoordinatesData& v4, const CompactCoordinatesData& v5, const CompactCoordinatesData& v6, const CompactCoordinatesData& v7, const CompactCoordinatesData& v8) const {
+    OctoEvaluatedResultRounded CompactCoordinatesData::evaluate_rounded_avx(const CompactCoordinatesData& v1, const CompactCoordinatesData& v2, const CompactCoordinatesData& v3, const CompactCoordinatesData& v4, const CompactCoordinatesData& v5, const CompactCoordinatesData& v6, const CompactCoordinatesData& v7, const CompactCoordinatesData& v8, float inv_width) const {
         __m256 dist2_1 = squared_dot_product(this->data.data(), v1.data.data(), v5.data.data(), OutputControl::FIRST); // |Δx1^2|0    |0    |0    |Δx5^2|0    |0    |0    |
         __m256 dist2_2 = squared_dot_product(this->data.data(), v2.data.data(), v6.data.data(), OutputControl::SECOND);// |0    |Δx2^2|0    |0    |0    |Δx6^2|0    |0    |
         __m256 dist2_3 = squared_dot_product(this->data.data(), v3.data.data(), v7.data.data(), OutputControl::THIRD); // |0    |0    |Δx3^2|0    |0    |0    |Δx7^2|0    |
@@ -24,7 +24,7 @@ CompactCoordinatesFF::CompactCoordinatesFF(const data::Body& body) : CompactCoor
 #include <form_factor/ExvFormFactor.h>
 #include <hist/foxs/FormFactorFoXS.h>
 #include <fstream>
-CompactCoordinatesFF::CompactCoordinatesFF(const std::vector<data::Body>& bodies) : CompactCoordinates(std::accumulate(bodies.begin(), bodies.end(), 0, [](unsigned int sum, const data::Body& body) {return sum + body.atom_size();})) {
+CompactCoordinatesFF::CompactCoordinatesFF(const std::vector<data::Body>& bodies) : CompactCoordinates(std::accumulate(bodies.begin(), bodies.end(), std::size_t(0), [](std::size_t sum, const data::Body& body) {return sum + body.atom_size();})) {
     ff_types.resize(size());
     unsigned int i = 0;
     for (const auto& body : bodies) {
@@ -0,0 +1,55 @@
+/*
+This software is distributed under the GNU General Public License v3.0. 
+For more information, please refer to the LICENSE file in the project root.
+*/
+
+#include <hist/detail/DistanceAxis.h>
+#include <settings/HistogramSettings.h>
+#include <constants/Axes.h>
+#include <utility/Exceptions.h>
+
+#include <cmath>
+
+namespace {
+    void validate_settings() {
+        double width = settings::axes::distance_bin_width;
+        double max = settings::axes::max_distance;
+        if (width <= 0 || max < width) {
+            throw except::invalid_argument(
+                "hist::detail::get_distance_axis: Invalid distance axis with bin width " + std::to_string(width) + " and maximum distance " + std::to_string(max) + "."
+            );
+        }
+    }
+}
+
+Axis hist::detail::get_distance_axis() {
+    validate_settings();
+    double width = settings::axes::distance_bin_width;
+    int bins = static_cast<int>(std::ceil(settings::axes::max_distance/width - 1e-6));
+    return Axis(0, bins*width, bins);
+}
+
+double hist::detail::get_bin_width() {
+    validate_settings();
+    return settings::axes::distance_bin_width;
+}
+
+float hist::detail::get_inv_bin_width() {
+    return static_cast<float>(1./get_bin_width());
+}
+
+unsigned int hist::detail::get_required_bins(double distance, const Axis& axis) {
+    // distances are rounded to the nearest bin, and the extra bin covers the rounding errors of the single-precision distances
+    double bins = std::ceil(distance/axis.width()) + 2;
+    if (axis.bins < bins) {
+        throw except::size_error(
+            "hist::detail::get_required_bins: The largest distance of " + std::to_string(distance) + " Å does not fit on the distance axis. "
+            "Increase settings::axes::max_distance to at least " + std::to_string(bins*axis.width()) + " Å."
+        );
+    }
+    return static_cast<unsigned int>(bins);
+}
+
+bool hist::detail::is_default_bin_width(double width) noexcept {
+    return std::abs(width - constants::axes::d_axis.width()) < 1e-9*constants::axes::d_axis.width();
+}
\ No newline at end of file
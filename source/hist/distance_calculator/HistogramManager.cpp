@@ -12,10 +12,12 @@ For more information, please refer to the LICENSE file in the project root.
 #include <hist/intensity_calculator/DistanceHistogram.h>
 #include <hist/intensity_calculator/CompositeDistanceHistogram.h>
 #include <hist/detail/CompactCoordinates.h>
+#include <hist/detail/DistanceAxis.h>
 #include <hist/distribution/GenericDistribution1D.h>
 #include <settings/HistogramSettings.h>
 #include <constants/Axes.h>
 #include <hist/distance_calculator/detail/TemplateHelpers.h>
+#include <utility/Trace.h>
 
 using namespace hist;
 
@@ -33,16 +35,19 @@ std::unique_ptr<DistanceHistogram> HistogramManager<use_weighted_distribution>::
 
 template<bool use_weighted_distribution>
 std::unique_ptr<ICompositeDistanceHistogram> HistogramManager<use_weighted_distribution>::calculate_all() {
+    TRACE_ZONE("HistogramManager::calculate_all");
     using GenericDistribution1D_t = typename hist::GenericDistribution1D<use_weighted_distribution>::type;
-    GenericDistribution1D_t p_aa(constants::axes::d_axis.bins);
-    GenericDistribution1D_t p_ww(constants::axes::d_axis.bins);
-    GenericDistribution1D_t p_aw(constants::axes::d_axis.bins);
-
     hist::detail::CompactCoordinates data_a(protein->get_bodies());
     hist::detail::CompactCoordinates data_w = hist::detail::CompactCoordinates(protein->get_waters());
     int data_a_size = (int) data_a.size();
     int data_w_size = (int) data_w.size();
 
+    // the histograms only need to cover the largest distance of this molecule
+    const unsigned int bins = hist::detail::get_required_bins({data_a, data_w});
+    GenericDistribution1D_t p_aa(bins);
+    GenericDistribution1D_t p_ww(bins);
+    GenericDistribution1D_t p_aw(bins);
+
     // calculate aa distances
     for (int i = 0; i < data_a_size; ++i) {
         int j = i+1;
@@ -98,7 +103,7 @@ std::unique_ptr<ICompositeDistanceHistogram> HistogramManager<use_weighted_distr
     p_ww.add(0, std::accumulate(data_w.get_data().begin(), data_w.get_data().end(), 0.0, [](double sum, const hist::detail::CompactCoordinatesData& val) {return sum + std::pow(val.value.w, 2);}));
 
     // calculate p_tot
-    GenericDistribution1D_t p_tot(constants::axes::d_axis.bins);
+    GenericDistribution1D_t p_tot(bins);
     for (int i = 0; i < (int) p_aa.size(); ++i) {p_tot.index(i) = p_aa.index(i) + p_ww.index(i) + 2*p_aw.index(i);}
 
     // downsize our axes to only the relevant area
@@ -0,0 +1,269 @@
+/*
+This software is distributed under the GNU General Public License v3.0. 
+For more information, please refer to the LICENSE file in the project root.
+*/
+
+#include <hist/distance_calculator/HistogramManagerMP.h>
+#include <hist/intensity_calculator/DistanceHistogram.h>
+#include <hist/intensity_calculator/CompositeDistanceHistogram.h>
+#include <hist/distribution/GenericDistribution1D.h>
+#include <hist/detail/CompactCoordinates.h>
+#include <hist/detail/DistanceAxis.h>
+#include <hist/distance_calculator/detail/TemplateHelpers.h>
+#include <utility/Memory.h>
+#include <utility/Exceptions.h>
+#include <data/Molecule.h>
+#include <settings/GeneralSettings.h>
+#include <utility/Trace.h>
+
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+#include <type_traits>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+    #include <sys/mman.h>
+    #include <sys/wait.h>
+    #include <unistd.h>
+    #include <cerrno>
+#endif
+
+using namespace hist;
+
+#if defined(__unix__) || defined(__APPLE__)
+namespace {
+    /**
+     * @brief An anonymous memory segment which is shared with all processes forked while it is alive.
+     */
+    class SharedSegment {
+        public:
+            SharedSegment(std::size_t bytes) : bytes(bytes), account(utility::memory::Subsystem::Histogram, bytes) {
+                data = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+                if (data == MAP_FAILED) {
+                    throw except::unexpected("HistogramManagerMP::SharedSegment: Could not map " + std::to_string(bytes) + " bytes of shared memory.");
+                }
+            }
+            ~SharedSegment() {::munmap(data, bytes);}
+
+            SharedSegment(const SharedSegment&) = delete;
+            SharedSegment& operator=(const SharedSegment&) = delete;
+
+            void* get() const {return data;}
+
+        private:
+            void* data;
+            std::size_t bytes;
+            utility::memory::Account account;
+    };
+
+    /**
+     * @brief Split the rows [0, n) into @a parts contiguous tiles with roughly the same number of pairs each. Some tiles may be empty.
+     *
+     * @param triangle Whether row i is only paired with the rows after it, or with a fixed number of elements.
+     * @return The @a parts + 1 boundaries of the tiles.
+     */
+    std::vector<int> split(int n, unsigned int parts, bool triangle) {
+        auto pairs = [n, triangle] (long long rows) {return triangle ? rows*n - rows*(rows+1)/2 : rows;};
+        long long total = pairs(n);
+        std::vector<int> bounds(1, 0);
+        int row = 0;
+        for (unsigned int k = 1; k < parts; ++k) {
+            long long target = total*k/parts;
+            while (row < n && pairs(row) < target) {++row;}
+            bounds.push_back(row);
+        }
+        bounds.push_back(n);
+        return bounds;
+    }
+}
+#endif
+
+template<bool use_weighted_distribution>
+HistogramManagerMP<use_weighted_distribution>::~HistogramManagerMP() = default;
+
+template<bool use_weighted_distribution>
+std::unique_ptr<DistanceHistogram> HistogramManagerMP<use_weighted_distribution>::calculate() {return calculate_all();}
+
+template<bool use_weighted_distribution>
+std::unique_ptr<ICompositeDistanceHistogram> HistogramManagerMP<use_weighted_distribution>::calculate_all() {
+#if defined(__unix__) || defined(__APPLE__)
+    TRACE_ZONE("HistogramManagerMP::calculate_all");
+    using GenericDistribution1D_t = typename hist::GenericDistribution1D<use_weighted_distribution>::type;
+    using entry_t = std::decay_t<decltype(std::declval<GenericDistribution1D_t&>().index(0))>;
+    static_assert(std::is_trivially_copyable_v<entry_t>, "HistogramManagerMP: The bins must be trivially copyable to be shared between processes.");
+    const unsigned int processes = std::max(1u, settings::general::processes == 0 ? settings::general::threads : settings::general::processes);
+
+    this->data_a_ptr = std::make_unique<hist::detail::CompactCoordinates>(this->protein->get_bodies());
+    this->data_w_ptr = std::make_unique<hist::detail::CompactCoordinates>(this->protein->get_waters());
+    auto& data_a = *this->data_a_ptr;
+    auto& data_w = *this->data_w_ptr;
+    int data_a_size = (int) data_a.size();
+    int data_w_size = (int) data_w.size();
+
+    // the histograms only need to cover the largest distance of this molecule
+    const unsigned int bins = hist::detail::get_required_bins({data_a, data_w});
+
+    //#################//
+    // PREPARE WORKERS //
+    //#################//
+    // the tiles are fixed by the number of processes, such that the result does not depend on the scheduling of the workers
+    auto tiles_aa = split(data_a_size, processes, true);
+    auto tiles_aw = split(data_w_size, processes, false);
+    auto tiles_ww = split(data_w_size, processes, true);
+
+    // each worker writes its three partial histograms to its own slots of the shared segment
+    SharedSegment segment(std::size_t(processes)*3*bins*sizeof(entry_t));
+    auto slot = [&segment, bins] (unsigned int worker, unsigned int part) {
+        return static_cast<entry_t*>(segment.get()) + (std::size_t(worker)*3 + part)*bins;
+    };
+
+    // the histograms are allocated before forking, since the workers must not allocate:
+    // the allocator may be locked by another thread of the caller at the time of the fork
+    GenericDistribution1D_t p_aa(bins), p_aw(bins), p_ww(bins);
+    auto calc_tile = [&] (unsigned int k) {
+        std::fill(p_aa.begin(), p_aa.end(), entry_t{});
+        std::fill(p_aw.begin(), p_aw.end(), entry_t{});
+        std::fill(p_ww.begin(), p_ww.end(), entry_t{});
+
+        for (int i = tiles_aa[k]; i < tiles_aa[k+1]; ++i) { // atom
+            int j = i+1;                                    // atom
+            for (; j+7 < data_a_size; j+=8) {
+                evaluate8<use_weighted_distribution, 2>(p_aa, data_a, data_a, i, j);
+            }
+
+            for (; j+3 < data_a_size; j+=4) {
+                evaluate4<use_weighted_distribution, 2>(p_aa, data_a, data_a, i, j);
+            }
+
+            for (; j < data_a_size; ++j) {
+                evaluate1<use_weighted_distribution, 2>(p_aa, data_a, data_a, i, j);
+            }
+        }
+
+        for (int i = tiles_aw[k]; i < tiles_aw[k+1]; ++i) { // water
+            int j = 0;                                      // atom
+            for (; j+7 < data_a_size; j+=8) {
+                evaluate8<use_weighted_distribution, 1>(p_aw, data_w, data_a, i, j);
+            }
+
+            for (; j+3 < data_a_size; j+=4) {
+                evaluate4<use_weighted_distribution, 1>(p_aw, data_w, data_a, i, j);
+            }
+
+            for (; j < data_a_size; ++j) {
+                evaluate1<use_weighted_distribution, 1>(p_aw, data_w, data_a, i, j);
+            }
+        }
+
+        for (int i = tiles_ww[k]; i < tiles_ww[k+1]; ++i) { // water
+            int j = i+1;                                    // water
+            for (; j+7 < data_w_size; j+=8) {
+                evaluate8<use_weighted_distribution, 2>(p_ww, data_w, data_w, i, j);
+            }
+
+            for (; j+3 < data_w_size; j+=4) {
+                evaluate4<use_weighted_distribution, 2>(p_ww, data_w, data_w, i, j);
+            }
+
+            for (; j < data_w_size; ++j) {
+                evaluate1<use_weighted_distribution, 2>(p_ww, data_w, data_w, i, j);
+            }
+        }
+
+        std::memcpy(slot(k, 0), p_aa.get_data().data(), bins*sizeof(entry_t));
+        std::memcpy(slot(k, 1), p_aw.get_data().data(), bins*sizeof(entry_t));
+        std::memcpy(slot(k, 2), p_ww.get_data().data(), bins*sizeof(entry_t));
+    };
+
+    //################//
+    // FORK & COLLECT //
+    //################//
+    // the caller calculates the first tile itself, and any tile whose worker could not be forked
+    std::vector<pid_t> workers;
+    std::vector<unsigned int> local_tiles(1, 0);
+    for (unsigned int k = 1; k < processes; ++k) {
+        pid_t pid = ::fork();
+        if (pid == 0) {
+            try {
+                calc_tile(k);
+            } catch (...) {
+                ::_exit(1);
+            }
+            ::_exit(0);
+        }
+        if (pid == -1) {local_tiles.push_back(k);}
+        else {workers.push_back(pid);}
+    }
+    for (unsigned int k : local_tiles) {calc_tile(k);}
+
+    bool failed = false;
+    for (pid_t pid : workers) {
+        int status;
+        while (::waitpid(pid, &status, 0) == -1) {
+            if (errno != EINTR) {status = -1; break;}
+        }
+        failed |= !WIFEXITED(status) || WEXITSTATUS(status) != 0;
+    }
+    if (failed) {throw except::unexpected("HistogramManagerMP::calculate_all: A worker process failed.");}
+
+    // reduce the partial histograms in a fixed order
+    std::fill(p_aa.begin(), p_aa.end(), entry_t{});
+    std::fill(p_aw.begin(), p_aw.end(), entry_t{});
+    std::fill(p_ww.begin(), p_ww.end(), entry_t{});
+    for (unsigned int k = 0; k < processes; ++k) {
+        const entry_t* s_aa = slot(k, 0);
+        const entry_t* s_aw = slot(k, 1);
+        const entry_t* s_ww = slot(k, 2);
+        for (unsigned int i = 0; i < bins; ++i) {
+            p_aa.index(i) += s_aa[i];
+            p_aw.index(i) += s_aw[i];
+            p_ww.index(i) += s_ww[i];
+        }
+    }
+
+    //###################//
+    // SELF-CORRELATIONS //
+    //###################//
+    p_aa.add(0, std::accumulate(data_a.get_data().begin(), data_a.get_data().end(), 0.0, [](double sum, const hist::detail::CompactCoordinatesData& val) {return sum + val.value.w*val.value.w;} ));
+    p_ww.add(0, std::accumulate(data_w.get_data().begin(), data_w.get_data().end(), 0.0, [](double sum, const hist::detail::CompactCoordinatesData& val) {return sum + val.value.w*val.value.w;} ));
+
+    // calculate p_tot
+    GenericDistribution1D_t p_tot(bins);
+    for (unsigned int i = 0; i < p_tot.size(); ++i) {p_tot.index(i) = p_aa.index(i) + p_ww.index(i) + 2*p_aw.index(i);}
+
+    // downsize our axes to only the relevant area
+    unsigned int max_bin = 10; // minimum size is 10
+    for (int i = p_tot.size()-1; i >= 10; i--) {
+        if (p_tot.index(i) != 0) {
+            max_bin = i+1; // +1 since we usually use this for looping (i.e. i < max_bin)
+            break;
+        }
+    }
+    p_aa.resize(max_bin);
+    p_ww.resize(max_bin);
+    p_aw.resize(max_bin);
+    p_tot.resize(max_bin);
+
+    if constexpr (use_weighted_distribution) {
+        return std::make_unique<CompositeDistanceHistogram>(
+            std::move(Distribution1D(p_aa)),
+            std::move(Distribution1D(p_aw)),
+            std::move(Distribution1D(p_ww)),
+            std::move(p_tot)
+        );
+    } else {
+        return std::make_unique<CompositeDistanceHistogram>(
+            std::move(p_aa),
+            std::move(p_aw),
+            std::move(p_ww),
+            std::move(p_tot)
+        );
+    }
+#else
+    return HistogramManagerMT<use_weighted_distribution>::calculate_all();
+#endif
+}
+
+template class hist::HistogramManagerMP<false>;
+template class hist::HistogramManagerMP<true>;
\ No newline at end of file
@@ -8,12 +8,18 @@ For more information, please refer to the LICENSE file in the project root.
 #include <hist/intensity_calculator/CompositeDistanceHistogram.h>
 #include <hist/distribution/GenericDistribution1D.h>
 #include <hist/detail/CompactCoordinates.h>
+#include <hist/detail/DistanceAxis.h>
 #include <hist/distance_calculator/detail/TemplateHelpers.h>
 #include <container/ThreadLocalWrapper.h>
+#include <utility/Memory.h>
 #include <data/Molecule.h>
 #include <settings/GeneralSettings.h>
 #include <constants/Axes.h>
 #include <utility/MultiThreading.h>
+#include <utility/Trace.h>
+
+#include <limits>
+#include <cstdint>
 
 using namespace hist;
 
@@ -25,8 +31,9 @@ std::unique_ptr<DistanceHistogram> HistogramManagerMT<use_weighted_distribution>
 
 template<bool use_weighted_distribution>
 std::unique_ptr<ICompositeDistanceHistogram> HistogramManagerMT<use_weighted_distribution>::calculate_all() {
+    TRACE_ZONE("HistogramManagerMT::calculate_all");
     using GenericDistribution1D_t = typename hist::GenericDistribution1D<use_weighted_distribution>::type;
-    auto pool = utility::multi_threading::get_global_pool();
+    utility::multi_threading::TaskGroup tasks;
 
     // create a more compact representation of the coordinates
     // extremely wasteful to calculate this from scratch every time (class is not meant for serial use anyway?)
@@ -37,10 +44,23 @@ std::unique_ptr<ICompositeDistanceHistogram> HistogramManagerMT<use_weighted_dis
     int data_a_size = (int) data_a.size();
     int data_w_size = (int) data_w.size();
 
+    // if the atoms and waters each share a single weight, it is enough to count the pairs
+    if constexpr (!use_weighted_distribution) {
+        if (data_a.has_uniform_weight() && data_w.has_uniform_weight()) {
+            // no single bin can receive more counts than the square of the largest set
+            std::size_t n = std::max(data_a.size(), data_w.size());
+            if (n*n <= std::numeric_limits<std::uint32_t>::max()) {return calculate_uniform<std::uint32_t>();}
+            return calculate_uniform<std::uint64_t>();
+        }
+    }
+
+    // the histograms only need to cover the largest distance of this molecule
+    const unsigned int bins = hist::detail::get_required_bins({data_a, data_w});
+
     //########################//
     // PREPARE MULTITHREADING //
     //########################//
-    container::ThreadLocalWrapper<GenericDistribution1D_t> p_aa_all(constants::axes::d_axis.bins);
+    container::ThreadLocalWrapper<GenericDistribution1D_t> p_aa_all(bins);
     auto calc_aa = [&data_a, &p_aa_all, data_a_size] (int imin, int imax) {
         auto& p_aa = p_aa_all.get();
         for (int i = imin; i < imax; ++i) { // atom
@@ -59,7 +79,7 @@ std::unique_ptr<ICompositeDistanceHistogram> HistogramManagerMT<use_weighted_dis
         }
     };
 
-    container::ThreadLocalWrapper<GenericDistribution1D_t> p_aw_all(constants::axes::d_axis.bins);
+    container::ThreadLocalWrapper<GenericDistribution1D_t> p_aw_all(bins);
     auto calc_aw = [&data_w, &data_a, &p_aw_all, data_a_size] (int imin, int imax) {
         auto& p_aw = p_aw_all.get();
         for (int i = imin; i < imax; ++i) { // water
@@ -78,7 +98,7 @@ std::unique_ptr<ICompositeDistanceHistogram> HistogramManagerMT<use_weighted_dis
         }
     };
     
-    container::ThreadLocalWrapper<GenericDistribution1D_t> p_ww_all(constants::axes::d_axis.bins);
+    container::ThreadLocalWrapper<GenericDistribution1D_t> p_ww_all(bins);
     auto calc_ww = [&data_w, &p_ww_all, data_w_size] (int imin, int imax) {
         auto& p_ww = p_ww_all.get();
         for (int i = imin; i < imax; ++i) { // water
@@ -100,24 +120,28 @@ std::unique_ptr<ICompositeDistanceHistogram> HistogramManagerMT<use_weighted_dis
     //##############//
     // SUBMIT TASKS //
     //##############//
-    int job_size = settings::general::detail::job_size;
-    for (int i = 0; i < (int) data_a_size; i+=job_size) {
-        pool->detach_task(
-            [&calc_aa, i, job_size, data_a_size] () {calc_aa(i, std::min(i+job_size, data_a_size));}
+    // each job may create its own thread-local copy of the histograms, so the job sizes are increased if the copies of all three loops would not fit in the memory budget
+    auto job_sizes = utility::memory::job_sizes({{data_a_size, p_aa_all.instance_bytes()}, {data_w_size, p_aw_all.instance_bytes()}, {data_w_size, p_ww_all.instance_bytes()}});
+    int job_size_aa = job_sizes[0];
+    int job_size_aw = job_sizes[1];
+    int job_size_ww = job_sizes[2];
+    for (int i = 0; i < (int) data_a_size; i+=job_size_aa) {
+        tasks.run(
+            [&calc_aa, i, job_size_aa, data_a_size] () {calc_aa(i, std::min(i+job_size_aa, data_a_size));}
         );
     }
-    for (int i = 0; i < (int) data_w_size; i+=job_size) {
-        pool->detach_task(
-            [&calc_aw, i, job_size, data_w_size] () {calc_aw(i, std::min(i+job_size, data_w_size));}
+    for (int i = 0; i < (int) data_w_size; i+=job_size_aw) {
+        tasks.run(
+            [&calc_aw, i, job_size_aw, data_w_size] () {calc_aw(i, std::min(i+job_size_aw, data_w_size));}
         );
     }
-    for (int i = 0; i < (int) data_w_size; i+=job_size) {
-        pool->detach_task(
-            [&calc_ww, i, job_size, data_w_size] () {calc_ww(i, std::min(i+job_size, data_w_size));}
+    for (int i = 0; i < (int) data_w_size; i+=job_size_ww) {
+        tasks.run(
+            [&calc_ww, i, job_size_ww, data_w_size] () {calc_ww(i, std::min(i+job_size_ww, data_w_size));}
         );
     }
 
-    pool->wait();
+    tasks.wait();
     GenericDistribution1D_t p_aa = p_aa_all.merge();
     GenericDistribution1D_t p_aw = p_aw_all.merge();
     GenericDistribution1D_t p_ww = p_ww_all.merge();
@@ -129,7 +153,7 @@ std::unique_ptr<ICompositeDistanceHistogram> HistogramManagerMT<use_weighted_dis
     p_ww.add(0, std::accumulate(data_w.get_data().begin(), data_w.get_data().end(), 0.0, [](double sum, const hist::detail::CompactCoordinatesData& val) {return sum + val.value.w*val.value.w;} ));
 
     // calculate p_tot
-    GenericDistribution1D_t p_tot(constants::axes::d_axis.bins);
+    GenericDistribution1D_t p_tot(bins);
     for (unsigned int i = 0; i < p_tot.size(); ++i) {p_tot.index(i) = p_aa.index(i) + p_ww.index(i) + 2*p_aw.index(i);}
 
     // downsize our axes to only the relevant area
@@ -162,5 +186,145 @@ std::unique_ptr<ICompositeDistanceHistogram> HistogramManagerMT<use_weighted_dis
     }
 }
 
+template<bool use_weighted_distribution> template<typename count_t>
+std::unique_ptr<ICompositeDistanceHistogram> HistogramManagerMT<use_weighted_distribution>::calculate_uniform() {
+    TRACE_ZONE("HistogramManagerMT::calculate_uniform");
+    using Counts = container::Container1D<count_t>;
+    utility::multi_threading::TaskGroup tasks;
+
+    auto& data_a = *data_a_ptr;
+    auto& data_w = *data_w_ptr;
+    int data_a_size = (int) data_a.size();
+    int data_w_size = (int) data_w.size();
+
+    // the histograms only need to cover the largest distance of this molecule
+    const unsigned int bins = hist::detail::get_required_bins({data_a, data_w});
+
+    //########################//
+    // PREPARE MULTITHREADING //
+    //########################//
+    container::ThreadLocalWrapper<Counts> c_aa_all(bins);
+    auto calc_aa = [&data_a, &c_aa_all, data_a_size] (int imin, int imax) {
+        auto& c_aa = c_aa_all.get();
+        for (int i = imin; i < imax; ++i) { // atom
+            int j = i+1;                    // atom
+            for (; j+7 < data_a_size; j+=8) {
+                count8<2>(c_aa, data_a, data_a, i, j);
+            }
+
+            for (; j+3 < data_a_size; j+=4) {
+                count4<2>(c_aa, data_a, data_a, i, j);
+            }
+
+            for (; j < data_a_size; ++j) {
+                count1<2>(c_aa, data_a, data_a, i, j);
+            }
+        }
+    };
+
+    container::ThreadLocalWrapper<Counts> c_aw_all(bins);
+    auto calc_aw = [&data_w, &data_a, &c_aw_all, data_a_size] (int imin, int imax) {
+        auto& c_aw = c_aw_all.get();
+        for (int i = imin; i < imax; ++i) { // water
+            int j = 0;                      // atom
+            for (; j+7 < data_a_size; j+=8) {
+                count8<1>(c_aw, data_w, data_a, i, j);
+            }
+
+            for (; j+3 < data_a_size; j+=4) {
+                count4<1>(c_aw, data_w, data_a, i, j);
+            }
+
+            for (; j < data_a_size; ++j) {
+                count1<1>(c_aw, data_w, data_a, i, j);
+            }
+        }
+    };
+
+    container::ThreadLocalWrapper<Counts> c_ww_all(bins);
+    auto calc_ww = [&data_w, &c_ww_all, data_w_size] (int imin, int imax) {
+        auto& c_ww = c_ww_all.get();
+        for (int i = imin; i < imax; ++i) { // water
+            int j = i+1;                    // water
+            for (; j+7 < data_w_size; j+=8) {
+                count8<2>(c_ww, data_w, data_w, i, j);
+            }
+
+            for (; j+3 < data_w_size; j+=4) {
+                count4<2>(c_ww, data_w, data_w, i, j);
+            }
+
+            for (; j < data_w_size; ++j) {
+                count1<2>(c_ww, data_w, data_w, i, j);
+            }
+        }
+    };
+
+    //##############//
+    // SUBMIT TASKS //
+    //##############//
+    auto job_sizes = utility::memory::job_sizes({{data_a_size, c_aa_all.instance_bytes()}, {data_w_size, c_aw_all.instance_bytes()}, {data_w_size, c_ww_all.instance_bytes()}});
+    int job_size_aa = job_sizes[0];
+    int job_size_aw = job_sizes[1];
+    int job_size_ww = job_sizes[2];
+    for (int i = 0; i < (int) data_a_size; i+=job_size_aa) {
+        tasks.run(
+            [&calc_aa, i, job_size_aa, data_a_size] () {calc_aa(i, std::min(i+job_size_aa, data_a_size));}
+        );
+    }
+    for (int i = 0; i < (int) data_w_size; i+=job_size_aw) {
+        tasks.run(
+            [&calc_aw, i, job_size_aw, data_w_size] () {calc_aw(i, std::min(i+job_size_aw, data_w_size));}
+        );
+    }
+    for (int i = 0; i < (int) data_w_size; i+=job_size_ww) {
+        tasks.run(
+            [&calc_ww, i, job_size_ww, data_w_size] () {calc_ww(i, std::min(i+job_size_ww, data_w_size));}
+        );
+    }
+
+    tasks.wait();
+    Counts c_aa = c_aa_all.merge();
+    Counts c_aw = c_aw_all.merge();
+    Counts c_ww = c_ww_all.merge();
+
+    //###################//
+    // SELF-CORRELATIONS //
+    //###################//
+    c_aa.index(0) += data_a_size;
+    c_ww.index(0) += data_w_size;
+
+    // scale the counts by the weights of the pairs
+    double w_a = data_a_size == 0 ? 0 : data_a[0].value.w;
+    double w_w = data_w_size == 0 ? 0 : data_w[0].value.w;
+    Distribution1D p_aa(bins), p_aw(bins), p_ww(bins), p_tot(bins);
+    for (unsigned int i = 0; i < bins; ++i) {
+        p_aa.index(i) = w_a*w_a*c_aa.index(i);
+        p_aw.index(i) = w_a*w_w*c_aw.index(i);
+        p_ww.index(i) = w_w*w_w*c_ww.index(i);
+        p_tot.index(i) = p_aa.index(i) + p_ww.index(i) + 2*p_aw.index(i);
+    }
+
+    // downsize our axes to only the relevant area
+    unsigned int max_bin = 10; // minimum size is 10
+    for (int i = p_tot.size()-1; i >= 10; i--) {
+        if (p_tot.index(i) != 0) {
+            max_bin = i+1; // +1 since we usually use this for looping (i.e. i < max_bin)
+            break;
+        }
+    }
+    p_aa.resize(max_bin);
+    p_ww.resize(max_bin);
+    p_aw.resize(max_bin);
+    p_tot.resize(max_bin);
+
+    return std::make_unique<CompositeDistanceHistogram>(
+        std::move(p_aa), 
+        std::move(p_aw), 
+        std::move(p_ww), 
+        std::move(p_tot)
+    );
+}
+
 template class hist::HistogramManagerMT<false>;
 template class hist::HistogramManagerMT<true>;
\ No newline at end of file
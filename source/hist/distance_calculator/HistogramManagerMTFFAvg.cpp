@@ -10,14 +10,17 @@ For more information, please refer to the LICENSE file in the project root.
 #include <hist/distribution/GenericDistribution3D.h>
 #include <hist/distance_calculator/detail/TemplateHelpersFFAvg.h>
 #include <container/ThreadLocalWrapper.h>
+#include <utility/Memory.h>
 #include <form_factor/FormFactorType.h>
 #include <data/Molecule.h>
 #include <data/record/Atom.h>
 #include <data/record/Water.h>
 #include <settings/HistogramSettings.h>
 #include <settings/GeneralSettings.h>
+#include <hist/detail/DistanceAxis.h>
 #include <constants/Axes.h>
 #include <utility/MultiThreading.h>
+#include <utility/Trace.h>
 
 using namespace container;
 using namespace hist;
@@ -30,10 +33,11 @@ std::unique_ptr<DistanceHistogram> HistogramManagerMTFFAvg<use_weighted_distribu
 
 template<bool use_weighted_distribution>
 std::unique_ptr<ICompositeDistanceHistogram> HistogramManagerMTFFAvg<use_weighted_distribution>::calculate_all() {
+    TRACE_ZONE("HistogramManagerMTFFAvg::calculate_all");
     using GenericDistribution1D_t = typename hist::GenericDistribution1D<use_weighted_distribution>::type;
     using GenericDistribution2D_t = typename hist::GenericDistribution2D<use_weighted_distribution>::type;
     using GenericDistribution3D_t = typename hist::GenericDistribution3D<use_weighted_distribution>::type;
-    auto pool = utility::multi_threading::get_global_pool();
+    utility::multi_threading::TaskGroup tasks;
 
     data_a_ptr = std::make_unique<hist::detail::CompactCoordinatesFF>(this->protein->get_bodies());
     data_w_ptr = std::make_unique<hist::detail::CompactCoordinatesFF>(this->protein->get_waters());
@@ -42,10 +46,13 @@ std::unique_ptr<ICompositeDistanceHistogram> HistogramManagerMTFFAvg<use_weighte
     int data_a_size = (int) data_a.size();
     int data_w_size = (int) data_w.size();
 
+    // the histograms only need to cover the largest distance of this molecule
+    const unsigned int bins = hist::detail::get_required_bins({data_a, data_w});
+
     //########################//
     // PREPARE MULTITHREADING //
     //########################//
-    container::ThreadLocalWrapper<GenericDistribution3D_t> p_aa_all(form_factor::get_count(), form_factor::get_count(), constants::axes::d_axis.bins); // ff_type1, ff_type2, distance
+    container::ThreadLocalWrapper<GenericDistribution3D_t> p_aa_all(form_factor::get_count(), form_factor::get_count(), bins); // ff_type1, ff_type2, distance
     auto calc_aa = [&data_a, &p_aa_all, data_a_size] (int imin, int imax) {
         auto& p_aa = p_aa_all.get();
         for (int i = imin; i < imax; ++i) { // atom
@@ -64,7 +71,7 @@ std::unique_ptr<ICompositeDistanceHistogram> HistogramManagerMTFFAvg<use_weighte
         }
     };
 
-    container::ThreadLocalWrapper<GenericDistribution2D_t> p_aw_all(form_factor::get_count(), constants::axes::d_axis.bins); // ff_type, distance
+    container::ThreadLocalWrapper<GenericDistribution2D_t> p_aw_all(form_factor::get_count(), bins); // ff_type, distance
     auto calc_aw = [&data_w, &data_a, &p_aw_all, data_w_size] (int imin, int imax) {
         auto& p_aw = p_aw_all.get();
         for (int i = imin; i < imax; ++i) { // atom
@@ -83,7 +90,7 @@ std::unique_ptr<ICompositeDistanceHistogram> HistogramManagerMTFFAvg<use_weighte
         }
     };
 
-    container::ThreadLocalWrapper<GenericDistribution1D_t> p_ww_all(constants::axes::d_axis.bins); // distance
+    container::ThreadLocalWrapper<GenericDistribution1D_t> p_ww_all(bins); // distance
     auto calc_ww = [&data_w, &p_ww_all, data_w_size] (int imin, int imax) {
         auto& p_ww = p_ww_all.get();
         for (int i = imin; i < imax; ++i) { // water
@@ -105,24 +112,28 @@ std::unique_ptr<ICompositeDistanceHistogram> HistogramManagerMTFFAvg<use_weighte
     //##############//
     // SUBMIT TASKS //
     //##############//
-    int job_size = settings::general::detail::job_size;
-    for (int i = 0; i < (int) data_a_size; i+=job_size) {
-        pool->detach_task(
-            [&calc_aa, i, job_size, data_a_size] () {calc_aa(i, std::min(i+job_size, data_a_size));}
+    // each job may create its own thread-local copy of the histograms, so the job sizes are increased if the copies of all three loops would not fit in the memory budget
+    auto job_sizes = utility::memory::job_sizes({{data_a_size, p_aa_all.instance_bytes()}, {data_a_size, p_aw_all.instance_bytes()}, {data_w_size, p_ww_all.instance_bytes()}});
+    int job_size_aa = job_sizes[0];
+    int job_size_aw = job_sizes[1];
+    int job_size_ww = job_sizes[2];
+    for (int i = 0; i < (int) data_a_size; i+=job_size_aa) {
+        tasks.run(
+            [&calc_aa, i, job_size_aa, data_a_size] () {calc_aa(i, std::min(i+job_size_aa, data_a_size));}
         );
     }
-    for (int i = 0; i < (int) data_a_size; i+=job_size) {
-        pool->detach_task(
-            [&calc_aw, i, job_size, data_a_size] () {calc_aw(i, std::min(i+job_size, data_a_size));}
+    for (int i = 0; i < (int) data_a_size; i+=job_size_aw) {
+        tasks.run(
+            [&calc_aw, i, job_size_aw, data_a_size] () {calc_aw(i, std::min(i+job_size_aw, data_a_size));}
         );
     }
-    for (int i = 0; i < (int) data_w_size; i+=job_size) {
-        pool->detach_task(
-            [&calc_ww, i, job_size, data_w_size] () {calc_ww(i, std::min(i+job_size, data_w_size));}
+    for (int i = 0; i < (int) data_w_size; i+=job_size_ww) {
+        tasks.run(
+            [&calc_ww, i, job_size_ww, data_w_size] () {calc_ww(i, std::min(i+job_size_ww, data_w_size));}
         );
     }
 
-    pool->wait();
+    tasks.wait();
     auto p_aa = p_aa_all.merge();
     auto p_aw = p_aw_all.merge();
     auto p_ww = p_ww_all.merge();
@@ -137,7 +148,7 @@ std::unique_ptr<ICompositeDistanceHistogram> HistogramManagerMTFFAvg<use_weighte
     p_ww.add(0, std::accumulate(data_w.get_data().begin(), data_w.get_data().end(), 0.0, [](double sum, const hist::detail::CompactCoordinatesData& data) {return sum + std::pow(data.value.w, 2);}));
 
     // this is counter-intuitive, but splitting the loop into separate parts is likely faster since it allows both SIMD optimizations and better cache usage
-    GenericDistribution1D_t p_tot(constants::axes::d_axis.bins);
+    GenericDistribution1D_t p_tot(bins);
     {   // sum all elements to the total
         for (unsigned int ff1 = 0; ff1 < form_factor::get_count_without_excluded_volume(); ++ff1) {
             for (unsigned int ff2 = 0; ff2 < form_factor::get_count_without_excluded_volume(); ++ff2) {
@@ -159,11 +170,11 @@ std::unique_ptr<ICompositeDistanceHistogram> HistogramManagerMTFFAvg<use_weighte
         }
     }
 
-    pool->detach_task([&p_aa, max_bin] () { p_aa.resize(max_bin); });
-    pool->detach_task([&p_aw, max_bin] () { p_aw.resize(max_bin); });
-    pool->detach_task([&p_ww, max_bin] () { p_ww.resize(max_bin); });
-    pool->detach_task([&p_tot, max_bin] () { p_tot.resize(max_bin); });
-    pool->wait();
+    tasks.run([&p_aa, max_bin] () { p_aa.resize(max_bin); });
+    tasks.run([&p_aw, max_bin] () { p_aw.resize(max_bin); });
+    tasks.run([&p_ww, max_bin] () { p_ww.resize(max_bin); });
+    tasks.run([&p_tot, max_bin] () { p_tot.resize(max_bin); });
+    tasks.wait();
 
     // multiply the excluded volume charge onto the excluded volume bins
     double Z_exv_avg = this->protein->get_volume_grid()*constants::charge::density::water/this->protein->atom_size();
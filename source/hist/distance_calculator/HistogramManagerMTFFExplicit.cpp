@@ -13,8 +13,11 @@ For more information, please refer to the LICENSE file in the project root.
 #include <settings/HistogramSettings.h>
 #include <settings/GeneralSettings.h>
 #include <container/ThreadLocalWrapper.h>
+#include <utility/Memory.h>
+#include <hist/detail/DistanceAxis.h>
 #include <constants/Axes.h>
 #include <utility/MultiThreading.h>
+#include <utility/Trace.h>
 
 using namespace container;
 using namespace hist;
@@ -27,6 +30,7 @@ std::unique_ptr<DistanceHistogram> HistogramManagerMTFFExplicit<use_weighted_dis
 
 template<bool use_weighted_distribution>
 std::unique_ptr<ICompositeDistanceHistogram> HistogramManagerMTFFExplicit<use_weighted_distribution>::calculate_all() {
+    TRACE_ZONE("HistogramManagerMTFFExplicit::calculate_all");
     using GenericDistribution1D_t = typename hist::GenericDistribution1D<use_weighted_distribution>::type;
     using GenericDistribution2D_t = typename hist::GenericDistribution2D<use_weighted_distribution>::type;
     using GenericDistribution3D_t = typename hist::GenericDistribution3D<use_weighted_distribution>::type;
@@ -37,21 +41,24 @@ std::unique_ptr<ICompositeDistanceHistogram> HistogramManagerMTFFExplicit<use_we
     int data_a_size = (int) data_a.size();
     int data_w_size = (int) data_w.size();
 
+    // the histograms only need to cover the largest distance of this molecule
+    const unsigned int bins = hist::detail::get_required_bins({data_a, data_w});
+
     //########################//
     // PREPARE MULTITHREADING //
     //########################//
-    auto pool = utility::multi_threading::get_global_pool();
+    utility::multi_threading::TaskGroup tasks;
 
     container::ThreadLocalWrapper<GenericDistribution3D_t> p_aa_all(
-        form_factor::get_count_without_excluded_volume(), form_factor::get_count_without_excluded_volume(), constants::axes::d_axis.bins
+        form_factor::get_count_without_excluded_volume(), form_factor::get_count_without_excluded_volume(), bins
     ); // ff_type1, ff_type2, distance
 
     container::ThreadLocalWrapper<GenericDistribution3D_t> p_ax_all(
-        form_factor::get_count_without_excluded_volume(), form_factor::get_count_without_excluded_volume(), constants::axes::d_axis.bins
+        form_factor::get_count_without_excluded_volume(), form_factor::get_count_without_excluded_volume(), bins
     ); // ff_type1, ff_type2, distance
 
     container::ThreadLocalWrapper<GenericDistribution3D_t> p_xx_all(
-        form_factor::get_count_without_excluded_volume(), form_factor::get_count_without_excluded_volume(), constants::axes::d_axis.bins
+        form_factor::get_count_without_excluded_volume(), form_factor::get_count_without_excluded_volume(), bins
     ); // ff_type1, ff_type2, distance
 
     auto calc_aa = [&data_a, &p_aa_all, &p_ax_all, &p_xx_all, data_a_size] (int imin, int imax) {
@@ -74,8 +81,8 @@ std::unique_ptr<ICompositeDistanceHistogram> HistogramManagerMTFFExplicit<use_we
         }
     };
 
-    container::ThreadLocalWrapper<GenericDistribution2D_t> p_wa_all(form_factor::get_count_without_excluded_volume(), constants::axes::d_axis.bins); // ff_type, distance
-    container::ThreadLocalWrapper<GenericDistribution2D_t> p_wx_all(form_factor::get_count_without_excluded_volume(), constants::axes::d_axis.bins); // ff_type, distance
+    container::ThreadLocalWrapper<GenericDistribution2D_t> p_wa_all(form_factor::get_count_without_excluded_volume(), bins); // ff_type, distance
+    container::ThreadLocalWrapper<GenericDistribution2D_t> p_wx_all(form_factor::get_count_without_excluded_volume(), bins); // ff_type, distance
     auto calc_wa = [&data_w, &data_a, &p_wa_all, &p_wx_all, data_w_size] (int imin, int imax) {
         auto& p_wa = p_wa_all.get();
         auto& p_wx = p_wx_all.get();
@@ -95,7 +102,7 @@ std::unique_ptr<ICompositeDistanceHistogram> HistogramManagerMTFFExplicit<use_we
         }
     };
 
-    container::ThreadLocalWrapper<GenericDistribution1D_t> p_ww_all(constants::axes::d_axis.bins); // distance
+    container::ThreadLocalWrapper<GenericDistribution1D_t> p_ww_all(bins); // distance
     auto calc_ww = [&data_w, &p_ww_all, data_w_size] (int imin, int imax) {
         auto& p_ww = p_ww_all.get();
         for (int i = imin; i < imax; ++i) { // water
@@ -117,24 +124,28 @@ std::unique_ptr<ICompositeDistanceHistogram> HistogramManagerMTFFExplicit<use_we
     //##############//
     // SUBMIT TASKS //
     //##############//
-    int job_size = settings::general::detail::job_size;
-    for (int i = 0; i < (int) data_a_size; i+=job_size) {
-        pool->detach_task(
-            [&calc_aa, i, job_size, data_a_size] () {calc_aa(i, std::min(i+job_size, data_a_size));}
+    // each job may create its own thread-local copy of the histograms, so the job sizes are increased if the copies of all three loops would not fit in the memory budget
+    auto job_sizes = utility::memory::job_sizes({{data_a_size, p_aa_all.instance_bytes() + p_ax_all.instance_bytes() + p_xx_all.instance_bytes()}, {data_a_size, p_wa_all.instance_bytes() + p_wx_all.instance_bytes()}, {data_w_size, p_ww_all.instance_bytes()}});
+    int job_size_aa = job_sizes[0];
+    int job_size_wa = job_sizes[1];
+    int job_size_ww = job_sizes[2];
+    for (int i = 0; i < (int) data_a_size; i+=job_size_aa) {
+        tasks.run(
+            [&calc_aa, i, job_size_aa, data_a_size] () {calc_aa(i, std::min(i+job_size_aa, data_a_size));}
         );
     }
-    for (int i = 0; i < (int) data_a_size; i+=job_size) {
-        pool->detach_task(
-            [&calc_wa, i, job_size, data_a_size] () {calc_wa(i, std::min(i+job_size, data_a_size));}
+    for (int i = 0; i < (int) data_a_size; i+=job_size_wa) {
+        tasks.run(
+            [&calc_wa, i, job_size_wa, data_a_size] () {calc_wa(i, std::min(i+job_size_wa, data_a_size));}
         ); 
     }
-    for (int i = 0; i < (int) data_w_size; i+=job_size) {
-        pool->detach_task(
-            [&calc_ww, i, job_size, data_w_size] () {calc_ww(i, std::min(i+job_size, data_w_size));}
+    for (int i = 0; i < (int) data_w_size; i+=job_size_ww) {
+        tasks.run(
+            [&calc_ww, i, job_size_ww, data_w_size] () {calc_ww(i, std::min(i+job_size_ww, data_w_size));}
         );
     }
 
-    pool->wait();
+    tasks.wait();
     auto p_aa = p_aa_all.merge();
     auto p_ax = p_ax_all.merge();
     auto p_xx = p_xx_all.merge();
@@ -152,7 +163,7 @@ std::unique_ptr<ICompositeDistanceHistogram> HistogramManagerMTFFExplicit<use_we
     p_ww.add(0, std::accumulate(data_w.get_data().begin(), data_w.get_data().end(), 0.0, [](double sum, const hist::detail::CompactCoordinatesData& data) {return sum + std::pow(data.value.w, 2);}));
 
     // this is counter-intuitive, but splitting the loop into separate parts is likely faster since it allows both SIMD optimizations and better cache usage
-    GenericDistribution1D_t p_tot(constants::axes::d_axis.bins);
+    GenericDistribution1D_t p_tot(bins);
     {   // sum all elements to the total
         for (unsigned int ff1 = 0; ff1 < form_factor::get_count_without_excluded_volume(); ++ff1) {
             for (unsigned int ff2 = 0; ff2 < form_factor::get_count_without_excluded_volume(); ++ff2) {
@@ -174,14 +185,14 @@ std::unique_ptr<ICompositeDistanceHistogram> HistogramManagerMTFFExplicit<use_we
         }
     }
 
-    pool->detach_task([&p_aa, max_bin] () { p_aa.resize(max_bin); });
-    pool->detach_task([&p_ax, max_bin] () { p_ax.resize(max_bin); });
-    pool->detach_task([&p_xx, max_bin] () { p_xx.resize(max_bin); });
-    pool->detach_task([&p_wa, max_bin] () { p_wa.resize(max_bin); });
-    pool->detach_task([&p_wx, max_bin] () { p_wx.resize(max_bin); });
-    pool->detach_task([&p_ww, max_bin] () { p_ww.resize(max_bin); });
-    pool->detach_task([&p_tot, max_bin] () { p_tot.resize(max_bin); });
-    pool->wait();
+    tasks.run([&p_aa, max_bin] () { p_aa.resize(max_bin); });
+    tasks.run([&p_ax, max_bin] () { p_ax.resize(max_bin); });
+    tasks.run([&p_xx, max_bin] () { p_xx.resize(max_bin); });
+    tasks.run([&p_wa, max_bin] () { p_wa.resize(max_bin); });
+    tasks.run([&p_wx, max_bin] () { p_wx.resize(max_bin); });
+    tasks.run([&p_ww, max_bin] () { p_ww.resize(max_bin); });
+    tasks.run([&p_tot, max_bin] () { p_tot.resize(max_bin); });
+    tasks.wait();
 
     if (settings::hist::use_foxs_method) {
         return std::make_unique<CompositeDistanceHistogramFoXS>(
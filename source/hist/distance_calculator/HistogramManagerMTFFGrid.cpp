@@ -10,15 +10,18 @@ For more information, please refer to the LICENSE file in the project root.
 #include <hist/intensity_calculator/CompositeDistanceHistogramFFAvg.h>
 #include <hist/intensity_calculator/CompositeDistanceHistogramFFGrid.h>
 #include <container/ThreadLocalWrapper.h>
+#include <utility/Memory.h>
 #include <data/Molecule.h>
 #include <hydrate/Grid.h>
 #include <settings/GeneralSettings.h>
 #include <settings/GridSettings.h>
 #include <settings/HistogramSettings.h>
+#include <hist/detail/DistanceAxis.h>
 #include <constants/Axes.h>
 #include <hist/distance_calculator/detail/TemplateHelpersFFAvg.h>
 #include <form_factor/FormFactorType.h>
 #include <utility/MultiThreading.h>
+#include <utility/Trace.h>
 
 using namespace hist;
 
@@ -53,9 +56,10 @@ std::unique_ptr<DistanceHistogram> HistogramManagerMTFFGrid<use_weighted_distrib
 
 template<bool use_weighted_distribution> 
 std::unique_ptr<ICompositeDistanceHistogram> HistogramManagerMTFFGrid<use_weighted_distribution>::calculate_all() {
+    TRACE_ZONE("HistogramManagerMTFFGrid::calculate_all");
     using GenericDistribution1D_t = typename hist::GenericDistribution1D<use_weighted_distribution>::type;
     using GenericDistribution2D_t = typename hist::GenericDistribution2D<use_weighted_distribution>::type;
-    auto pool = utility::multi_threading::get_global_pool();
+    utility::multi_threading::TaskGroup tasks;
 
     auto base_res = HistogramManagerMTFFAvg<use_weighted_distribution>::calculate_all(); // make sure everything is initialized
     hist::detail::CompactCoordinates data_x = hist::detail::CompactCoordinates(this->protein->get_grid()->generate_excluded_volume(), 1);
@@ -65,10 +69,13 @@ std::unique_ptr<ICompositeDistanceHistogram> HistogramManagerMTFFGrid<use_weight
     int data_w_size = (int) data_w.size();
     int data_x_size = (int) data_x.size();
 
+    // the histograms only need to cover the largest distance of this molecule
+    const unsigned int bins = hist::detail::get_required_bins({data_a, data_w, data_x});
+
     //########################//
     // PREPARE MULTITHREADING //
     //########################//
-    container::ThreadLocalWrapper<GenericDistribution1D_t> p_xx_all(constants::axes::d_axis.bins);
+    container::ThreadLocalWrapper<GenericDistribution1D_t> p_xx_all(bins);
     auto calc_xx = [&data_x, &p_xx_all, data_x_size] (int imin, int imax) {
         auto& p_xx = p_xx_all.get();
         for (int i = imin; i < imax; ++i) { // exv
@@ -88,7 +95,7 @@ std::unique_ptr<ICompositeDistanceHistogram> HistogramManagerMTFFGrid<use_weight
         return p_xx;
     };
 
-    container::ThreadLocalWrapper<GenericDistribution2D_t> p_ax_all(form_factor::get_count(), constants::axes::d_axis.bins);
+    container::ThreadLocalWrapper<GenericDistribution2D_t> p_ax_all(form_factor::get_count(), bins);
     auto calc_ax = [&data_a, &data_x, &p_ax_all, data_x_size] (int imin, int imax) {
         auto& p_ax = p_ax_all.get();
         for (int i = imin; i < imax; ++i) { // atoms
@@ -108,7 +115,7 @@ std::unique_ptr<ICompositeDistanceHistogram> HistogramManagerMTFFGrid<use_weight
         return p_ax;
     };
 
-    container::ThreadLocalWrapper<GenericDistribution1D_t> p_wx_all(constants::axes::d_axis.bins);
+    container::ThreadLocalWrapper<GenericDistribution1D_t> p_wx_all(bins);
     auto calc_wx = [&data_w, &data_x, &p_wx_all, data_x_size] (int imin, int imax) {
         auto& p_wx = p_wx_all.get();
         for (int i = imin; i < imax; ++i) { // waters
@@ -131,24 +138,28 @@ std::unique_ptr<ICompositeDistanceHistogram> HistogramManagerMTFFGrid<use_weight
     //##############//
     // SUBMIT TASKS //
     //##############//
-    int job_size = settings::general::detail::job_size;
-    for (int i = 0; i < (int) data_x_size; i+=job_size) {
-        pool->detach_task(
-            [&calc_xx, i, job_size, data_x_size] () {return calc_xx(i, std::min(i+job_size, data_x_size));}
+    // each job may create its own thread-local copy of the histograms, so the job sizes are increased if the copies of all three loops would not fit in the memory budget
+    auto job_sizes = utility::memory::job_sizes({{data_x_size, p_xx_all.instance_bytes()}, {data_a_size, p_ax_all.instance_bytes()}, {data_w_size, p_wx_all.instance_bytes()}});
+    int job_size_xx = job_sizes[0];
+    int job_size_ax = job_sizes[1];
+    int job_size_wx = job_sizes[2];
+    for (int i = 0; i < (int) data_x_size; i+=job_size_xx) {
+        tasks.run(
+            [&calc_xx, i, job_size_xx, data_x_size] () {return calc_xx(i, std::min(i+job_size_xx, data_x_size));}
         );
     }
-    for (int i = 0; i < (int) data_a_size; i+=job_size) {
-        pool->detach_task(
-            [&calc_ax, i, job_size, data_a_size] () {return calc_ax(i, std::min(i+job_size, data_a_size));}
+    for (int i = 0; i < (int) data_a_size; i+=job_size_ax) {
+        tasks.run(
+            [&calc_ax, i, job_size_ax, data_a_size] () {return calc_ax(i, std::min(i+job_size_ax, data_a_size));}
         );
     }
-    for (int i = 0; i < (int) data_w_size; i+=job_size) {
-        pool->detach_task(
-            [&calc_wx, i, job_size, data_w_size] () {return calc_wx(i, std::min(i+job_size, data_w_size));}
+    for (int i = 0; i < (int) data_w_size; i+=job_size_wx) {
+        tasks.run(
+            [&calc_wx, i, job_size_wx, data_w_size] () {return calc_wx(i, std::min(i+job_size_wx, data_w_size));}
         );
     }
 
-    pool->wait();
+    tasks.wait();
     GenericDistribution1D_t p_xx_generic = p_xx_all.merge();
     GenericDistribution2D_t p_ax_generic = p_ax_all.merge();
     GenericDistribution1D_t p_wx_generic = p_wx_all.merge();
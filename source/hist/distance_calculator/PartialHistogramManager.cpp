@@ -11,8 +11,17 @@ For more information, please refer to the LICENSE file in the project root.
 #include <hist/intensity_calculator/CompositeDistanceHistogram.h>
 #include <data/state/StateManager.h>
 #include <data/Molecule.h>
+#include <data/Body.h>
+#include <data/record/Water.h>
+#include <math/Vector3.h>
 #include <settings/HistogramSettings.h>
+#include <hist/detail/DistanceAxis.h>
 #include <constants/Axes.h>
+#include <utility/Trace.h>
+
+#include <array>
+#include <cmath>
+#include <limits>
 
 using namespace hist;
 
@@ -25,9 +34,11 @@ PartialHistogramManager<use_weighted_distribution>::~PartialHistogramManager() =
 
 template<bool use_weighted_distribution> 
 std::unique_ptr<DistanceHistogram> PartialHistogramManager<use_weighted_distribution>::calculate() {
+    TRACE_ZONE("PartialHistogramManager::calculate");
     using GenericDistribution1D_t = typename hist::GenericDistribution1D<use_weighted_distribution>::type;
     const std::vector<bool> externally_modified = this->statemanager->get_externally_modified_bodies();
     const std::vector<bool> internally_modified = this->statemanager->get_internally_modified_bodies();
+    const unsigned int bins = get_required_bins();
 
     // check if the object has already been initialized
     if (this->master.size() == 0) [[unlikely]] {
@@ -81,7 +92,7 @@ std::unique_ptr<DistanceHistogram> PartialHistogramManager<use_weighted_distribu
     // downsize our axes to only the relevant area
     GenericDistribution1D_t p_tot = this->master;
     int max_bin = 10; // minimum size is 10
-    for (int i = (int) p_tot.size()-1; i >= 10; i--) {
+    for (int i = (int) std::min<unsigned int>(bins, p_tot.size())-1; i >= 10; i--) {
         if (p_tot.index(i) != 0) {
             max_bin = i+1; // +1 since we usually use this for looping (i.e. i < max_bin)
             break;
@@ -204,9 +215,34 @@ void PartialHistogramManager<use_weighted_distribution>::calc_aa(unsigned int n,
     this->master += partials_aa.index(n, m);
 }
 
+template<bool use_weighted_distribution> 
+unsigned int PartialHistogramManager<use_weighted_distribution>::get_required_bins() const {
+    std::array<double, 3> min = {std::numeric_limits<double>::max(), std::numeric_limits<double>::max(), std::numeric_limits<double>::max()};
+    std::array<double, 3> max = {std::numeric_limits<double>::lowest(), std::numeric_limits<double>::lowest(), std::numeric_limits<double>::lowest()};
+    auto extend = [&min, &max] (const Vector3<double>& v) {
+        for (unsigned int k = 0; k < 3; ++k) {
+            min[k] = std::min(min[k], v[k]);
+            max[k] = std::max(max[k], v[k]);
+        }
+    };
+    for (const auto& body : this->protein->get_bodies()) {
+        for (const auto& atom : body.get_atoms()) {extend(atom.get_coordinates());}
+    }
+    for (const auto& water : this->protein->get_waters()) {extend(water.get_coordinates());}
+
+    double diagonal = 0;
+    for (unsigned int k = 0; k < 3 && min[k] <= max[k]; ++k) {
+        diagonal += (max[k] - min[k])*(max[k] - min[k]);
+    }
+
+    // the axis is fixed when the partial histograms are first allocated
+    Axis axis = this->master.size() == 0 ? hist::detail::get_distance_axis() : this->master.axis;
+    return hist::detail::get_required_bins(std::sqrt(diagonal), axis);
+}
+
 template<bool use_weighted_distribution> 
 void PartialHistogramManager<use_weighted_distribution>::initialize() {
-    const Axis& axis = constants::axes::d_axis; 
+    Axis axis = hist::detail::get_distance_axis();
     std::vector<double> p_base(axis.bins, 0);
     this->master = detail::MasterHistogram<use_weighted_distribution>(p_base, axis);
 
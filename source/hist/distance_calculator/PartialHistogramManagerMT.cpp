@@ -13,14 +13,65 @@ For more information, please refer to the LICENSE file in the project root.
 #include <settings/HistogramSettings.h>
 #include <data/state/StateManager.h>
 #include <data/Molecule.h>
+#include <hist/detail/DistanceAxis.h>
 #include <constants/Axes.h>
 #include <utility/MultiThreading.h>
 #include <container/ThreadLocalWrapper.h>
+#include <utility/Trace.h>
+#include <utility/Memory.h>
 
 #include <mutex>
+#include <limits>
+#include <cstdint>
 
 using namespace hist;
 
+namespace {
+    /**
+     * @brief Count the distances between the rows [imin, imax) of @a coords_i and the elements of @a coords_j in an integer histogram, 
+     *        and add the counts to @a p scaled by the product of the two weights. Both sets must have a uniform weight. 
+     *        If @a triangular is true, the two sets are the same, and only the pairs with j > i are counted.
+     */
+    template<int factor, typename count_t, typename Histogram>
+    void count_pairs(Histogram& p, const hist::detail::CompactCoordinates& coords_i, const hist::detail::CompactCoordinates& coords_j, unsigned int imin, unsigned int imax, bool triangular) {
+        container::Container1D<count_t> counts(p.size());
+        for (unsigned int i = imin; i < imax; ++i) {
+            unsigned int j = triangular ? i+1 : 0;
+            for (; j+7 < coords_j.size(); j+=8) {
+                count8<factor>(counts, coords_i, coords_j, i, j);
+            }
+
+            for (; j+3 < coords_j.size(); j+=4) {
+                count4<factor>(counts, coords_i, coords_j, i, j);
+            }
+
+            for (; j < coords_j.size(); ++j) {
+                count1<factor>(counts, coords_i, coords_j, i, j);
+            }
+        }
+
+        double w = coords_i[0].value.w*coords_j[0].value.w;
+        for (unsigned int k = 0; k < p.size(); ++k) {
+            p.index(k) += w*counts.index(k);
+        }
+    }
+
+    /**
+     * @brief Dispatch to count_pairs with the narrowest integer type which can hold the counts of a single job.
+     */
+    template<int factor, typename Histogram>
+    void count_uniform(Histogram& p, const hist::detail::CompactCoordinates& coords_i, const hist::detail::CompactCoordinates& coords_j, unsigned int imin, unsigned int imax, bool triangular) {
+        if (imax <= imin || coords_j.size() == 0) {return;}
+
+        // no single bin can receive more counts than there are pairs in this job
+        if (std::size_t(imax - imin)*coords_j.size()*factor <= std::numeric_limits<std::uint32_t>::max()) {
+            count_pairs<factor, std::uint32_t>(p, coords_i, coords_j, imin, imax, triangular);
+        } else {
+            count_pairs<factor, std::uint64_t>(p, coords_i, coords_j, imin, imax, triangular);
+        }
+    }
+}
+
 template<bool use_weighted_distribution> 
 PartialHistogramManagerMT<use_weighted_distribution>::PartialHistogramManagerMT(observer_ptr<const data::Molecule> protein) 
     : PartialHistogramManager<use_weighted_distribution>(protein) {}
@@ -30,10 +81,11 @@ PartialHistogramManagerMT<use_weighted_distribution>::~PartialHistogramManagerMT
 
 template<bool use_weighted_distribution> 
 std::unique_ptr<DistanceHistogram> PartialHistogramManagerMT<use_weighted_distribution>::calculate() {
+    TRACE_ZONE("PartialHistogramManagerMT::calculate");
     const auto& externally_modified = this->statemanager->get_externally_modified_bodies();
     const auto& internally_modified = this->statemanager->get_internally_modified_bodies();
     const bool hydration_modified = this->statemanager->get_modified_hydration();
-    auto pool = utility::multi_threading::get_global_pool();
+    const unsigned int bins = this->get_required_bins();
 
     // check if the object has already been initialized
     if (this->master.size() == 0) [[unlikely]] {
@@ -42,6 +94,8 @@ std::unique_ptr<DistanceHistogram> PartialHistogramManagerMT<use_weighted_distri
 
     // if not, we must first check if the atom coordinates have been changed in any of the bodies
     else {
+        update_job_size();
+        reset_partials();
         for (unsigned int i = 0; i < this->body_size; ++i) {
 
             // if the internal state was modified, we have to recalculate the self-correlation
@@ -51,7 +105,7 @@ std::unique_ptr<DistanceHistogram> PartialHistogramManagerMT<use_weighted_distri
 
             // if the external state was modified, we have to update the coordinate representations for later calculations (implicitly done in calc_self_correlation)
             else if (externally_modified[i]) {
-                pool->detach_task(
+                tasks.run(
                     [this, i] () {update_compact_representation_body(i);}
                 );
             }
@@ -60,11 +114,11 @@ std::unique_ptr<DistanceHistogram> PartialHistogramManagerMT<use_weighted_distri
 
     // small efficiency improvement: if the hydration layer was modified, we can update the compact representations in parallel with the self-correlation
     if (hydration_modified) {
-        pool->detach_task(
+        tasks.run(
             [this] () {update_compact_representation_water();}
         );
     }
-    pool->wait(); // ensure the compact representations have been updated before continuing
+    tasks.wait(); // ensure the compact representations have been updated before continuing
 
     // check if the hydration layer was modified
     if (hydration_modified) {
@@ -87,44 +141,44 @@ std::unique_ptr<DistanceHistogram> PartialHistogramManagerMT<use_weighted_distri
     }
 
     // merge the partial results from each thread and add it to the master histogram
-    pool->wait(); // we have to wait for all calculations to finish before we can merge them
+    tasks.wait(); // we have to wait for all calculations to finish before we can merge them
     {
         if (hydration_modified) {
-            pool->detach_task(
+            tasks.run(
                 [this] () {combine_ww();}
             );
         }
 
         for (unsigned int i = 0; i < this->body_size; ++i) {
             if (internally_modified[i]) {
-                pool->detach_task(
+                tasks.run(
                     [this, i] () {combine_self_correlation(i);}
                 );
             }
 
             for (unsigned int j = 0; j < i; ++j) {
                 if (externally_modified[i] || externally_modified[j]) {
-                    pool->detach_task(
+                    tasks.run(
                         [this, i, j] () {combine_aa(i, j);}
                     );
                 }
             }
 
             if (externally_modified[i] || hydration_modified) {
-                pool->detach_task(
+                tasks.run(
                     [this, i] () {combine_aw(i);}
                 );
             }
         }
     }
 
-    pool->wait();
+    tasks.wait();
     this->statemanager->reset_to_false();
 
     // downsize our axes to only the relevant area
     GenericDistribution1D_t p_tot = this->master;
     int max_bin = 10; // minimum size is 10
-    for (int i = (int) p_tot.size()-1; i >= 10; i--) {
+    for (int i = (int) std::min<unsigned int>(bins, p_tot.size())-1; i >= 10; i--) {
         if (p_tot.index(i) != 0) {
             max_bin = i+1; // +1 since we usually use this for looping (i.e. i < max_bin)
             break;
@@ -201,23 +255,24 @@ std::unique_ptr<ICompositeDistanceHistogram> PartialHistogramManagerMT<use_weigh
 
 template<bool use_weighted_distribution> 
 void PartialHistogramManagerMT<use_weighted_distribution>::initialize() {
-    auto pool = utility::multi_threading::get_global_pool();
-    const Axis& axis = constants::axes::d_axis; 
+    Axis axis = hist::detail::get_distance_axis();
     std::vector<double> p_base(axis.bins, 0);
     this->master = detail::MasterHistogram<use_weighted_distribution>(p_base, axis);
-    this->partials_aa_all = container::Container2D<GenericDistribution1D_t>(this->body_size, this->body_size);
+
+    // the thread-local copies are only created by the threads which take part in the calculations, so their number is limited by the job size
+    container::Container2D<GenericDistribution1D_t> p_aa(this->body_size, this->body_size);
+    for (unsigned int i = 0; i < this->body_size; ++i) {
+        for (unsigned int j = 0; j <= i; ++j) {
+            p_aa.index(i, j) = GenericDistribution1D_t(axis.bins);
+        }
+    }
+    this->partials_aa_all = std::move(p_aa);
     this->partials_aw_all = container::Container1D<GenericDistribution1D_t>(this->body_size, axis.bins);
     this->partials_ww_all = GenericDistribution1D_t(axis.bins);
+    update_job_size();
 
     this->partials_ww = detail::PartialHistogram<use_weighted_distribution>(axis.bins);
     for (unsigned int i = 0; i < this->body_size; ++i) {
-        for (auto& tmp : this->partials_aa_all.get_all()) {
-            tmp.get().index(i, i) = GenericDistribution1D_t(this->master.axis.bins);
-            for (unsigned int j = 0; j < i; ++j) {
-                tmp.get().index(i, j) = GenericDistribution1D_t(this->master.axis.bins);
-            }
-        }
-
         this->partials_aw.index(i) = detail::PartialHistogram<use_weighted_distribution>(axis.bins);
         this->partials_aa.index(i, i) = detail::PartialHistogram<use_weighted_distribution>(axis.bins);
         
@@ -228,21 +283,58 @@ void PartialHistogramManagerMT<use_weighted_distribution>::initialize() {
         }
     }
 
-    pool->wait();
+    tasks.wait();
     for (unsigned int i = 0; i < this->body_size; ++i) {
-        pool->detach_task(
+        tasks.run(
             [this, i] () {combine_self_correlation(i);}
         );
     }
 }
 
+template<bool use_weighted_distribution> 
+void PartialHistogramManagerMT<use_weighted_distribution>::update_job_size() {
+    // each job may create a thread-local copy of all partial histograms, and the jobs of all bodies run at the same time
+    std::size_t histograms = this->body_size*(this->body_size+1)/2 + this->body_size + 1;
+    std::size_t bytes = histograms*this->master.axis.bins*sizeof(std::ranges::range_value_t<GenericDistribution1D_t>);
+    job_size = utility::memory::job_size(this->protein->atom_size() + this->protein->water_size(), bytes);
+}
+
+template<bool use_weighted_distribution> 
+void PartialHistogramManagerMT<use_weighted_distribution>::reset_partials() {
+    const auto& externally_modified = this->statemanager->get_externally_modified_bodies();
+    const auto& internally_modified = this->statemanager->get_internally_modified_bodies();
+    const bool hydration_modified = this->statemanager->get_modified_hydration();
+    for (auto& tmp : this->partials_aa_all.get_existing()) {
+        for (unsigned int i = 0; i < this->body_size; ++i) {
+            if (internally_modified[i]) {
+                tmp.get().index(i, i) = GenericDistribution1D_t(this->master.axis.bins);
+            }
+            for (unsigned int j = 0; j < i; ++j) {
+                if (externally_modified[i] || externally_modified[j]) {
+                    tmp.get().index(i, j) = GenericDistribution1D_t(this->master.axis.bins);
+                }
+            }
+        }
+    }
+
+    for (auto& tmp : this->partials_aw_all.get_existing()) {
+        for (unsigned int i = 0; i < this->body_size; ++i) {
+            if (externally_modified[i] || hydration_modified) {
+                tmp.get().index(i) = GenericDistribution1D_t(this->master.axis.bins);
+            }
+        }
+    }
+
+    if (hydration_modified) {
+        for (auto& tmp : this->partials_ww_all.get_existing()) {
+            tmp.get() = GenericDistribution1D_t(this->master.axis.bins);
+        }
+    }
+}
+
 template<bool use_weighted_distribution> 
 void PartialHistogramManagerMT<use_weighted_distribution>::calc_self_correlation(unsigned int index) {
-    auto pool = utility::multi_threading::get_global_pool();
     update_compact_representation_body(index);
-    for (auto& tmp : this->partials_aa_all.get_all()) {
-        tmp.get().index(index, index) = GenericDistribution1D_t(this->master.axis.bins);
-    }
 
     // calculate internal distances between atoms
     static auto calc_internal = [] (
@@ -250,9 +342,14 @@ void PartialHistogramManagerMT<use_weighted_distribution>::calc_self_correlation
         unsigned int index, 
         const detail::CompactCoordinates& coords, 
         unsigned int imin, 
-        unsigned int imax
+        unsigned int imax,
+        bool uniform
     ) -> void {
         auto& p_pp = p_pp_all.get().index(index, index);
+        if constexpr (!use_weighted_distribution) {
+            if (uniform) {return count_uniform<2>(p_pp, coords, coords, imin, imax, true);}
+        }
+
         for (unsigned int i = imin; i < imax; ++i) {
             unsigned int j = i+1;
             for (; j+7 < coords.size(); j+=8) {
@@ -279,24 +376,21 @@ void PartialHistogramManagerMT<use_weighted_distribution>::calc_self_correlation
         p_pp.add(0, std::accumulate(coords.get_data().begin(), coords.get_data().end(), 0.0, [](double sum, const hist::detail::CompactCoordinatesData& val) {return sum + val.value.w*val.value.w;}));
     };
 
-    unsigned int atom_size = this->protein->atom_size();
-    for (unsigned int i = 0; i < atom_size; i += settings::general::detail::job_size) {
-        pool->detach_task(
-            [this, i, index, atom_size] () {calc_internal(this->partials_aa_all, index, this->coords_a[index], i, std::min(i+settings::general::detail::job_size, atom_size));}
+    // if all atoms of the body share a single weight, it is enough to count the pairs
+    bool uniform = !use_weighted_distribution && this->coords_a[index].has_uniform_weight();
+    unsigned int atom_size = this->coords_a[index].size();
+    for (unsigned int i = 0; i < atom_size; i += job_size) {
+        tasks.run(
+            [this, i, index, atom_size, uniform] () {calc_internal(this->partials_aa_all, index, this->coords_a[index], i, std::min<unsigned int>(i+job_size, atom_size), uniform);}
         );
     }
-    pool->detach_task(
+    tasks.run(
         [this, index] () {calc_self(this->partials_aa_all, index, this->coords_a[index]);}
     );
 }
 
 template<bool use_weighted_distribution> 
 void PartialHistogramManagerMT<use_weighted_distribution>::calc_aa(unsigned int n, unsigned int m) {
-    auto pool = utility::multi_threading::get_global_pool();
-    for (auto& tmp : this->partials_aa_all.get_all()) {
-        tmp.get().index(n, m) = GenericDistribution1D_t(this->master.axis.bins);
-    }
-
     static auto calc_pp = [] (
         container::ThreadLocalWrapper<container::Container2D<GenericDistribution1D_t>>& p_pp_all,
         unsigned int n,
@@ -304,9 +398,14 @@ void PartialHistogramManagerMT<use_weighted_distribution>::calc_aa(unsigned int
         const detail::CompactCoordinates& coords_n, 
         const detail::CompactCoordinates& coords_m, 
         unsigned int imin, 
-        unsigned int imax
+        unsigned int imax,
+        bool uniform
     ) -> void {
         auto& p_pp = p_pp_all.get().index(n, m);
+        if constexpr (!use_weighted_distribution) {
+            if (uniform) {return count_uniform<2>(p_pp, coords_n, coords_m, imin, imax, false);}
+        }
+
         for (unsigned int i = imin; i < imax; ++i) {
             unsigned int j = 0;
             for (; j+7 < coords_m.size(); j+=8) {
@@ -324,29 +423,30 @@ void PartialHistogramManagerMT<use_weighted_distribution>::calc_aa(unsigned int
     };
 
     detail::CompactCoordinates& coords_n = this->coords_a[n];
-    for (unsigned int i = 0; i < coords_n.size(); i += settings::general::detail::job_size) {
-        pool->detach_task(
-            [this, n, m, i, &coords_n] () {calc_pp(this->partials_aa_all, n, m, coords_n, this->coords_a[m], i, std::min<int>(i+settings::general::detail::job_size, coords_n.size()));}
+    bool uniform = !use_weighted_distribution && coords_n.has_uniform_weight() && this->coords_a[m].has_uniform_weight();
+    for (unsigned int i = 0; i < coords_n.size(); i += job_size) {
+        tasks.run(
+            [this, n, m, i, &coords_n, uniform] () {calc_pp(this->partials_aa_all, n, m, coords_n, this->coords_a[m], i, std::min<int>(i+job_size, coords_n.size()), uniform);}
         );
     }
 }
 
 template<bool use_weighted_distribution> 
 void PartialHistogramManagerMT<use_weighted_distribution>::calc_aw(unsigned int index) {
-    auto pool = utility::multi_threading::get_global_pool();
-    for (auto& tmp : this->partials_aw_all.get_all()) {
-        tmp.get().index(index) = GenericDistribution1D_t(this->master.axis.bins);
-    }
-
     static auto calc_aw = [] (
         container::ThreadLocalWrapper<container::Container1D<GenericDistribution1D_t>>& p_aw_all,
         unsigned int index,
         const detail::CompactCoordinates& coords_i, 
         const detail::CompactCoordinates& coords_w, 
         unsigned int imin, 
-        unsigned int imax
+        unsigned int imax,
+        bool uniform
     ) -> void {
         auto& p_aw = p_aw_all.get().index(index);
+        if constexpr (!use_weighted_distribution) {
+            if (uniform) {return count_uniform<2>(p_aw, coords_i, coords_w, imin, imax, false);}
+        }
+
         for (unsigned int i = imin; i < imax; ++i) { // atom
             unsigned int j = 0;                      // water
             for (; j+7 < coords_w.size(); j+=8) {
@@ -364,10 +464,11 @@ void PartialHistogramManagerMT<use_weighted_distribution>::calc_aw(unsigned int
     };
 
     detail::CompactCoordinates& coords = this->coords_a[index];
-    for (unsigned int i = 0; i < coords.size(); i += settings::general::detail::job_size) {
-        pool->detach_task(
-            [this, index, i, &coords] () {
-                calc_aw(this->partials_aw_all, index, coords, this->coords_w, i, std::min<int>(i+settings::general::detail::job_size, coords.size()));
+    bool uniform = !use_weighted_distribution && coords.has_uniform_weight() && this->coords_w.has_uniform_weight();
+    for (unsigned int i = 0; i < coords.size(); i += job_size) {
+        tasks.run(
+            [this, index, i, &coords, uniform] () {
+                calc_aw(this->partials_aw_all, index, coords, this->coords_w, i, std::min<int>(i+job_size, coords.size()), uniform);
             }
         );
     }
@@ -375,18 +476,18 @@ void PartialHistogramManagerMT<use_weighted_distribution>::calc_aw(unsigned int
 
 template<bool use_weighted_distribution> 
 void PartialHistogramManagerMT<use_weighted_distribution>::calc_ww() {
-    auto pool = utility::multi_threading::get_global_pool();
-    for (auto& tmp : this->partials_ww_all.get_all()) {
-        tmp.get() = GenericDistribution1D_t(this->master.axis.bins);
-    }
-
     static auto calc_hh = [] (
         container::ThreadLocalWrapper<GenericDistribution1D_t>& p_hh_all,
         const detail::CompactCoordinates& coords_w, 
         unsigned int imin, 
-        unsigned int imax
+        unsigned int imax,
+        bool uniform
     ) -> void {
         auto& p_hh = p_hh_all.get();
+        if constexpr (!use_weighted_distribution) {
+            if (uniform) {return count_uniform<2>(p_hh, coords_w, coords_w, imin, imax, true);}
+        }
+
         for (unsigned int i = imin; i < imax; ++i) {
             unsigned int j = i+1;
             for (; j+7 < coords_w.size(); j+=8) {
@@ -412,12 +513,13 @@ void PartialHistogramManagerMT<use_weighted_distribution>::calc_ww() {
         p_hh.add(0, std::accumulate(coords_w.get_data().begin(), coords_w.get_data().end(), 0.0, [](double sum, const hist::detail::CompactCoordinatesData& val) {return sum + val.value.w*val.value.w;}));
     };
 
-    for (unsigned int i = 0; i < this->coords_w.size(); i += settings::general::detail::job_size) {
-        pool->detach_task(
-            [this, i] () {calc_hh(this->partials_ww_all, this->coords_w, i, std::min<int>(i+settings::general::detail::job_size, this->coords_w.size()));}
+    bool uniform = !use_weighted_distribution && this->coords_w.has_uniform_weight();
+    for (unsigned int i = 0; i < this->coords_w.size(); i += job_size) {
+        tasks.run(
+            [this, i, uniform] () {calc_hh(this->partials_ww_all, this->coords_w, i, std::min<int>(i+job_size, this->coords_w.size()), uniform);}
         );
     }
-    pool->detach_task(
+    tasks.run(
         [this] () {calc_self(this->partials_ww_all, this->coords_w);}
     );
 }
@@ -425,7 +527,7 @@ void PartialHistogramManagerMT<use_weighted_distribution>::calc_ww() {
 template<bool use_weighted_distribution> 
 void PartialHistogramManagerMT<use_weighted_distribution>::combine_self_correlation(unsigned int index) {
     GenericDistribution1D_t p_pp(this->master.axis.bins);
-    for (auto& tmp : this->partials_aa_all.get_all()) { // std::reference_wrapper<container::Container2D<GenericDistribution1D_t>>
+    for (auto& tmp : this->partials_aa_all.get_existing()) { // std::reference_wrapper<container::Container2D<GenericDistribution1D_t>>
         std::transform(p_pp.begin(), p_pp.end(), tmp.get().index(index, index).begin(), p_pp.begin(), std::plus<>());
     }
 
@@ -439,7 +541,7 @@ void PartialHistogramManagerMT<use_weighted_distribution>::combine_self_correlat
 template<bool use_weighted_distribution> 
 void PartialHistogramManagerMT<use_weighted_distribution>::combine_aa(unsigned int n, unsigned int m) {
     GenericDistribution1D_t p_pp(this->master.axis.bins);
-    for (auto& tmp : this->partials_aa_all.get_all()) { // std::reference_wrapper<container::Container2D<GenericDistribution1D_t>>
+    for (auto& tmp : this->partials_aa_all.get_existing()) { // std::reference_wrapper<container::Container2D<GenericDistribution1D_t>>
         std::transform(p_pp.begin(), p_pp.end(), tmp.get().index(n, m).begin(), p_pp.begin(), std::plus<>());
     }
 
@@ -453,7 +555,7 @@ void PartialHistogramManagerMT<use_weighted_distribution>::combine_aa(unsigned i
 template<bool use_weighted_distribution> 
 void PartialHistogramManagerMT<use_weighted_distribution>::combine_aw(unsigned int index) {
     GenericDistribution1D_t p_aw(this->master.axis.bins);
-    for (auto& tmp : this->partials_aw_all.get_all()) {
+    for (auto& tmp : this->partials_aw_all.get_existing()) {
         std::transform(p_aw.begin(), p_aw.end(), tmp.get().index(index).begin(), p_aw.begin(), std::plus<>());
     }
 
@@ -467,7 +569,7 @@ void PartialHistogramManagerMT<use_weighted_distribution>::combine_aw(unsigned i
 template<bool use_weighted_distribution> 
 void PartialHistogramManagerMT<use_weighted_distribution>::combine_ww() {
     GenericDistribution1D_t p_hh(this->master.axis.bins);
-    for (auto& tmp : this->partials_ww_all.get_all()) {
+    for (auto& tmp : this->partials_ww_all.get_existing()) {
         std::transform(p_hh.begin(), p_hh.end(), tmp.get().begin(), p_hh.begin(), std::plus<>());
     }
 
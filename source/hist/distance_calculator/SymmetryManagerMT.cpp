@@ -0,0 +1,309 @@
+/*
+This software is distributed under the GNU General Public License v3.0. 
+For more information, please refer to the LICENSE file in the project root.
+*/
+
+#include <hist/distance_calculator/SymmetryManagerMT.h>
+#include <hist/intensity_calculator/DistanceHistogram.h>
+#include <hist/intensity_calculator/CompositeDistanceHistogram.h>
+#include <hist/distribution/GenericDistribution1D.h>
+#include <hist/detail/CompactCoordinates.h>
+#include <hist/detail/DistanceAxis.h>
+#include <hist/distance_calculator/detail/TemplateHelpers.h>
+#include <container/ThreadLocalWrapper.h>
+#include <utility/Memory.h>
+#include <utility/Exceptions.h>
+#include <data/Molecule.h>
+#include <utility/MultiThreading.h>
+#include <utility/Trace.h>
+
+#include <numeric>
+
+using namespace hist;
+
+namespace {
+    /**
+     * @brief Get the coordinates of a copy of the asymmetric unit.
+     */
+    hist::detail::CompactCoordinates transform(const hist::detail::CompactCoordinates& data, const hist::symmetry::Symmetry& symmetry, unsigned int copy) {
+        hist::detail::CompactCoordinates result = data;
+        for (unsigned int i = 0; i < result.size(); ++i) {
+            auto& v = result[i].value;
+            auto w = symmetry.apply(Vector3<double>(v.x, v.y, v.z), copy);
+            v.x = w.x(); v.y = w.y(); v.z = w.z();
+        }
+        return result;
+    }
+}
+
+template<bool use_weighted_distribution>
+SymmetryManagerMT<use_weighted_distribution>::SymmetryManagerMT(observer_ptr<const data::Molecule> protein, std::shared_ptr<const symmetry::Symmetry> symmetry)
+    : HistogramManager<use_weighted_distribution>(protein), symmetry(std::move(symmetry))
+{
+    if (!this->symmetry) {throw except::nullptr_error("SymmetryManagerMT::SymmetryManagerMT: The symmetry cannot be null.");}
+}
+
+template<bool use_weighted_distribution>
+SymmetryManagerMT<use_weighted_distribution>::~SymmetryManagerMT() = default;
+
+template<bool use_weighted_distribution>
+std::unique_ptr<DistanceHistogram> SymmetryManagerMT<use_weighted_distribution>::calculate() {return calculate_all();}
+
+template<bool use_weighted_distribution>
+std::unique_ptr<ICompositeDistanceHistogram> SymmetryManagerMT<use_weighted_distribution>::calculate_all() {
+    TRACE_ZONE("SymmetryManagerMT::calculate_all");
+    using GenericDistribution1D_t = typename hist::GenericDistribution1D<use_weighted_distribution>::type;
+    utility::multi_threading::TaskGroup tasks;
+
+    hist::detail::CompactCoordinates data_a(this->protein->get_bodies());
+    hist::detail::CompactCoordinates data_w(this->protein->get_waters());
+    int data_a_size = (int) data_a.size();
+    int data_w_size = (int) data_w.size();
+
+    // generate the copies of the asymmetric unit needed for the distinct cross terms
+    auto terms = symmetry->get_cross_terms();
+    std::vector<hist::detail::CompactCoordinates> copies_a, copies_w;
+    copies_a.reserve(terms.size());
+    copies_w.reserve(terms.size());
+    for (const auto& term : terms) {
+        copies_a.push_back(transform(data_a, *symmetry, term.copy));
+        copies_w.push_back(transform(data_w, *symmetry, term.copy));
+    }
+
+    // the histograms only need to cover the largest distance between the unit and any of its copies
+    unsigned int bins = hist::detail::get_required_bins({data_a, data_w});
+    for (unsigned int t = 0; t < terms.size(); ++t) {
+        bins = std::max(bins, hist::detail::get_required_bins({data_a, data_w, copies_a[t], copies_w[t]}));
+    }
+
+    //########################//
+    // PREPARE MULTITHREADING //
+    //########################//
+    // the asymmetric unit with itself
+    container::ThreadLocalWrapper<GenericDistribution1D_t> p_aa_all(bins);
+    auto calc_aa = [&data_a, &p_aa_all, data_a_size] (int imin, int imax) {
+        auto& p_aa = p_aa_all.get();
+        for (int i = imin; i < imax; ++i) { // atom
+            int j = i+1;                    // atom
+            for (; j+7 < data_a_size; j+=8) {
+                evaluate8<use_weighted_distribution, 2>(p_aa, data_a, data_a, i, j);
+            }
+
+            for (; j+3 < data_a_size; j+=4) {
+                evaluate4<use_weighted_distribution, 2>(p_aa, data_a, data_a, i, j);
+            }
+
+            for (; j < data_a_size; ++j) {
+                evaluate1<use_weighted_distribution, 2>(p_aa, data_a, data_a, i, j);
+            }
+        }
+    };
+
+    container::ThreadLocalWrapper<GenericDistribution1D_t> p_aw_all(bins);
+    auto calc_aw = [&data_w, &data_a, &p_aw_all, data_a_size] (int imin, int imax) {
+        auto& p_aw = p_aw_all.get();
+        for (int i = imin; i < imax; ++i) { // water
+            int j = 0;                      // atom
+            for (; j+7 < data_a_size; j+=8) {
+                evaluate8<use_weighted_distribution, 1>(p_aw, data_w, data_a, i, j);
+            }
+
+            for (; j+3 < data_a_size; j+=4) {
+                evaluate4<use_weighted_distribution, 1>(p_aw, data_w, data_a, i, j);
+            }
+
+            for (; j < data_a_size; ++j) {
+                evaluate1<use_weighted_distribution, 1>(p_aw, data_w, data_a, i, j);
+            }
+        }
+    };
+
+    container::ThreadLocalWrapper<GenericDistribution1D_t> p_ww_all(bins);
+    auto calc_ww = [&data_w, &p_ww_all, data_w_size] (int imin, int imax) {
+        auto& p_ww = p_ww_all.get();
+        for (int i = imin; i < imax; ++i) { // water
+            int j = i+1;                    // water
+            for (; j+7 < data_w_size; j+=8) {
+                evaluate8<use_weighted_distribution, 2>(p_ww, data_w, data_w, i, j);
+            }
+
+            for (; j+3 < data_w_size; j+=4) {
+                evaluate4<use_weighted_distribution, 2>(p_ww, data_w, data_w, i, j);
+            }
+
+            for (; j < data_w_size; ++j) {
+                evaluate1<use_weighted_distribution, 2>(p_ww, data_w, data_w, i, j);
+            }
+        }
+    };
+
+    // the asymmetric unit with each distinct copy. all pairs are counted here, since the copies are different from the unit itself
+    std::vector<std::unique_ptr<container::ThreadLocalWrapper<GenericDistribution1D_t>>> p_aa_cross, p_aw_cross, p_ww_cross;
+    for (unsigned int t = 0; t < terms.size(); ++t) {
+        p_aa_cross.push_back(std::make_unique<container::ThreadLocalWrapper<GenericDistribution1D_t>>(bins));
+        p_aw_cross.push_back(std::make_unique<container::ThreadLocalWrapper<GenericDistribution1D_t>>(bins));
+        p_ww_cross.push_back(std::make_unique<container::ThreadLocalWrapper<GenericDistribution1D_t>>(bins));
+    }
+
+    auto calc_cross_a = [&] (unsigned int t, int imin, int imax) {
+        auto& p_aa = p_aa_cross[t]->get();
+        auto& p_aw = p_aw_cross[t]->get();
+        const auto& copy_a = copies_a[t];
+        const auto& copy_w = copies_w[t];
+        for (int i = imin; i < imax; ++i) { // atom
+            int j = 0;                      // copied atom
+            for (; j+7 < data_a_size; j+=8) {
+                evaluate8<use_weighted_distribution, 2>(p_aa, data_a, copy_a, i, j);
+            }
+
+            for (; j+3 < data_a_size; j+=4) {
+                evaluate4<use_weighted_distribution, 2>(p_aa, data_a, copy_a, i, j);
+            }
+
+            for (; j < data_a_size; ++j) {
+                evaluate1<use_weighted_distribution, 2>(p_aa, data_a, copy_a, i, j);
+            }
+
+            j = 0;                          // copied water
+            for (; j+7 < data_w_size; j+=8) {
+                evaluate8<use_weighted_distribution, 1>(p_aw, data_a, copy_w, i, j);
+            }
+
+            for (; j+3 < data_w_size; j+=4) {
+                evaluate4<use_weighted_distribution, 1>(p_aw, data_a, copy_w, i, j);
+            }
+
+            for (; j < data_w_size; ++j) {
+                evaluate1<use_weighted_distribution, 1>(p_aw, data_a, copy_w, i, j);
+            }
+        }
+    };
+
+    auto calc_cross_w = [&] (unsigned int t, int imin, int imax) {
+        auto& p_aw = p_aw_cross[t]->get();
+        auto& p_ww = p_ww_cross[t]->get();
+        const auto& copy_a = copies_a[t];
+        const auto& copy_w = copies_w[t];
+        for (int i = imin; i < imax; ++i) { // water
+            int j = 0;                      // copied atom
+            for (; j+7 < data_a_size; j+=8) {
+                evaluate8<use_weighted_distribution, 1>(p_aw, data_w, copy_a, i, j);
+            }
+
+            for (; j+3 < data_a_size; j+=4) {
+                evaluate4<use_weighted_distribution, 1>(p_aw, data_w, copy_a, i, j);
+            }
+
+            for (; j < data_a_size; ++j) {
+                evaluate1<use_weighted_distribution, 1>(p_aw, data_w, copy_a, i, j);
+            }
+
+            j = 0;                          // copied water
+            for (; j+7 < data_w_size; j+=8) {
+                evaluate8<use_weighted_distribution, 2>(p_ww, data_w, copy_w, i, j);
+            }
+
+            for (; j+3 < data_w_size; j+=4) {
+                evaluate4<use_weighted_distribution, 2>(p_ww, data_w, copy_w, i, j);
+            }
+
+            for (; j < data_w_size; ++j) {
+                evaluate1<use_weighted_distribution, 2>(p_ww, data_w, copy_w, i, j);
+            }
+        }
+    };
+
+    //##############//
+    // SUBMIT TASKS //
+    //##############//
+    // each job may create its own thread-local copy of the histograms it writes to, and the jobs of all loops share the memory budget
+    // all histograms have the same size, and the jobs over the atoms write to 1 + 2*terms of them, while the jobs over the waters write to 2 + 2*terms
+    std::size_t bytes = p_aa_all.instance_bytes();
+    auto job_sizes = utility::memory::job_sizes({{data_a_size, (1 + 2*terms.size())*bytes}, {data_w_size, (2 + 2*terms.size())*bytes}});
+    int job_size_a = job_sizes[0];
+    int job_size_w = job_sizes[1];
+    for (int i = 0; i < data_a_size; i+=job_size_a) {
+        tasks.run([&calc_aa, i, job_size_a, data_a_size] () {calc_aa(i, std::min(i+job_size_a, data_a_size));});
+    }
+    for (int i = 0; i < data_w_size; i+=job_size_w) {
+        tasks.run([&calc_aw, i, job_size_w, data_w_size] () {calc_aw(i, std::min(i+job_size_w, data_w_size));});
+        tasks.run([&calc_ww, i, job_size_w, data_w_size] () {calc_ww(i, std::min(i+job_size_w, data_w_size));});
+    }
+    for (unsigned int t = 0; t < terms.size(); ++t) {
+        for (int i = 0; i < data_a_size; i+=job_size_a) {
+            tasks.run([&calc_cross_a, t, i, job_size_a, data_a_size] () {calc_cross_a(t, i, std::min(i+job_size_a, data_a_size));});
+        }
+        for (int i = 0; i < data_w_size; i+=job_size_w) {
+            tasks.run([&calc_cross_w, t, i, job_size_w, data_w_size] () {calc_cross_w(t, i, std::min(i+job_size_w, data_w_size));});
+        }
+    }
+    tasks.wait();
+
+    GenericDistribution1D_t p_aa = p_aa_all.merge();
+    GenericDistribution1D_t p_aw = p_aw_all.merge();
+    GenericDistribution1D_t p_ww = p_ww_all.merge();
+
+    //###################//
+    // SELF-CORRELATIONS //
+    //###################//
+    p_aa.add(0, std::accumulate(data_a.get_data().begin(), data_a.get_data().end(), 0.0, [](double sum, const hist::detail::CompactCoordinatesData& val) {return sum + val.value.w*val.value.w;} ));
+    p_ww.add(0, std::accumulate(data_w.get_data().begin(), data_w.get_data().end(), 0.0, [](double sum, const hist::detail::CompactCoordinatesData& val) {return sum + val.value.w*val.value.w;} ));
+
+    //###############//
+    // COMBINE TERMS //
+    //###############//
+    // every copy contributes the histogram of the unit with itself, and every pair of copies contributes one of the cross histograms
+    double copies = symmetry->copies();
+    for (unsigned int i = 0; i < bins; ++i) {
+        p_aa.index(i) = copies*p_aa.index(i);
+        p_aw.index(i) = copies*p_aw.index(i);
+        p_ww.index(i) = copies*p_ww.index(i);
+    }
+    for (unsigned int t = 0; t < terms.size(); ++t) {
+        double multiplicity = terms[t].multiplicity;
+        GenericDistribution1D_t c_aa = p_aa_cross[t]->merge();
+        GenericDistribution1D_t c_aw = p_aw_cross[t]->merge();
+        GenericDistribution1D_t c_ww = p_ww_cross[t]->merge();
+        for (unsigned int i = 0; i < bins; ++i) {
+            p_aa.index(i) += multiplicity*c_aa.index(i);
+            p_aw.index(i) += multiplicity*c_aw.index(i);
+            p_ww.index(i) += multiplicity*c_ww.index(i);
+        }
+    }
+
+    // calculate p_tot
+    GenericDistribution1D_t p_tot(bins);
+    for (unsigned int i = 0; i < p_tot.size(); ++i) {p_tot.index(i) = p_aa.index(i) + p_ww.index(i) + 2*p_aw.index(i);}
+
+    // downsize our axes to only the relevant area
+    unsigned int max_bin = 10; // minimum size is 10
+    for (int i = p_tot.size()-1; i >= 10; i--) {
+        if (p_tot.index(i) != 0) {
+            max_bin = i+1; // +1 since we usually use this for looping (i.e. i < max_bin)
+            break;
+        }
+    }
+    p_aa.resize(max_bin);
+    p_ww.resize(max_bin);
+    p_aw.resize(max_bin);
+    p_tot.resize(max_bin);
+
+    if constexpr (use_weighted_distribution) {
+        return std::make_unique<CompositeDistanceHistogram>(
+            std::move(Distribution1D(p_aa)),
+            std::move(Distribution1D(p_aw)),
+            std::move(Distribution1D(p_ww)),
+            std::move(p_tot)
+        );
+    } else {
+        return std::make_unique<CompositeDistanceHistogram>(
+            std::move(p_aa),
+            std::move(p_aw),
+            std::move(p_ww),
+            std::move(p_tot)
+        );
+    }
+}
+
+template class hist::SymmetryManagerMT<false>;
+template class hist::SymmetryManagerMT<true>;
\ No newline at end of file
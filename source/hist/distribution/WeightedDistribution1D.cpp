@@ -32,12 +32,12 @@ void WeightedDistribution1D::add_index(int32_t i, const detail::WeightedEntry& v
 }
 
 void WeightedDistribution1D::add(float distance, constants::axes::d_type value) {
-    int i = std::round(distance*constants::axes::d_inv_width);
+    int i = std::round(distance*inv_width);
     index(i).add(distance, value);
 }
 
 void WeightedDistribution1D::add2(float distance, constants::axes::d_type value) {
-    int i = std::round(distance*constants::axes::d_inv_width);
+    int i = std::round(distance*inv_width);
     index(i).add2(distance, value);
 }
 
@@ -64,7 +64,7 @@ const constants::axes::d_type& WeightedDistribution1D::get_content(int i) const
 std::vector<double> WeightedDistribution1D::get_weighted_axis() const {
     Distribution1D weights(size());
     for (std::size_t i = 0; i < size(); i++) {
-        weights.index(i) = (!index(i).bin_center*constants::axes::d_vals[i] + index(i).bin_center)/(!index(i).count + index(i).count); // avoid division by zero
+        weights.index(i) = (!index(i).bin_center*(i*width) + index(i).bin_center)/(!index(i).count + index(i).count); // avoid division by zero
     }
     return weights;
 }
@@ -23,26 +23,26 @@ WeightedDistribution3D::WeightedDistribution3D(const Distribution3D& other) : Co
 }
 
 void WeightedDistribution3D::add(unsigned int x, unsigned int y, float distance, constants::axes::d_type value) {
-    int i = std::round(distance*constants::axes::d_inv_width);
+    int i = std::round(distance*inv_width);
     index(x, y, i).add(distance, value);
 }
 
 void WeightedDistribution3D::add2(unsigned int x, unsigned int y, float distance, constants::axes::d_type value) {
-    int i = std::round(distance*constants::axes::d_inv_width);
+    int i = std::round(distance*inv_width);
     index(x, y, i).add2(distance, value);
 }
 
 std::vector<double> WeightedDistribution3D::get_weights() const {
     std::vector<double> weights(size_z());
     for (std::size_t z = 0; z < size_z(); z++) {
-        unsigned int count = 0;
+        std::uint64_t count = 0;
         for (std::size_t x = 0; x < size_x(); x++) {
             for (std::size_t y = 0; y < size_y(); y++) {
                 weights[z] += index(x, y, z).bin_center;
                 count += index(x, y, z).count;
             }
         }
-        weights[z] = !weights[z]*constants::axes::d_vals[z] + weights[z]/(!count + count); // avoid division by zero
+        weights[z] = !weights[z]*(z*width) + weights[z]/(!count + count); // avoid division by zero
     }
     return weights;
 }
\ No newline at end of file
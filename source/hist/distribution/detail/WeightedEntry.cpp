@@ -10,7 +10,7 @@ For more information, please refer to the LICENSE file in the project root.
 using namespace hist::detail;
 
 WeightedEntry::WeightedEntry() = default;
-WeightedEntry::WeightedEntry(constants::axes::d_type value, unsigned int count, double bin_center) : value(value), count(count), bin_center(bin_center) {}
+WeightedEntry::WeightedEntry(constants::axes::d_type value, std::uint64_t count, double bin_center) : value(value), count(count), bin_center(bin_center) {}
 
 void WeightedEntry::add(float distance, double value) {
     ++count;
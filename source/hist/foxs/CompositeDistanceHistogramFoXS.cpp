@@ -10,6 +10,7 @@ For more information, please refer to the LICENSE file in the project root.
 #include <table/ArrayDebyeTable.h>
 #include <settings/HistogramSettings.h>
 #include <constants/ConstantsMath.h>
+#include <utility/Trace.h>
 
 using namespace hist;
 
@@ -46,6 +47,7 @@ static auto ff_aa_table = form_factor::foxs::storage::atomic::generate_table();
 static auto ff_ax_table = form_factor::foxs::storage::cross::generate_table();
 static auto ff_xx_table = form_factor::foxs::storage::exv::generate_table();
 ScatteringProfile CompositeDistanceHistogramFoXS::debye_transform() const {
+    TRACE_ZONE("CompositeDistanceHistogramFoXS::debye_transform");
     auto sinqd_table = get_sinc_table();
     Axis debye_axis = constants::axes::q_axis.sub_axis(settings::axes::qmin, settings::axes::qmax);
     unsigned int q0 = constants::axes::q_axis.get_bin(settings::axes::qmin); // account for a possibly different qmin
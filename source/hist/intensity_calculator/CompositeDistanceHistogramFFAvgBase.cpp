@@ -9,6 +9,7 @@ For more information, please refer to the LICENSE file in the project root.
 #include <form_factor/FormFactor.h>
 #include <form_factor/PrecalculatedFormFactorProduct.h>
 #include <settings/HistogramSettings.h>
+#include <utility/Trace.h>
 
 using namespace hist;
 
@@ -41,6 +42,7 @@ double CompositeDistanceHistogramFFAvgBase<FormFactorTableType>::exv_factor(doub
 
 template<typename FormFactorTableType>
 ScatteringProfile CompositeDistanceHistogramFFAvgBase<FormFactorTableType>::debye_transform() const {
+    TRACE_ZONE("CompositeDistanceHistogramFFAvg::debye_transform");
     const auto& ff_table = get_ff_table();
     auto sinqd_table = get_sinc_table();
 
@@ -12,6 +12,7 @@ For more information, please refer to the LICENSE file in the project root.
 #include <settings/HistogramSettings.h>
 #include <constants/ConstantsMath.h>
 #include <math/ConstexprMath.h>
+#include <utility/Trace.h>
 
 using namespace hist;
 
@@ -48,6 +49,7 @@ double CompositeDistanceHistogramFFExplicit::exv_factor(double q) const {
 
 // static unsigned int qcheck = 26;
 // ScatteringProfile CompositeDistanceHistogramFFExplicit::debye_transform() const {
+    TRACE_ZONE("CompositeDistanceHistogramFFExplicit::debye_transform");
 //     const auto& ff_aa_table = form_factor::storage::get_precalculated_form_factor_table();
 //     const auto& ff_ax_table = form_factor::storage::cross::get_precalculated_form_factor_table();
 //     const auto& ff_xx_table = form_factor::storage::exv::get_precalculated_form_factor_table();
@@ -11,6 +11,7 @@ For more information, please refer to the LICENSE file in the project root.
 #include <table/ArrayDebyeTable.h>
 #include <settings/GridSettings.h>
 #include <settings/HistogramSettings.h>
+#include <utility/Trace.h>
 
 using namespace hist;
 using namespace form_factor;
@@ -72,6 +73,7 @@ form_factor::storage::atomic::table_t CompositeDistanceHistogramFFGrid::generate
 }
 
 ScatteringProfile CompositeDistanceHistogramFFGrid::debye_transform() const {
+    TRACE_ZONE("CompositeDistanceHistogramFFGrid::debye_transform");
     const auto& ff_table = get_ff_table();
     auto sinqd_table = get_sinc_table();
     auto sinqd_table_x = get_sinc_table_x();
@@ -134,8 +136,8 @@ ScatteringProfile CompositeDistanceHistogramFFGrid::get_profile_xx() const {
 }
 
 observer_ptr<const table::DebyeTable> CompositeDistanceHistogramFFGrid::get_sinc_table_x() const {
-    if (use_weighted_table) {return weighted_sinc_table_x.get();}
-    return &table::ArrayDebyeTable::get_default_table();
+    if (weighted_sinc_table_x) {return weighted_sinc_table_x.get();}
+    return get_sinc_table(); // unweighted bins share the distance axis of the other histograms
 }
 
 void CompositeDistanceHistogramFFGrid::initialize(std::vector<double>&& d_axis_x) {
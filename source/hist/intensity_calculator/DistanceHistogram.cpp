@@ -7,11 +7,14 @@ For more information, please refer to the LICENSE file in the project root.
 #include <hist/intensity_calculator/DistanceHistogram.h>
 #include <hist/intensity_calculator/CompositeDistanceHistogram.h>
 #include <hist/Histogram.h>
+#include <hist/detail/DistanceAxis.h>
 #include <table/ArrayDebyeTable.h>
 #include <table/VectorDebyeTable.h>
 #include <dataset/SimpleDataset.h>
 #include <settings/HistogramSettings.h>
 #include <constants/Constants.h>
+#include <utility/Trace.h>
+
 
 using namespace hist;
 
@@ -19,11 +22,11 @@ DistanceHistogram::DistanceHistogram() = default;
 
 DistanceHistogram::DistanceHistogram(DistanceHistogram&& other) = default;
 
-DistanceHistogram::DistanceHistogram(hist::Distribution1D&& p_tot) : Histogram(std::move(p_tot.get_data()), Axis(0, p_tot.size()*constants::axes::d_axis.width(), p_tot.size())) {
+DistanceHistogram::DistanceHistogram(hist::Distribution1D&& p_tot) : Histogram(std::move(p_tot.get_data()), Axis(0, p_tot.size()*settings::axes::distance_bin_width, p_tot.size())) {
     initialize();
 }
 
-DistanceHistogram::DistanceHistogram(hist::WeightedDistribution1D&& p_tot) : Histogram(p_tot.get_content(), Axis(0, p_tot.size()*constants::axes::d_axis.width(), p_tot.size())) {
+DistanceHistogram::DistanceHistogram(hist::WeightedDistribution1D&& p_tot) : Histogram(p_tot.get_content(), Axis(0, p_tot.size()*settings::axes::distance_bin_width, p_tot.size())) {
     initialize(p_tot.get_weighted_axis());
     use_weighted_sinc_table();
 }
@@ -52,10 +55,17 @@ void DistanceHistogram::initialize(std::vector<double>&& d_axis) {
 void DistanceHistogram::initialize() {
     d_axis = axis.as_vector();
     d_axis[0] = 0; // fix the first bin to 0 since it primarily contains self-correlation terms
+
+    // the default table is only valid for the default bin width
+    if (!detail::is_default_bin_width(axis.width())) {
+        use_weighted_sinc_table();
+        return;
+    }
     table::ArrayDebyeTable::check_default(d_axis);
 }
 
 ScatteringProfile DistanceHistogram::debye_transform() const {
+    TRACE_ZONE("DistanceHistogram::debye_transform");
     // calculate the Debye scattering intensity
     const auto& q_axis = constants::axes::q_vals;
     Axis debye_axis = constants::axes::q_axis.sub_axis(settings::axes::qmin, settings::axes::qmax);
@@ -91,7 +101,14 @@ SimpleDataset DistanceHistogram::debye_transform(const std::vector<double>& q) c
 const std::vector<double>& DistanceHistogram::get_d_axis() const {return d_axis;}
 
 const std::vector<double>& DistanceHistogram::get_q_axis() {
-    static const std::vector<double> q_vals = constants::axes::q_axis.sub_axis(settings::axes::qmin, settings::axes::qmax).as_vector();
+    // the q-range is part of the settings context, so each thread keeps the axis of the last range it has used
+    // only a single range is kept, such that a long-running process cycling through many ranges does not accumulate axes
+    thread_local std::pair<double, double> range(-1, -1);
+    thread_local std::vector<double> q_vals;
+    if (range != std::make_pair(settings::axes::qmin, settings::axes::qmax)) {
+        range = {settings::axes::qmin, settings::axes::qmax};
+        q_vals = constants::axes::q_axis.sub_axis(settings::axes::qmin, settings::axes::qmax).as_vector();
+    }
     return q_vals;
 }
 
@@ -0,0 +1,35 @@
+/*
+This software is distributed under the GNU General Public License v3.0. 
+For more information, please refer to the LICENSE file in the project root.
+*/
+
+#include <hist/symmetry/HelicalSymmetry.h>
+#include <math/MatrixUtils.h>
+#include <utility/Exceptions.h>
+
+using namespace hist::symmetry;
+
+HelicalSymmetry::HelicalSymmetry(const Vector3<double>& axis, const Vector3<double>& center, double twist, double rise, unsigned int repeats) : center(center) {
+    if (repeats == 0) {throw except::invalid_argument("HelicalSymmetry::HelicalSymmetry: The number of repeats must be at least 1.");}
+    if (axis.norm() == 0) {throw except::invalid_argument("HelicalSymmetry::HelicalSymmetry: The helical axis cannot be zero.");}
+    step = axis*(rise/axis.norm());
+    rotations.reserve(repeats);
+    for (unsigned int k = 0; k < repeats; ++k) {
+        rotations.push_back(matrix::rotation_matrix(axis, twist*k));
+    }
+}
+
+unsigned int HelicalSymmetry::copies() const {return rotations.size();}
+
+Vector3<double> HelicalSymmetry::apply(const Vector3<double>& v, unsigned int copy) const {
+    return rotations[copy]*(v - center) + center + step*copy;
+}
+
+std::vector<CrossTerm> HelicalSymmetry::get_cross_terms() const {
+    unsigned int n = copies();
+    std::vector<CrossTerm> terms;
+    for (unsigned int k = 1; k < n; ++k) {
+        terms.push_back({k, n-k});
+    }
+    return terms;
+}
\ No newline at end of file
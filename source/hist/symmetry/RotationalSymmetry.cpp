@@ -0,0 +1,36 @@
+/*
+This software is distributed under the GNU General Public License v3.0. 
+For more information, please refer to the LICENSE file in the project root.
+*/
+
+#include <hist/symmetry/RotationalSymmetry.h>
+#include <math/MatrixUtils.h>
+#include <constants/ConstantsMath.h>
+#include <utility/Exceptions.h>
+
+using namespace hist::symmetry;
+
+RotationalSymmetry::RotationalSymmetry(const Vector3<double>& axis, const Vector3<double>& center, unsigned int n) : center(center) {
+    if (n == 0) {throw except::invalid_argument("RotationalSymmetry::RotationalSymmetry: The order of the symmetry must be at least 1.");}
+    if (axis.norm() == 0) {throw except::invalid_argument("RotationalSymmetry::RotationalSymmetry: The rotation axis cannot be zero.");}
+    rotations.reserve(n);
+    for (unsigned int k = 0; k < n; ++k) {
+        rotations.push_back(matrix::rotation_matrix(axis, 2*constants::pi*k/n));
+    }
+}
+
+unsigned int RotationalSymmetry::copies() const {return rotations.size();}
+
+Vector3<double> RotationalSymmetry::apply(const Vector3<double>& v, unsigned int copy) const {
+    return rotations[copy]*(v - center) + center;
+}
+
+std::vector<CrossTerm> RotationalSymmetry::get_cross_terms() const {
+    // each of the n copies is paired with the copy k steps further around the axis
+    unsigned int n = copies();
+    std::vector<CrossTerm> terms;
+    for (unsigned int k = 1; 2*k <= n; ++k) {
+        terms.push_back({k, 2*k == n ? n/2 : n});
+    }
+    return terms;
+}
\ No newline at end of file
@@ -17,6 +17,8 @@ For more information, please refer to the LICENSE file in the project root.
 #include <utility/Console.h>
 #include <constants/Constants.h>
 #include <io/ExistingFile.h>
+#include <utility/Trace.h>
+#include <utility/Job.h>
 
 #include <random>
 
@@ -112,9 +114,14 @@ double Grid::get_hydration_radius() const {
 }
 
 std::vector<Water> Grid::hydrate() {
+    TRACE_ZONE("Grid::hydrate");
     // a quick check to verify there are no water molecules already present
     if (w_members.size() != 0) {console::print_warning("Warning in Grid::hydrate: Attempting to hydrate a grid which already contains water!");}
+    utility::job::check_cancelled();
+    utility::job::report_progress("Grid::hydrate", 0, 2);
     std::vector<GridMember<Water>> placed_water = find_free_locs(); // the molecules which were placed by the find_free_locs method
+    utility::job::check_cancelled();
+    utility::job::report_progress("Grid::hydrate", 1, 2);
 
     // assume the protein is a perfect sphere. then we want the number of water molecules to be proportional to the surface area
     double vol = get_volume(); // volume in cubic Ångström
@@ -122,14 +129,19 @@ std::vector<Water> Grid::hydrate() {
     double area = 4*constants::pi*std::pow(r, 2.5); // surface area of the protein in Ångström^2
     double target = settings::grid::water_scaling*area; // the target number of water molecules
 
+    TRACE_ZONE("CullingStrategy::cull");
     water_culler->set_target_count(target);
-    return water_culler->cull(placed_water);
+    auto waters = water_culler->cull(placed_water);
+    utility::job::report_progress("Grid::hydrate", 2, 2);
+    return waters;
 }
 
 std::vector<GridMember<Water>> Grid::find_free_locs() {
+    TRACE_ZONE("Grid::find_free_locs");
     expand_volume();
 
     // place the water molecules with the chosen strategy
+    TRACE_ZONE("PlacementStrategy::place");
     return water_placer->place();
 }
 
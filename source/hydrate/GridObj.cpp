@@ -8,7 +8,9 @@ For more information, please refer to the LICENSE file in the project root.
 
 using namespace grid::detail;
 
-GridObj::GridObj(unsigned int x, unsigned int y, unsigned int z) : container::Container3D<State>(x, y, z, EMPTY) {}
+GridObj::GridObj(unsigned int x, unsigned int y, unsigned int z) : container::Container3D<State>(x, y, z, EMPTY) {
+    account.set(static_cast<std::size_t>(x)*y*z*sizeof(State));
+}
 
 State& GridObj::index(const Vector3<int>& v) {return index(v.x(), v.y(), v.z());}
 const State& GridObj::index(const Vector3<int>& v) const {return index(v.x(), v.y(), v.z());}
@@ -57,7 +57,7 @@ std::vector<data::record::Water> grid::OutlierCulling::cull(std::vector<grid::Gr
         final_water[n] = v[n].first.get_atom();
     }
     for (; n < placed_water.size(); n++) {
-        removed_water[n] = v[n].first.get_atom();
+        removed_water[n-target_count] = v[n].first.get_atom();
     }
 
     grid->remove(removed_water);
@@ -0,0 +1,104 @@
+/*
+This software is distributed under the GNU General Public License v3.0. 
+For more information, please refer to the LICENSE file in the project root.
+*/
+
+#include <math/CubicSplineResampler.h>
+#include <utility/Exceptions.h>
+
+#include <algorithm>
+#include <string>
+
+using namespace math;
+
+CubicSplineResampler::CubicSplineResampler(const std::vector<double>& x, const std::vector<double>& z) {
+    int n = x.size();
+    if (n < 4) {throw except::invalid_argument("CubicSplineResampler::CubicSplineResampler: x must have at least four elements.");}
+
+    // same recursion as CubicSpline::setup, but only the parts independent of y (eq 15, 21 - 25)
+    std::vector<double> h(n-1);
+    inv_h.resize(n-1);
+    inv_h2.resize(n-1);
+    for (int i = 0; i < n-1; ++i) {
+        h[i] = x[i+1]-x[i];
+        if (h[i] <= 0) {throw except::invalid_argument("CubicSplineResampler::CubicSplineResampler: x must be strictly increasing (index " + std::to_string(i) + ").");}
+        inv_h[i] = 1./h[i];
+        inv_h2[i] = inv_h[i]*inv_h[i];
+    }
+
+    std::vector<double> D(n);
+    Q.resize(n-1);
+    h_ratio.resize(n-2);
+    D[0] = 2; Q[0] = 1; D[n-1] = 2;
+    for (int i = 0; i < n-2; ++i) {
+        h_ratio[i] = h[i]/h[i+1];
+        D[i+1] = 2*h_ratio[i] + 2;
+        Q[i+1] = h_ratio[i];
+    }
+    for (int i = 1; i < n; ++i) {
+        D[i] -= Q[i-1]/D[i-1];
+    }
+    inv_D.resize(n);
+    std::transform(D.begin(), D.end(), inv_D.begin(), [] (double v) {return 1./v;});
+
+    // locate the interval of each evaluation point, matching CubicSpline::search
+    unsigned int m = z.size();
+    index.resize(m);
+    dz.resize(m);
+    dz2.resize(m);
+    dz3.resize(m);
+    for (unsigned int k = 0; k < m; ++k) {
+        int i = std::upper_bound(x.begin(), x.end(), z[k]) - x.begin() - 1;
+        i = std::clamp(i, 0, n-2); // special case for interpolating outside the range
+        index[k] = i;
+        dz[k] = z[k] - x[i];
+        dz2[k] = dz[k]*dz[k];
+        dz3[k] = dz2[k]*dz[k];
+    }
+
+    p.resize(n-1);
+    B.resize(n);
+    b.resize(n);
+}
+
+void CubicSplineResampler::resample(const std::vector<double>& y, std::vector<double>& out) const {
+    int n = inv_D.size();
+    if (n != int(y.size())) {throw except::invalid_argument("CubicSplineResampler::resample: y must have the same size as x (" + std::to_string(n) + " != " + std::to_string(y.size()) + ").");}
+
+    for (int i = 0; i < n-1; ++i) {
+        p[i] = (y[i+1]-y[i])*inv_h[i]; // definition of p (eq 6)
+    }
+    B[0] = 3*p[0]; B[n-1] = 3*p[n-2];
+    for (int i = 0; i < n-2; ++i) {
+        B[i+1] = 3*(p[i] + p[i+1]*h_ratio[i]);
+    }
+    for (int i = 1; i < n; ++i) {
+        B[i] -= B[i-1]*inv_D[i-1]; // converting B to Btilde (eq 26)
+    }
+    b[n-1] = B[n-1]*inv_D[n-1];
+    for (int i = n-2; 0 <= i; --i) {
+        b[i] = (B[i] - Q[i]*b[i+1])*inv_D[i]; // definition of b (eq 27)
+    }
+
+    out.resize(index.size());
+    for (unsigned int k = 0; k < index.size(); ++k) {
+        unsigned int i = index[k];
+        double c = (-2*b[i] - b[i+1] + 3*p[i])*inv_h[i];  // definition of c (eq 18)
+        double d = (b[i] + b[i+1] - 2*p[i])*inv_h2[i];    // definition of d (eq 18)
+        out[k] = y[i] + b[i]*dz[k] + c*dz2[k] + d*dz3[k];
+    }
+}
+
+std::vector<double> CubicSplineResampler::resample(const std::vector<double>& y) const {
+    std::vector<double> out(index.size());
+    resample(y, out);
+    return out;
+}
+
+unsigned int CubicSplineResampler::size_in() const noexcept {
+    return inv_D.size();
+}
+
+unsigned int CubicSplineResampler::size_out() const noexcept {
+    return index.size();
+}
\ No newline at end of file
@@ -0,0 +1,82 @@
+/*
+This software is distributed under the GNU General Public License v3.0. 
+For more information, please refer to the LICENSE file in the project root.
+*/
+
+#include <math/FFT.h>
+#include <utility/MultiThreading.h>
+#include <utility/Exceptions.h>
+
+#include <algorithm>
+#include <string>
+#include <numbers>
+
+void math::fft(std::vector<std::complex<double>>& data, bool inverse) {
+    unsigned int n = data.size();
+    if (n == 0 || (n & (n-1)) != 0) {throw except::invalid_argument("math::fft: The size must be a power of two (got " + std::to_string(n) + ").");}
+
+    // bit-reversal permutation
+    for (unsigned int i = 1, j = 0; i < n; ++i) {
+        unsigned int bit = n >> 1;
+        for (; j & bit; bit >>= 1) {j ^= bit;}
+        j ^= bit;
+        if (i < j) {std::swap(data[i], data[j]);}
+    }
+
+    // butterflies
+    double sign = inverse ? 1 : -1;
+    for (unsigned int len = 2; len <= n; len <<= 1) {
+        std::complex<double> wlen = std::polar(1.0, sign*2*std::numbers::pi/len);
+        for (unsigned int i = 0; i < n; i += len) {
+            std::complex<double> w = 1;
+            for (unsigned int j = 0; j < len/2; ++j) {
+                std::complex<double> u = data[i+j];
+                std::complex<double> v = data[i+j+len/2]*w;
+                data[i+j] = u + v;
+                data[i+j+len/2] = u - v;
+                w *= wlen;
+            }
+        }
+    }
+}
+
+namespace {
+    /**
+     * @brief Transform all lines of a three-dimensional array along a single axis. 
+     * 
+     * @param count The number of lines.
+     * @param length The length of each line.
+     * @param offset Maps a line index to the index of its first element.
+     * @param stride The distance between consecutive elements of a line.
+     */
+    template<typename F>
+    void transform_lines(std::vector<std::complex<double>>& data, unsigned int count, unsigned int length, F&& offset, unsigned int stride, bool inverse) {
+        utility::multi_threading::TaskGroup tasks;
+        unsigned int jobs = std::min<unsigned int>(count, tasks.get_scheduler()->get_thread_count());
+        for (unsigned int job = 0; job < jobs; ++job) {
+            tasks.run([&data, count, length, &offset, stride, inverse, job, jobs] () {
+                std::vector<std::complex<double>> line(length);
+                for (unsigned int i = job; i < count; i += jobs) {
+                    std::size_t start = offset(i);
+                    for (unsigned int j = 0; j < length; ++j) {line[j] = data[start + std::size_t(j)*stride];}
+                    math::fft(line, inverse);
+                    for (unsigned int j = 0; j < length; ++j) {data[start + std::size_t(j)*stride] = line[j];}
+                }
+            });
+        }
+        tasks.wait();
+    }
+}
+
+void math::fft3(std::vector<std::complex<double>>& data, unsigned int nx, unsigned int ny, unsigned int nz, bool inverse) {
+    if (data.size() != std::size_t(nx)*ny*nz) {throw except::invalid_argument("math::fft3: The data size does not match the dimensions.");}
+    transform_lines(data, nx*ny, nz, [nz] (unsigned int i) {return std::size_t(i)*nz;}, 1, inverse);
+    transform_lines(data, nx*nz, ny, [ny, nz] (unsigned int i) {return std::size_t(i/nz)*ny*nz + i%nz;}, nz, inverse);
+    transform_lines(data, ny*nz, nx, [] (unsigned int i) {return std::size_t(i);}, ny*nz, inverse);
+}
+
+unsigned int math::next_power_of_two(unsigned int n) {
+    unsigned int p = 1;
+    while (p < n) {p <<= 1;}
+    return p;
+}
\ No newline at end of file
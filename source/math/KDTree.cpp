@@ -0,0 +1,100 @@
+/*
+This software is distributed under the GNU General Public License v3.0. 
+For more information, please refer to the LICENSE file in the project root.
+*/
+
+#include <math/KDTree.h>
+
+#include <algorithm>
+#include <numeric>
+#include <cmath>
+
+using namespace math;
+
+KDTree::KDTree(const std::vector<Vector3<double>>& points) : indices(points.size()), axes(points.size()) {
+    std::iota(indices.begin(), indices.end(), 0);
+    build(points, 0, points.size());
+
+    // store the points in tree order for cache-friendly queries
+    this->points.reserve(points.size());
+    for (unsigned int i : indices) {this->points.push_back(points[i]);}
+}
+
+void KDTree::build(const std::vector<Vector3<double>>& source, unsigned int begin, unsigned int end) {
+    if (end <= begin) {return;}
+    unsigned int mid = (begin + end)/2;
+
+    // split along the axis with the largest extent
+    Vector3<double> min = source[indices[begin]], max = source[indices[begin]];
+    for (unsigned int i = begin+1; i < end; ++i) {
+        const auto& p = source[indices[i]];
+        for (unsigned int k = 0; k < 3; ++k) {
+            min[k] = std::min(min[k], p[k]);
+            max[k] = std::max(max[k], p[k]);
+        }
+    }
+    Vector3<double> extent = max - min;
+    unsigned char axis = extent.x() < extent.y() ? (extent.y() < extent.z() ? 2 : 1) : (extent.x() < extent.z() ? 2 : 0);
+
+    // partition the index range in place around the median
+    std::nth_element(indices.begin() + begin, indices.begin() + mid, indices.begin() + end, [&source, axis] (unsigned int a, unsigned int b) {return source[a][axis] < source[b][axis];});
+    axes[mid] = axis;
+
+    build(source, begin, mid);
+    build(source, mid+1, end);
+}
+
+std::pair<int, double> KDTree::nearest(const Vector3<double>& p, double max_distance) const {
+    int best = -1;
+    double best_d2 = max_distance == std::numeric_limits<double>::infinity() ? max_distance : max_distance*max_distance;
+    nearest(0, points.size(), p, best, best_d2);
+    if (best == -1) {return {-1, max_distance};}
+    return {indices[best], std::sqrt(best_d2)};
+}
+
+void KDTree::nearest(unsigned int begin, unsigned int end, const Vector3<double>& p, int& best, double& best_d2) const {
+    if (end <= begin) {return;}
+    unsigned int mid = (begin + end)/2;
+
+    // ties are resolved in favour of the largest original index
+    double d2 = p.distance2(points[mid]);
+    if (d2 < best_d2 || (d2 == best_d2 && best != -1 && indices[best] < indices[mid])) {
+        best_d2 = d2;
+        best = mid;
+    }
+
+    // search the side containing the query point first, then the other side only if it may contain a point at least as close
+    double diff = p[axes[mid]] - points[mid][axes[mid]];
+    if (diff < 0) {
+        nearest(begin, mid, p, best, best_d2);
+        if (diff*diff <= best_d2) {nearest(mid+1, end, p, best, best_d2);}
+    } else {
+        nearest(mid+1, end, p, best, best_d2);
+        if (diff*diff <= best_d2) {nearest(begin, mid, p, best, best_d2);}
+    }
+}
+
+std::vector<unsigned int> KDTree::radius_search(const Vector3<double>& p, double r) const {
+    std::vector<unsigned int> out;
+    radius_search(0, points.size(), p, r*r, out);
+    return out;
+}
+
+void KDTree::radius_search(unsigned int begin, unsigned int end, const Vector3<double>& p, double r2, std::vector<unsigned int>& out) const {
+    if (end <= begin) {return;}
+    unsigned int mid = (begin + end)/2;
+
+    if (p.distance2(points[mid]) <= r2) {out.push_back(indices[mid]);}
+
+    double diff = p[axes[mid]] - points[mid][axes[mid]];
+    if (diff <= 0 || diff*diff <= r2) {radius_search(begin, mid, p, r2, out);}
+    if (0 <= diff || diff*diff <= r2) {radius_search(mid+1, end, p, r2, out);}
+}
+
+unsigned int KDTree::size() const noexcept {
+    return points.size();
+}
+
+bool KDTree::empty() const noexcept {
+    return points.empty();
+}
\ No newline at end of file
@@ -39,6 +39,31 @@ std::pair<double, double> SimpleLeastSquares::fit_params_only() {
     return std::make_pair(a, b);
 }
 
+std::pair<double, double> SimpleLeastSquares::fit_params_only(std::span<const double> x, std::span<const double> y, std::span<const double> w) {
+    double S = 0, Sx = 0, Sy = 0, Sxx = 0, Sxy = 0;
+    for (unsigned int i = 0; i < x.size(); ++i) {
+        S += w[i];
+        Sx += x[i]*w[i];
+        Sy += y[i]*w[i];
+        Sxx += x[i]*x[i]*w[i];
+        Sxy += x[i]*y[i]*w[i];
+    }
+
+    double delta = S*Sxx - Sx*Sx;
+    double a = (S*Sxy - Sx*Sy)/delta;
+    double b = (Sxx*Sy - Sx*Sxy)/delta;
+    return std::make_pair(a, b);
+}
+
+double SimpleLeastSquares::chi2(std::span<const double> x, std::span<const double> y, std::span<const double> w, double a, double b) {
+    double chi = 0;
+    for (unsigned int i = 0; i < x.size(); ++i) {
+        double v = y[i] - (a*x[i] + b);
+        chi += v*v*w[i];
+    }
+    return chi;
+}
+
 double SimpleLeastSquares::fit_chi2_only() {
     fit_params_only();
     return chi2({});
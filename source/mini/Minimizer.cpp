@@ -9,6 +9,8 @@ For more information, please refer to the LICENSE file in the project root.
 #include <mini/detail/Parameter.h>
 #include <mini/detail/FittedParameter.h>
 #include <utility/Exceptions.h>
+#include <utility/Trace.h>
+#include <utility/Job.h>
 
 #include <functional>
 
@@ -27,6 +29,7 @@ Minimizer::Minimizer(std::function<double(std::vector<double>)> f) {
 }
 
 Result Minimizer::minimize() {
+    TRACE_ZONE("Minimizer::minimize");
     if (!is_parameter_set()) {throw except::bad_order("Minimizer::minimize: No parameters were supplied.");}
     if (!is_function_set()) {throw except::bad_order("Minimizer::minimize: No function was set.");}
 
@@ -40,11 +43,16 @@ void Minimizer::set_function(double(&f)(std::vector<double>)) {
 }
 
 void Minimizer::set_function(std::function<double(std::vector<double>)> f) {
-    raw = std::move(f);
+    // a cancelled job is stopped before the next function evaluation
+    raw = [f = std::move(f)] (std::vector<double> p) {
+        utility::job::check_cancelled();
+        return f(std::move(p));
+    };
     wrapper = [this] (std::vector<double> p) {
         double fval = raw(p);
         evaluations.evals.push_back(Evaluation(p, fval));
         fevals++;
+        utility::job::report_progress("Minimizer::minimize", fevals);
         return fval;
     };
 
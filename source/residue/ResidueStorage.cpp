@@ -16,6 +16,7 @@ For more information, please refer to the LICENSE file in the project root.
 #include <filesystem>
 #include <unordered_map>
 #include <regex>
+#include <mutex>
 #include <iostream>
 
 using namespace residue;
@@ -32,6 +33,13 @@ void ResidueStorage::insert(const std::string& name, const ResidueMap& residue)
 }
 
 ResidueMap& ResidueStorage::get(const std::string& name) {
+    {
+        std::shared_lock lock(mutex);
+        if (auto it = data.find(name); it != data.end()) {return it->second;}
+    }
+
+    // another thread may have downloaded the residue while we were waiting for the lock
+    std::unique_lock lock(mutex);
     if (data.find(name) == data.end()) {
         console::print_info("Unknown residue: \"" + name + "\". Attempting to download specification.");
         download_residue(name);
@@ -110,7 +118,7 @@ void ResidueStorage::write_residue(const std::string& name) {
     if (!file.is_open()) {throw except::io_error("ResidueStorage::write_residue: Could not open file: " + path + "master" + ".dat");}
 
     // write the map to the master file
-    auto map = get(name);
+    const auto& map = data.at(name);
     file << "#" << "\n" << name << "\n"; // residue header
     for (const auto& [key, val] : map) {
         file << constants::symbols::write_element_string(key.atom) << " " << key.name << " " << val << "\n";
@@ -29,8 +29,27 @@ For more information, please refer to the LICENSE file in the project root.
 #include <hist/intensity_calculator/CompositeDistanceHistogram.h>
 #include <settings/RigidBodySettings.h>
 #include <settings/GeneralSettings.h>
+#include <settings/SettingsContext.h>
 #include <plots/PlotIntensityFit.h>
 #include <plots/PlotDistance.h>
+#include <utility/Serialization.h>
+#include <io/File.h>
+
+#include <algorithm>
+#include <barrier>
+#include <deque>
+#include <optional>
+#include <sstream>
+#include <limits>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <tuple>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <cstdint>
 
 using namespace rigidbody;
 using namespace rigidbody::constraints;
@@ -55,10 +74,24 @@ void RigidBody::initialize() {
     body_selector = factory::create_selection_strategy(this);
     transform = factory::create_transform_strategy(this);
     constraints = std::make_shared<ConstraintManager>(this);
+    if (settings::rigidbody::seed != 0) {seed(settings::rigidbody::seed);}
+}
+
+void RigidBody::seed(unsigned int seed) {
+    body_selector->seed(seed);
+    parameter_generator->seed(seed);
 }
 
 std::shared_ptr<fitter::Fit> RigidBody::optimize(const std::string& measurement_path) {
-    generate_new_hydration();
+    if (1 < settings::rigidbody::replicas && 1 < settings::rigidbody::speculative_moves) {
+        throw except::invalid_argument("RigidBody::optimize: Parallel tempering and speculative moves cannot be combined. Set either replicas or speculative_moves to 1.");
+    }
+    if (settings::rigidbody::use_checkpointing) {checkpoint_key = checkpoint_hash(measurement_path);}
+    if (1 < settings::rigidbody::replicas) {return optimize_tempered(measurement_path);}
+    if (1 < settings::rigidbody::speculative_moves) {return optimize_speculative(measurement_path);}
+    // resuming from a checkpoint restores the hydration shell, so it only has to be generated for new runs
+    unsigned int start = settings::rigidbody::use_checkpointing ? load_checkpoint() : 0;
+    if (start == 0) {generate_new_hydration();}
     prepare_fitter(measurement_path);
 
     if (settings::general::supplementary_plots) {
@@ -78,7 +111,7 @@ std::shared_ptr<fitter::Fit> RigidBody::optimize(const std::string& measurement_
     io::XYZWriter trajectory(settings::general::output + "trajectory.xyz");
     trajectory.write_frame(this);
 
-    for (unsigned int i = 0; i < settings::rigidbody::iterations; i++) {
+    for (unsigned int i = start; i < settings::rigidbody::iterations; i++) {
         if (optimize_step(best)) [[unlikely]] {
             trajectory.write_frame(this);
             std::cout << "\rIteration " << i << std::endl;
@@ -88,16 +121,503 @@ std::shared_ptr<fitter::Fit> RigidBody::optimize(const std::string& measurement_
                 std::cout << "\rIteration " << i << "          " << std::flush;
             }
         }
+
+        // since the optimization is greedy, the current configuration is always the best one
+        if (settings::rigidbody::use_checkpointing && (i+1) % std::max(1u, settings::rigidbody::checkpoint_interval) == 0) {
+            save_checkpoint(i+1);
+        }
+    }
+
+    save(settings::general::output + "optimized.pdb");
+    if (settings::rigidbody::use_checkpointing) {remove_checkpoint();}
+    update_fitter(fitter);
+    auto fit = fitter->fit();
+    if (calibration != nullptr) {fit->add_parameter(calibration->get_parameter("c"));}
+    return fit;
+}
+
+namespace {
+    struct Replica {
+        std::unique_ptr<RigidBody> rigidbody;                  // The structure optimized by this replica
+        rigidbody::detail::BestConf current;                   // The current configuration of the chain
+        std::vector<data::Body> best_bodies;                   // The bodies of the best configuration seen by this replica
+        std::vector<data::record::Water> best_waters;          // The hydration shell of the best configuration seen by this replica
+        double best_chi2 = std::numeric_limits<double>::max(); // The chi2 of the best configuration seen by this replica
+        double temperature;                                    // The current temperature of this replica
+        std::exception_ptr error;                              // Any exception thrown by the replica thread
+    };
+}
+
+std::shared_ptr<fitter::Fit> RigidBody::optimize_tempered(const std::string& measurement_path) {
+    unsigned int K = settings::rigidbody::replicas;
+    unsigned int swap_interval = std::max(1u, settings::rigidbody::swap_interval);
+
+    // temperature ladder from zero (the classic greedy chain) to max_temperature with roughly geometric spacing
+    std::vector<Replica> replicas(K);
+    std::vector<unsigned int> ladder(K); // ladder[i] is the index of the replica currently at the i'th lowest temperature
+    for (unsigned int i = 0; i < K; ++i) {
+        replicas[i].temperature = settings::rigidbody::max_temperature*(std::pow(2, i) - 1)/(std::pow(2, K-1) - 1);
+        ladder[i] = i;
+    }
+
+    if (settings::general::verbose) {
+        console::print_info("\nStarting parallel-tempering rigid body optimization with " + std::to_string(K) + " replicas.");
+    }
+
+    // the exchange step is run by a single thread while all replicas are waiting at the barrier
+    unsigned int round = 0;
+    double best_chi2 = std::numeric_limits<double>::max();
+    std::mt19937 swap_generator(settings::rigidbody::seed == 0 ? std::random_device{}() : settings::rigidbody::seed);
+    std::uniform_real_distribution<double> swap_dist(0, 1);
+    auto exchange = [&] () noexcept {
+        for (unsigned int i = round++ % 2; i+1 < K; i += 2) {
+            Replica& cold = replicas[ladder[i]];
+            Replica& hot = replicas[ladder[i+1]];
+            double dchi2 = cold.current.chi2 - hot.current.chi2;
+            bool accept = cold.temperature == 0 ? 0 < dchi2 : swap_dist(swap_generator) < std::exp((1/cold.temperature - 1/hot.temperature)*dchi2);
+            if (accept) {
+                std::swap(cold.temperature, hot.temperature);
+                std::swap(ladder[i], ladder[i+1]);
+            }
+        }
+
+        for (const auto& replica : replicas) {
+            if (replica.best_chi2 < best_chi2) {
+                best_chi2 = replica.best_chi2;
+                if (settings::general::verbose) {
+                    std::cout << "\rSwap round " << round << std::endl;
+                    console::print_success("\tRigidBody::optimize_tempered: New best chi2: " + std::to_string(best_chi2));
+                }
+            }
+        }
+    };
+    std::barrier sync(K, exchange);
+
+    // the replicas write a frame whenever one of them improves on the best configuration seen so far
+    io::XYZWriter trajectory(settings::general::output + "trajectory.xyz");
+    trajectory.write_frame(this);
+    std::mutex trajectory_mutex;
+    double trajectory_chi2 = std::numeric_limits<double>::max();
+
+    // each replica lives on its own thread for the entire run, since the histogram managers keep thread-local state
+    // note that the global pool cannot be used here, since the histogram managers wait on it
+    settings::Context context; // the threads must run with the settings of this thread
+    auto run_replica = [&] (unsigned int k) {
+        settings::ScopedContext scope(context);
+        Replica& replica = replicas[k];
+        try {
+            replica.rigidbody = std::make_unique<RigidBody>(static_cast<const data::Molecule&>(*this));
+            auto& rigidbody = *replica.rigidbody;
+            rigidbody.calibration = calibration;
+            if (settings::rigidbody::seed != 0) {rigidbody.seed(settings::rigidbody::seed + k);}
+            rigidbody.generate_new_hydration();
+            rigidbody.prepare_fitter(measurement_path);
+            replica.current = detail::BestConf(std::make_shared<grid::Grid>(*rigidbody.get_grid()), rigidbody.get_waters(), rigidbody.fitter->fit_chi2_only());
+            replica.best_bodies = rigidbody.get_bodies();
+            replica.best_waters = replica.current.waters;
+            replica.best_chi2 = replica.current.chi2;
+        } catch (...) {
+            replica.error = std::current_exception();
+            sync.arrive_and_drop();
+            return;
+        }
+        sync.arrive_and_wait();
+
+        std::mt19937 generator(settings::rigidbody::seed == 0 ? std::random_device{}() : settings::rigidbody::seed + k);
+        std::uniform_real_distribution<double> dist(0, 1);
+        try {
+            auto& rigidbody = *replica.rigidbody;
+            for (unsigned int i = 0; i < settings::rigidbody::iterations; ++i) {
+                if (rigidbody.optimize_step(replica.current, replica.temperature, dist(generator)) && replica.current.chi2 < replica.best_chi2) {
+                    replica.best_bodies = rigidbody.get_bodies();
+                    replica.best_waters = replica.current.waters;
+                    replica.best_chi2 = replica.current.chi2;
+
+                    std::lock_guard lock(trajectory_mutex);
+                    if (replica.best_chi2 < trajectory_chi2) {
+                        trajectory_chi2 = replica.best_chi2;
+                        trajectory.write_frame(&rigidbody);
+                    }
+                }
+                if ((i+1) % swap_interval == 0) {sync.arrive_and_wait();}
+            }
+        } catch (...) {
+            replica.error = std::current_exception();
+            sync.arrive_and_drop();
+        }
+    };
+
+    {
+        std::vector<std::jthread> threads;
+        threads.reserve(K);
+        for (unsigned int k = 0; k < K; ++k) {
+            threads.emplace_back(run_replica, k);
+        }
+    }
+    for (const auto& replica : replicas) {
+        if (replica.error) {std::rethrow_exception(replica.error);}
+    }
+
+    // transfer the best configuration back to this structure
+    auto best = std::min_element(replicas.begin(), replicas.end(), [] (const Replica& a, const Replica& b) {return a.best_chi2 < b.best_chi2;});
+    adopt_configuration(best->best_bodies, std::move(best->best_waters));
+    replicas.clear();
+    prepare_fitter(measurement_path);
+    if (settings::general::verbose) {
+        std::cout << "\tBest chi2: " << best_chi2 << std::endl;
+    }
+
+    save(settings::general::output + "optimized.pdb");
+    update_fitter(fitter);
+    auto fit = fitter->fit();
+    if (calibration != nullptr) {fit->add_parameter(calibration->get_parameter("c"));}
+    return fit;
+}
+
+namespace {
+    struct Candidate {
+        unsigned int ibody, iconstraint;                // The constraint to transform along
+        rigidbody::parameter::Parameter param;          // The move to evaluate
+        std::string state;                              // The generator states before this candidate was drawn. Only stored with checkpointing.
+    };
+
+    struct Worker {
+        RigidBody* rigidbody;                           // The structure used to evaluate candidate moves
+        std::unique_ptr<RigidBody> copy;                // The owned copy of the structure. Empty for the first worker, which uses the original structure.
+        rigidbody::detail::BestConf current;            // The committed configuration
+        bool active = false;                            // Whether this worker evaluates a candidate in the current step
+        double chi2;                                    // The chi2 of the candidate move
+        std::exception_ptr error;                       // Any exception thrown by the worker
+    };
+}
+
+std::shared_ptr<fitter::Fit> RigidBody::optimize_speculative(const std::string& measurement_path) {
+    unsigned int M = settings::rigidbody::speculative_moves;
+
+    // the first worker is this structure itself, and runs on the calling thread
+    unsigned int start = settings::rigidbody::use_checkpointing ? load_checkpoint() : 0;
+    if (start == 0) {generate_new_hydration();}
+    prepare_fitter(measurement_path);
+
+    std::vector<Worker> workers(M);
+    workers[0].rigidbody = this;
+    workers[0].current = detail::BestConf(std::make_shared<grid::Grid>(*get_grid()), get_waters(), fitter->fit_chi2_only());
+
+    // the candidates are drawn in the same order as the serial optimization
+    // candidates drawn after the committed one are kept and evaluated again from the new configuration
+    std::deque<Candidate> pending;
+    unsigned int iteration = start;
+    auto draw_candidates = [&] () {
+        while (pending.size() < std::min<unsigned int>(M, settings::rigidbody::iterations - iteration)) {
+            Candidate candidate;
+            if (settings::rigidbody::use_checkpointing) {candidate.state = save_generator_state();}
+            std::tie(candidate.ibody, candidate.iconstraint) = body_selector->next();
+            candidate.param = parameter_generator->next();
+            pending.push_back(std::move(candidate));
+        }
+        for (unsigned int k = 0; k < M; ++k) {workers[k].active = k < pending.size();}
+    };
+    draw_candidates();
+
+    io::XYZWriter trajectory(settings::general::output + "trajectory.xyz");
+    trajectory.write_frame(this);
+    if (settings::general::verbose) {
+        console::print_info("\nStarting rigid body optimization with " + std::to_string(M) + " speculative moves.");
+        std::cout << "\tInitial chi2: " << workers[0].current.chi2 << std::endl;
+    }
+
+    // the selection step is run by a single thread while all workers are waiting at the barrier
+    // the first improving candidate is committed, exactly as if the candidates had been evaluated one at a time
+    int winner = -1;
+    unsigned int checkpoint_interval = std::max(1u, settings::rigidbody::checkpoint_interval);
+    auto select = [&] () noexcept {
+        winner = -1;
+        unsigned int evaluated = 0;
+        for (unsigned int k = 0; k < M && workers[k].active; ++k) {
+            ++evaluated;
+            if (workers[k].chi2 < workers[k].current.chi2) {
+                winner = k;
+                break;
+            }
+        }
+
+        if (winner != -1) [[unlikely]] {
+            auto& w = workers[winner];
+            w.current = detail::BestConf(std::make_shared<grid::Grid>(*w.rigidbody->get_grid()), w.rigidbody->get_waters(), w.chi2);
+            trajectory.write_frame(w.rigidbody);
+            std::cout << "\rIteration " << iteration + winner << std::endl;
+            console::print_success("\tRigidBody::optimize_speculative: Accepted changes. New best chi2: " + std::to_string(w.chi2));
+        } else if (settings::general::verbose) [[likely]] {
+            std::cout << "\rIteration " << iteration + evaluated - 1 << "          " << std::flush;
+        }
+        pending.erase(pending.begin(), pending.begin() + evaluated);
+        iteration += evaluated;
+    };
+
+    // after synchronization, all workers hold the committed configuration
+    bool checkpoint_error = false;
+    unsigned int last_checkpoint = start;
+    auto synchronize = [&] () noexcept {
+        if (settings::rigidbody::use_checkpointing && last_checkpoint/checkpoint_interval < iteration/checkpoint_interval) {
+            // the generators have already drawn the pending candidates, so their state from before the first pending draw is stored instead
+            try {
+                save_checkpoint(iteration, pending.empty() ? save_generator_state() : pending.front().state);
+                last_checkpoint = iteration;
+            } catch (...) {
+                checkpoint_error = true;
+            }
+        }
+        draw_candidates();
+    };
+    std::barrier evaluated(M, select);
+    std::barrier synchronized(M, synchronize);
+    std::barrier ready(M);
+
+    // each worker lives on its own thread for the entire run, since the histogram managers keep thread-local state
+    // note that the global pool cannot be used here, since the histogram managers wait on it
+    settings::Context context; // the threads must run with the settings of this thread
+    auto run_worker = [&] (unsigned int k) {
+        std::optional<settings::ScopedContext> scope;
+        if (k != 0) {scope.emplace(context);}
+        Worker& worker = workers[k];
+
+        // the copies start from the configuration of this structure. they only need their own grid, histogram manager and fitter
+        try {
+            if (k != 0) {
+                worker.copy = std::make_unique<RigidBody>(static_cast<const data::Molecule&>(*this));
+                worker.rigidbody = worker.copy.get();
+                auto& rigidbody = *worker.rigidbody;
+                rigidbody.calibration = calibration;
+                rigidbody.get_waters() = get_waters();
+                rigidbody.signal_modified_hydration_layer();
+                *rigidbody.get_grid() = *get_grid();
+                rigidbody.prepare_fitter(measurement_path);
+                worker.current = workers[0].current;
+            }
+        } catch (...) {
+            worker.error = std::current_exception();
+        }
+        ready.arrive_and_wait();
+
+        while (iteration < settings::rigidbody::iterations) {
+            try {
+                if (worker.error) {throw except::unexpected("RigidBody::optimize_speculative: A worker failed.");}
+                if (worker.active) {
+                    auto& rigidbody = *worker.rigidbody;
+                    const auto& candidate = pending[k];
+                    DistanceConstraint& constraint = rigidbody.constraints->distance_constraints_map.at(candidate.ibody).at(candidate.iconstraint).get();
+                    Matrix R = matrix::rotation_matrix(candidate.param.alpha, candidate.param.beta, candidate.param.gamma);
+                    rigidbody.transform->apply(R, candidate.param.dr, constraint);
+                    rigidbody.generate_new_hydration();
+                    rigidbody.update_fitter(rigidbody.fitter);
+                    worker.chi2 = rigidbody.fitter->fit_chi2_only();
+                }
+            } catch (...) {
+                if (!worker.error) {worker.error = std::current_exception();}
+                worker.chi2 = std::numeric_limits<double>::max();
+            }
+            bool moved = worker.active;
+            evaluated.arrive_and_wait();
+
+            // synchronize with the committed configuration
+            // the winner is only read during this phase, so all other workers can copy from it concurrently
+            try {
+                if (!worker.error && winner != int(k)) {
+                    auto& rigidbody = *worker.rigidbody;
+                    if (moved) {rigidbody.transform->undo();}
+                    if (winner == -1) {
+                        if (moved) {
+                            *rigidbody.get_grid() = *worker.current.grid;
+                            rigidbody.get_waters() = worker.current.waters;
+                        }
+                    } else {
+                        const auto& w = workers[winner];
+                        for (unsigned int ibody : w.rigidbody->transform->get_modified_bodies()) {
+                            rigidbody.get_body(ibody) = w.rigidbody->get_body(ibody);
+                        }
+                        *rigidbody.get_grid() = *w.current.grid;
+                        rigidbody.get_waters() = w.current.waters;
+                        worker.current = w.current;
+                    }
+                }
+            } catch (...) {
+                if (!worker.error) {worker.error = std::current_exception();}
+            }
+            synchronized.arrive_and_wait();
+        }
+    };
+
+    {
+        std::vector<std::jthread> threads;
+        threads.reserve(M-1);
+        for (unsigned int k = 1; k < M; ++k) {
+            threads.emplace_back(run_worker, k);
+        }
+        run_worker(0);
+    }
+    for (const auto& worker : workers) {
+        if (worker.error) {std::rethrow_exception(worker.error);}
     }
+    if (checkpoint_error) {throw except::io_error("RigidBody::optimize_speculative: Could not write checkpoint file.");}
+    workers.clear();
 
+    // this structure is the first worker, so it already holds the committed configuration
     save(settings::general::output + "optimized.pdb");
+    if (settings::rigidbody::use_checkpointing) {remove_checkpoint();}
     update_fitter(fitter);
     auto fit = fitter->fit();
     if (calibration != nullptr) {fit->add_parameter(calibration->get_parameter("c"));}
     return fit;
 }
 
+void RigidBody::adopt_configuration(const std::vector<data::Body>& bodies, std::vector<data::record::Water>&& waters) {
+    for (unsigned int i = 0; i < body_size(); ++i) {
+        get_body(i) = bodies[i];
+    }
+    get_waters() = std::move(waters);
+    signal_modified_hydration_layer();
+    clear_grid();
+}
+
+std::string RigidBody::save_generator_state() const {
+    std::ostringstream out(std::ios::binary);
+    body_selector->save_state(out);
+    parameter_generator->save_state(out);
+    return out.str();
+}
+
+void RigidBody::save_checkpoint(unsigned int iteration) const {
+    save_checkpoint(iteration, save_generator_state());
+}
+
+void RigidBody::save_checkpoint(unsigned int iteration, const std::string& generator_state) const {
+    ::io::File file(settings::general::output + "temp/rigidbody_checkpoint.dat");
+    ::io::File temp(file.path() + ".tmp");
+    temp.create();
+
+    std::ofstream out(temp, std::ios::binary);
+    if (!out.is_open()) {throw except::io_error("RigidBody::save_checkpoint: Could not open checkpoint file \"" + temp.path() + "\".");}
+
+    // the number of completed iterations, the total number, and the key of the measurement and initial structure, so we can check that the checkpoint belongs to this run when loading
+    utility::serialization::write(out, iteration);
+    utility::serialization::write(out, settings::rigidbody::iterations);
+    utility::serialization::write(out, checkpoint_key);
+
+    // the coordinates of all bodies
+    utility::serialization::write(out, body_size());
+    for (const auto& body : get_bodies()) {
+        std::vector<double> coords;
+        coords.reserve(3*body.atom_size());
+        for (const auto& atom : body.get_atoms()) {
+            coords.insert(coords.end(), {atom.coords.x(), atom.coords.y(), atom.coords.z()});
+        }
+        utility::serialization::write(out, coords);
+    }
+
+    // the coordinates of the hydration shell
+    std::vector<double> coords;
+    coords.reserve(3*get_waters().size());
+    for (const auto& water : get_waters()) {
+        coords.insert(coords.end(), {water.coords.x(), water.coords.y(), water.coords.z()});
+    }
+    utility::serialization::write(out, coords);
+
+    // the random number generator states
+    out.write(generator_state.data(), generator_state.size());
+    out.close();
+    if (!out) {throw except::io_error("RigidBody::save_checkpoint: Could not write checkpoint file \"" + temp.path() + "\".");}
+
+    // atomically replace the old checkpoint, so a crash during writing never leaves a corrupt file behind
+    std::filesystem::rename(temp.path(), file.path());
+}
+
+std::uint64_t RigidBody::checkpoint_hash(const std::string& measurement_path) const {
+    // FNV-1a hash of the raw measurement file and the exact bits of the atomic coordinates
+    std::uint64_t h = 14695981039346656037ull;
+    auto add = [&h] (const char* data, std::size_t size) {
+        for (std::size_t i = 0; i < size; ++i) {
+            h ^= static_cast<unsigned char>(data[i]);
+            h *= 1099511628211ull;
+        }
+    };
+
+    std::ifstream in(measurement_path, std::ios::binary);
+    if (!in.is_open()) {throw except::io_error("RigidBody::checkpoint_hash: Could not open measurement file \"" + measurement_path + "\".");}
+    std::string contents{std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>()};
+    add(contents.data(), contents.size());
+
+    for (const auto& body : get_bodies()) {
+        for (const auto& atom : body.get_atoms()) {
+            double coords[3] = {atom.coords.x(), atom.coords.y(), atom.coords.z()};
+            add(reinterpret_cast<const char*>(coords), sizeof(coords));
+        }
+    }
+    return h;
+}
+
+unsigned int RigidBody::load_checkpoint() {
+    ::io::File file(settings::general::output + "temp/rigidbody_checkpoint.dat");
+
+    std::ifstream in(file, std::ios::binary);
+    if (!in.is_open()) {
+        if (settings::general::verbose) {std::cout << "No rigid body checkpoint found. Starting a new optimization." << std::endl;}
+        return 0;
+    }
+
+    unsigned int iteration, iterations;
+    utility::serialization::read(in, iteration);
+    utility::serialization::read(in, iterations);
+    if (iterations != settings::rigidbody::iterations) {throw except::unexpected("RigidBody::load_checkpoint: incompatible checkpoint file. Did you change the settings?");}
+
+    std::uint64_t key;
+    utility::serialization::read(in, key);
+    if (key != checkpoint_key) {throw except::unexpected("RigidBody::load_checkpoint: incompatible checkpoint file. Did you change the measurement or the structure?");}
+
+    std::size_t bodies;
+    utility::serialization::read(in, bodies);
+    if (bodies != body_size()) {throw except::unexpected("RigidBody::load_checkpoint: incompatible checkpoint file. Did you change the structure?");}
+    for (auto& body : get_bodies()) {
+        std::vector<double> coords;
+        utility::serialization::read(in, coords);
+        if (coords.size() != 3*body.atom_size()) {throw except::unexpected("RigidBody::load_checkpoint: incompatible checkpoint file. Did you change the structure?");}
+        auto& atoms = body.get_atoms();
+        for (unsigned int i = 0; i < atoms.size(); ++i) {
+            atoms[i].coords = {coords[3*i], coords[3*i+1], coords[3*i+2]};
+        }
+        body.changed_internal_state();
+        body.changed_external_state();
+    }
+
+    std::vector<double> coords;
+    utility::serialization::read(in, coords);
+    auto& waters = get_waters();
+    waters.clear();
+    waters.reserve(coords.size()/3);
+    for (unsigned int i = 0; i < coords.size()/3; ++i) {
+        waters.push_back(data::record::Water::create_new_water({coords[3*i], coords[3*i+1], coords[3*i+2]}));
+    }
+    signal_modified_hydration_layer();
+
+    body_selector->load_state(in);
+    parameter_generator->load_state(in);
+
+    // rebuild the grid from the restored configuration
+    clear_grid();
+    get_grid()->add(waters);
+
+    if (settings::general::verbose) {std::cout << "Resuming rigid body optimization from checkpoint at iteration " << iteration << "." << std::endl;}
+    return iteration;
+}
+
+void RigidBody::remove_checkpoint() const {
+    ::io::File(settings::general::output + "temp/rigidbody_checkpoint.dat").remove();
+}
+
 bool RigidBody::optimize_step(detail::BestConf& best) {
+    return optimize_step(best, 0, 1);
+}
+
+bool RigidBody::optimize_step(detail::BestConf& current, double temperature, double u) {
     auto grid = get_grid();
 
     // select a body to be modified this iteration
@@ -113,17 +633,20 @@ bool RigidBody::optimize_step(detail::BestConf& best) {
     update_fitter(fitter);
     double new_chi2 = fitter->fit_chi2_only();
 
+    // Metropolis criterion - at zero temperature only strict improvements are accepted
+    bool accept = new_chi2 < current.chi2 || (0 < temperature && u < std::exp((current.chi2 - new_chi2)/temperature));
+
     // if the old configuration was better
-    if (new_chi2 >= best.chi2) {
-        transform->undo();          // undo the body transforms
-        *grid = *best.grid;         // restore the old grid
-        get_waters() = best.waters;     // restore the old waters
+    if (!accept) {
+        transform->undo();              // undo the body transforms
+        *grid = *current.grid;          // restore the old grid
+        get_waters() = current.waters;  // restore the old waters
         return false;
     } else {
         // accept the changes
-        best.grid = std::make_shared<grid::Grid>(*grid);
-        best.waters = get_waters();
-        best.chi2 = new_chi2;
+        current.grid = std::make_shared<grid::Grid>(*grid);
+        current.waters = get_waters();
+        current.chi2 = new_chi2;
         return true;
     }
 }
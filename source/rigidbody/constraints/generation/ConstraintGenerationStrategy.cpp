@@ -4,8 +4,57 @@ For more information, please refer to the LICENSE file in the project root.
 */
 
 #include <rigidbody/constraints/generation/ConstraintGenerationStrategy.h>
+#include <rigidbody/constraints/ConstraintManager.h>
+#include <constants/Constants.h>
+#include <data/Molecule.h>
+#include <data/Body.h>
+#include <data/record/Atom.h>
+
+#include <cmath>
 
 using namespace rigidbody::constraints;
 
 ConstraintGenerationStrategy::ConstraintGenerationStrategy(const ConstraintManager* manager) : manager(manager) {}
-ConstraintGenerationStrategy::~ConstraintGenerationStrategy() = default;
\ No newline at end of file
+ConstraintGenerationStrategy::~ConstraintGenerationStrategy() = default;
+
+std::vector<ConstraintGenerationStrategy::CarbonIndex> ConstraintGenerationStrategy::index_carbons() const {
+    std::vector<CarbonIndex> indices;
+    indices.reserve(manager->protein->body_size());
+    for (const auto& body : manager->protein->get_bodies()) {
+        CarbonIndex index;
+        std::vector<Vector3<double>> coords;
+        for (unsigned int iatom = 0; iatom < body.atom_size(); ++iatom) {
+            const auto& atom = body.get_atom(iatom);
+            if (atom.element != constants::atom_t::C) {continue;}
+            index.atoms.push_back(iatom);
+            coords.push_back(atom.coords);
+        }
+        index.tree = math::KDTree(coords);
+        indices.push_back(std::move(index));
+    }
+    return indices;
+}
+
+std::tuple<int, int, double> ConstraintGenerationStrategy::closest_carbons(const data::Body& body1, const CarbonIndex& index1, const data::Body& body2, const CarbonIndex& index2, double max_distance) {
+    // iterate over the smaller body and query the tree of the larger one
+    bool swapped = index2.atoms.size() < index1.atoms.size();
+    const auto& [small_body, small_index, large_index] = swapped ? std::tie(body2, index2, index1) : std::tie(body1, index1, index2);
+
+    // like the old exhaustive search, ties are resolved in favour of the last pair, with body1's atom as the major key
+    int min_atom1 = -1, min_atom2 = -1;
+    double min_dist = max_distance;
+    for (unsigned int iatom : small_index.atoms) {
+        // bounding the query by the current best distance lets the tree prune most branches, while still returning equally close atoms
+        double bound = min_atom1 == -1 ? max_distance : std::nextafter(min_dist, std::numeric_limits<double>::infinity());
+        auto [j, dist] = large_index.tree.nearest(small_body.get_atom(iatom).coords, bound);
+        if (j == -1) {continue;}
+
+        int iatom1 = swapped ? large_index.atoms[j] : iatom;
+        int iatom2 = swapped ? iatom : large_index.atoms[j];
+        if (min_atom1 != -1 && (min_dist < dist || (dist == min_dist && std::tie(iatom1, iatom2) < std::tie(min_atom1, min_atom2)))) {continue;}
+        min_dist = dist;
+        min_atom1 = iatom1;
+        min_atom2 = iatom2;
+    }
+    return {min_atom1, min_atom2, min_dist};
+}
\ No newline at end of file
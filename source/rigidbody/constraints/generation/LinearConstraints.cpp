@@ -24,30 +24,13 @@ std::vector<DistanceConstraint> LinearConstraints::generate() const {
     std::vector<DistanceConstraint> constraints;
 
     auto& protein = *manager->protein;
+    auto carbons = index_carbons();
     for (unsigned int ibody1 = 0; ibody1 < protein.body_size()-1; ibody1++) {
         unsigned int ibody2 = ibody1 + 1;
 
         const Body& body1 = protein.get_body(ibody1);
         const Body& body2 = protein.get_body(ibody2);
-
-        double min_dist = std::numeric_limits<double>::max();
-        int min_atom1 = -1, min_atom2 = -1;
-        for (unsigned int iatom1 = 0; iatom1 < body1.atom_size(); iatom1++) {
-            const Atom& atom1 = body1.get_atom(iatom1);
-            if (atom1.element != constants::atom_t::C) {continue;}
-
-            for (unsigned int iatom2 = 0; iatom2 < body2.atom_size(); iatom2++) {
-                const Atom& atom2 = body2.get_atom(iatom2);
-                if (atom2.element != constants::atom_t::C) {continue;}
-
-                double dist = atom1.distance(atom2);
-                if (dist > min_dist) {continue;}
-
-                min_dist = dist;
-                min_atom1 = iatom1;
-                min_atom2 = iatom2;
-            }
-        }
+        auto [min_atom1, min_atom2, min_dist] = closest_carbons(body1, carbons[ibody1], body2, carbons[ibody2]);
 
         constraints.emplace_back(manager->protein, ibody1, ibody2, min_atom1, min_atom2);
         if (settings::general::verbose) {
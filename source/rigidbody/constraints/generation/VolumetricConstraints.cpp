@@ -15,6 +15,7 @@ For more information, please refer to the LICENSE file in the project root.
 #include <data/record/Atom.h>
 
 #include <limits>
+#include <cmath>
 
 using namespace rigidbody::constraints;
 using namespace data;
@@ -25,36 +26,18 @@ std::vector<DistanceConstraint> VolumetricConstraints::generate() const {
     std::vector<DistanceConstraint> constraints;
 
     auto& protein = *manager->protein;
+    auto carbons = index_carbons();
     for (unsigned int ibody1 = 0; ibody1 < protein.get_bodies().size(); ibody1++) {
         for (unsigned int ibody2 = ibody1+1; ibody2 < protein.get_bodies().size(); ibody2++) {
             const Body& body1 = protein.get_body(ibody1);
             const Body& body2 = protein.get_body(ibody2);
 
-            double min_dist = std::numeric_limits<double>::max();
-            int min_atom1 = -1, min_atom2 = -1;
-            for (unsigned int iatom1 = 0; iatom1 < body1.get_atoms().size(); iatom1++) {
-                const Atom& atom1 = body1.get_atom(iatom1);
-                if (atom1.element != constants::atom_t::C) {continue;}
+            // only pairs close enough for a constraint to make sense are of interest, so the search can be bounded
+            auto [min_atom1, min_atom2, min_dist] = closest_carbons(body1, carbons[ibody1], body2, carbons[ibody2], std::nextafter(settings::rigidbody::bond_distance, std::numeric_limits<double>::infinity()));
 
-                for (unsigned int iatom2 = 0; iatom2 < body2.get_atoms().size(); iatom2++) {
-                    const Atom& atom2 = body2.get_atom(iatom2);
-                    if (atom2.element != constants::atom_t::C) {continue;}
-
-                    double dist = atom1.distance(atom2);
-                    if (dist > min_dist) {continue;}
-
-                    min_dist = dist;
-                    min_atom1 = iatom1;
-                    min_atom2 = iatom2;
-                }
-            }
-
-            // no carbon atoms found
+            // no carbon atoms found within the bond distance
             if (min_atom1 == -1 || min_atom2 == -1) {continue;}
 
-            // check if the bodies are close enough for a constraint to make sense
-            if (min_dist > settings::rigidbody::bond_distance) {continue;} 
-
             constraints.emplace_back(manager->protein, ibody1, ibody2, min_atom1, min_atom2);
             if (settings::general::verbose) {
                 std::cout << "\tConstraint created between bodies " << ibody1 << " and " << ibody2 << " on atoms " << body1.get_atom(min_atom1).name << " and " << body2.get_atom(min_atom2).name << std::endl;
@@ -6,6 +6,7 @@ For more information, please refer to the LICENSE file in the project root.
 #include <rigidbody/parameters/ParameterGenerationStrategy.h>
 #include <rigidbody/parameters/Parameters.h>
 #include <math/Vector3.h>
+#include <utility/Serialization.h>
 
 #include <random>
 
@@ -26,3 +27,19 @@ Parameter ParameterGenerationStrategy::next() {
     iteration++;
     return Parameter(x, rx, ry, rz);
 }
+
+void ParameterGenerationStrategy::seed(unsigned int seed) {
+    generator.seed(seed);
+}
+
+void ParameterGenerationStrategy::save_state(std::ostream& out) const {
+    utility::serialization::write(out, iteration.load());
+    utility::serialization::write_engine(out, generator);
+}
+
+void ParameterGenerationStrategy::load_state(std::istream& in) {
+    unsigned int i;
+    utility::serialization::read(in, i);
+    iteration = i;
+    utility::serialization::read_engine(in, generator);
+}
\ No newline at end of file
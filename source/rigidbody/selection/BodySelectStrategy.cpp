@@ -9,4 +9,10 @@ For more information, please refer to the LICENSE file in the project root.
 
 using namespace rigidbody::selection;
 
-BodySelectStrategy::BodySelectStrategy(const RigidBody* rigidbody) : rigidbody(rigidbody), N(rigidbody->body_size()) {}
\ No newline at end of file
+BodySelectStrategy::BodySelectStrategy(const RigidBody* rigidbody) : rigidbody(rigidbody), N(rigidbody->body_size()) {}
+
+void BodySelectStrategy::seed(unsigned int) {}
+
+void BodySelectStrategy::save_state(std::ostream&) const {}
+
+void BodySelectStrategy::load_state(std::istream&) {}
\ No newline at end of file
@@ -8,6 +8,7 @@ For more information, please refer to the LICENSE file in the project root.
 #include <rigidbody/constraints/DistanceConstraint.h>
 #include <rigidbody/RigidBody.h>
 #include <utility/Exceptions.h>
+#include <utility/Serialization.h>
 
 #include <utility>
 
@@ -35,4 +36,16 @@ std::pair<unsigned int, unsigned int> RandomConstraintSelect::next() {
         }
     }
     throw except::invalid_argument("RandomConstraintSelect::next: Constraint " + std::to_string(iconstraint) + " not found");
+}
+
+void RandomConstraintSelect::seed(unsigned int seed) {
+    generator.seed(seed);
+}
+
+void RandomConstraintSelect::save_state(std::ostream& out) const {
+    utility::serialization::write_engine(out, generator);
+}
+
+void RandomConstraintSelect::load_state(std::istream& in) {
+    utility::serialization::read_engine(in, generator);
 }
\ No newline at end of file
@@ -7,6 +7,7 @@ For more information, please refer to the LICENSE file in the project root.
 #include <rigidbody/constraints/ConstraintManager.h>
 #include <rigidbody/RigidBody.h>
 #include <utility/Exceptions.h>
+#include <utility/Serialization.h>
 
 using namespace rigidbody::selection;
 
@@ -30,12 +31,22 @@ std::pair<unsigned int, unsigned int> RandomSelect::next() {
             return std::make_pair(ibody, 0);
         }
         default: {
-            std::random_device random;
-            std::mt19937 generator2(random());
             std::uniform_int_distribution<int> distribution2(0, rigidbody->get_constraint_manager()->distance_constraints_map.at(ibody).size()-1);
-            unsigned int iconstraint = distribution2(generator2);
+            unsigned int iconstraint = distribution2(generator);
 
             return std::make_pair(ibody, iconstraint);
         }
     }
+}
+
+void RandomSelect::seed(unsigned int seed) {
+    generator.seed(seed);
+}
+
+void RandomSelect::save_state(std::ostream& out) const {
+    utility::serialization::write_engine(out, generator);
+}
+
+void RandomSelect::load_state(std::istream& in) {
+    utility::serialization::read_engine(in, generator);
 }
\ No newline at end of file
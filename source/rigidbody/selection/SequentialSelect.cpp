@@ -6,6 +6,7 @@ For more information, please refer to the LICENSE file in the project root.
 #include <rigidbody/selection/SequentialSelect.h>
 #include <rigidbody/constraints/ConstraintManager.h>
 #include <rigidbody/RigidBody.h>
+#include <utility/Serialization.h>
 
 using namespace rigidbody::selection;
 
@@ -24,3 +25,14 @@ std::pair<unsigned int, unsigned int> SequentialSelect::next() {
 
     return std::make_pair(ibody, iconstraint++);
 }
+
+
+void SequentialSelect::save_state(std::ostream& out) const {
+    utility::serialization::write(out, ibody);
+    utility::serialization::write(out, iconstraint);
+}
+
+void SequentialSelect::load_state(std::istream& in) {
+    utility::serialization::read(in, ibody);
+    utility::serialization::read(in, iconstraint);
+}
\ No newline at end of file
@@ -33,6 +33,15 @@ void TransformStrategy::undo() {
     bodybackup.clear();
 }
 
+std::vector<unsigned int> TransformStrategy::get_modified_bodies() const {
+    std::vector<unsigned int> indices;
+    indices.reserve(bodybackup.size());
+    for (const auto& body : bodybackup) {
+        indices.push_back(body.index);
+    }
+    return indices;
+}
+
 void TransformStrategy::backup(TransformGroup& group) {
     bodybackup.clear();
     for (unsigned int i = 0; i < group.bodies.size(); i++) {
@@ -12,10 +12,13 @@ unsigned int settings::crystal::l = 100;
 
 double settings::crystal::max_q = 1e6; 
 double settings::crystal::grid_expansion = 3;
+bool settings::crystal::use_fft = false;
+bool settings::crystal::use_symmetry = true;
 
 double settings::crystal::reduced::basis_q = 3;
 
 bool settings::crystal::detail::use_checkpointing = true;
+unsigned int settings::crystal::detail::max_fft_memory = 4096;
 
 namespace settings::crystal::io {
     settings::io::SettingSection grid_settings("Crystal", { 
@@ -24,10 +27,13 @@ namespace settings::crystal::io {
         settings::io::create(l, "l"),
         settings::io::create(max_q, "max_q"),
         settings::io::create(grid_expansion, "grid_expansion"),
+        settings::io::create(use_fft, "use_fft"),
+        settings::io::create(use_symmetry, "use_symmetry"),
         settings::io::create(reduced::basis_q, "basis_q")
     });
 }
 
 namespace settings::crystal {
     MillerGenerationChoice miller_generation_strategy = MillerGenerationChoice::All;
+    OrientationChoice orientation_strategy = OrientationChoice::Random;
 }
\ No newline at end of file
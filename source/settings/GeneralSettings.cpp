@@ -12,9 +12,13 @@ constexpr const char* const settings::general::residue_folder = "temp/residues/"
 bool settings::general::verbose = true;
 bool settings::general::warnings = true;
 unsigned int settings::general::threads = std::thread::hardware_concurrency()-1;
+bool settings::general::pin_threads = false;
+unsigned int settings::general::processes = 0;
 std::string settings::general::output = "output/";
 bool settings::general::keep_hydrogens = false;
 bool settings::general::supplementary_plots = true;
+unsigned int settings::general::memory_budget = 0;
+std::string settings::general::table_store = "";
 
 namespace settings::general::detail {
     unsigned int job_size = 800; // The number of atoms to process in each job.
@@ -25,6 +29,10 @@ namespace settings::general::io {
         settings::io::create(verbose, {"verbose", "v"}),
         settings::io::create(warnings, {"warnings", "w"}),
         settings::io::create(threads, {"threads", "t"}),
+        settings::io::create(pin_threads, "pin_threads"),
+        settings::io::create(processes, "processes"),
         settings::io::create(output, {"output", "o"}),
+        settings::io::create(memory_budget, "memory_budget"),
+        settings::io::create(table_store, "table_store"),
     });
 }
\ No newline at end of file
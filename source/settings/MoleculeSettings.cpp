@@ -6,21 +6,21 @@ For more information, please refer to the LICENSE file in the project root.
 #include <settings/MoleculeSettings.h>
 #include <settings/SettingsIORegistry.h>
 
-bool settings::molecule::center = true;
-bool settings::molecule::implicit_hydrogens = true;
-bool settings::molecule::use_effective_charge = true;
+thread_local bool settings::molecule::center = true;
+thread_local bool settings::molecule::implicit_hydrogens = true;
+thread_local bool settings::molecule::use_effective_charge = true;
 
 #if DEBUG
-    bool settings::molecule::throw_on_unknown_atom = true;
+    thread_local bool settings::molecule::throw_on_unknown_atom = true;
 #else
-    bool settings::molecule::throw_on_unknown_atom = false;
+    thread_local bool settings::molecule::throw_on_unknown_atom = false;
 #endif
 
 namespace settings::molecule::io {
     settings::io::SettingSection molecule_settings("Molecule", {
-        settings::io::create(center, "center"),
-        settings::io::create(use_effective_charge, "use_effective_charge"),
-        settings::io::create(throw_on_unknown_atom, "throw_on_unknown_atom"),
-        settings::io::create(implicit_hydrogens, "implicit_hydrogens")
+        settings::io::create([] () -> auto& {return center;}, "center"),
+        settings::io::create([] () -> auto& {return use_effective_charge;}, "use_effective_charge"),
+        settings::io::create([] () -> auto& {return throw_on_unknown_atom;}, "throw_on_unknown_atom"),
+        settings::io::create([] () -> auto& {return implicit_hydrogens;}, "implicit_hydrogens")
     });
 }
\ No newline at end of file
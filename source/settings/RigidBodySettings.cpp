@@ -9,6 +9,13 @@ For more information, please refer to the LICENSE file in the project root.
 
 unsigned int settings::rigidbody::iterations = 1000;
 double settings::rigidbody::bond_distance = 3;
+unsigned int settings::rigidbody::replicas = 1;
+double settings::rigidbody::max_temperature = 10;
+unsigned int settings::rigidbody::swap_interval = 10;
+unsigned int settings::rigidbody::speculative_moves = 1;
+bool settings::rigidbody::use_checkpointing = false;
+unsigned int settings::rigidbody::checkpoint_interval = 50;
+unsigned int settings::rigidbody::seed = 0;
 settings::rigidbody::TransformationStrategyChoice settings::rigidbody::transform_strategy = TransformationStrategyChoice::RigidTransform;
 settings::rigidbody::ParameterGenerationStrategyChoice settings::rigidbody::parameter_generation_strategy = ParameterGenerationStrategyChoice::Simple;
 settings::rigidbody::BodySelectStrategyChoice settings::rigidbody::body_select_strategy = BodySelectStrategyChoice::RandomSelect;
@@ -24,27 +31,34 @@ namespace settings::rigidbody::io {
     settings::io::SettingSection rigidbody_settings("RigidBody", {
         settings::io::create(iterations, "iterations"),
         settings::io::create(bond_distance, "bond_distance"),
+        settings::io::create(replicas, "replicas"),
+        settings::io::create(max_temperature, "max_temperature"),
+        settings::io::create(swap_interval, "swap_interval"),
+        settings::io::create(speculative_moves, "speculative_moves"),
+        settings::io::create(use_checkpointing, "use_checkpointing"),
+        settings::io::create(checkpoint_interval, "checkpoint_interval"),
+        settings::io::create(seed, "seed"),
         settings::io::create(detail::constraints, "constraints"),
         settings::io::create(detail::calibration_file, "calibration_file")
     });
 }
 
-template<> std::string settings::io::detail::SettingRef<settings::rigidbody::TransformationStrategyChoice>::get() const {return std::to_string(static_cast<int>(settingref));}
+template<> std::string settings::io::detail::SettingRef<settings::rigidbody::TransformationStrategyChoice>::get() const {return std::to_string(static_cast<int>(settingref()));}
 template<> void settings::io::detail::SettingRef<settings::rigidbody::TransformationStrategyChoice>::set(const std::vector<std::string>& val) {
-    settingref = static_cast<settings::rigidbody::TransformationStrategyChoice>(std::stoi(val[0]));
+    settingref() = static_cast<settings::rigidbody::TransformationStrategyChoice>(std::stoi(val[0]));
 }
 
-template<> std::string settings::io::detail::SettingRef<settings::rigidbody::ParameterGenerationStrategyChoice>::get() const {return std::to_string(static_cast<int>(settingref));}
+template<> std::string settings::io::detail::SettingRef<settings::rigidbody::ParameterGenerationStrategyChoice>::get() const {return std::to_string(static_cast<int>(settingref()));}
 template<> void settings::io::detail::SettingRef<settings::rigidbody::ParameterGenerationStrategyChoice>::set(const std::vector<std::string>& val) {
-    settingref = static_cast<settings::rigidbody::ParameterGenerationStrategyChoice>(std::stoi(val[0]));
+    settingref() = static_cast<settings::rigidbody::ParameterGenerationStrategyChoice>(std::stoi(val[0]));
 }
 
-template<> std::string settings::io::detail::SettingRef<settings::rigidbody::BodySelectStrategyChoice>::get() const {return std::to_string(static_cast<int>(settingref));}
+template<> std::string settings::io::detail::SettingRef<settings::rigidbody::BodySelectStrategyChoice>::get() const {return std::to_string(static_cast<int>(settingref()));}
 template<> void settings::io::detail::SettingRef<settings::rigidbody::BodySelectStrategyChoice>::set(const std::vector<std::string>& val) {
-    settingref = static_cast<settings::rigidbody::BodySelectStrategyChoice>(std::stoi(val[0]));
+    settingref() = static_cast<settings::rigidbody::BodySelectStrategyChoice>(std::stoi(val[0]));
 }
 
-template<> std::string settings::io::detail::SettingRef<settings::rigidbody::ConstraintGenerationStrategyChoice>::get() const {return std::to_string(static_cast<int>(settingref));}
+template<> std::string settings::io::detail::SettingRef<settings::rigidbody::ConstraintGenerationStrategyChoice>::get() const {return std::to_string(static_cast<int>(settingref()));}
 template<> void settings::io::detail::SettingRef<settings::rigidbody::ConstraintGenerationStrategyChoice>::set(const std::vector<std::string>& val) {
-    settingref = static_cast<settings::rigidbody::ConstraintGenerationStrategyChoice>(std::stoi(val[0]));
+    settingref() = static_cast<settings::rigidbody::ConstraintGenerationStrategyChoice>(std::stoi(val[0]));
 }
\ No newline at end of file
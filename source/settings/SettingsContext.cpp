@@ -0,0 +1,65 @@
+/*
+This software is distributed under the GNU General Public License v3.0. 
+For more information, please refer to the LICENSE file in the project root.
+*/
+
+#include <settings/SettingsContext.h>
+#include <settings/GridSettings.h>
+#include <settings/HistogramSettings.h>
+#include <settings/MoleculeSettings.h>
+#include <settings/FitSettings.h>
+
+using namespace settings;
+
+Context::Context() {
+    axes = {settings::axes::skip, settings::axes::qmin, settings::axes::qmax, settings::axes::distance_bin_width, settings::axes::max_distance};
+    grid = {
+        settings::grid::water_scaling, settings::grid::width, settings::grid::scaling, settings::grid::rvol, settings::grid::exv_radius, settings::grid::detail::min_score,
+        settings::grid::cubic, settings::grid::save_exv,
+        settings::grid::placement_strategy,
+        settings::grid::culling_strategy
+    };
+    hist = {settings::hist::use_foxs_method, settings::hist::weighted_bins, settings::hist::histogram_manager};
+    molecule = {settings::molecule::center, settings::molecule::use_effective_charge, settings::molecule::throw_on_unknown_atom, settings::molecule::implicit_hydrogens};
+    fit = {settings::fit::verbose, settings::fit::N, settings::fit::max_iterations};
+}
+
+void Context::apply() const {
+    settings::axes::skip = axes.skip;
+    settings::axes::qmin = axes.qmin;
+    settings::axes::qmax = axes.qmax;
+    settings::axes::distance_bin_width = axes.distance_bin_width;
+    settings::axes::max_distance = axes.max_distance;
+
+    settings::grid::water_scaling = grid.water_scaling;
+    settings::grid::width = grid.width;
+    settings::grid::scaling = grid.scaling;
+    settings::grid::rvol = grid.rvol;
+    settings::grid::exv_radius = grid.exv_radius;
+    settings::grid::detail::min_score = grid.min_score;
+    settings::grid::cubic = grid.cubic;
+    settings::grid::save_exv = grid.save_exv;
+    settings::grid::placement_strategy = grid.placement_strategy;
+    settings::grid::culling_strategy = grid.culling_strategy;
+
+    settings::hist::use_foxs_method = hist.use_foxs_method;
+    settings::hist::weighted_bins = hist.weighted_bins;
+    settings::hist::histogram_manager = hist.histogram_manager;
+
+    settings::molecule::center = molecule.center;
+    settings::molecule::use_effective_charge = molecule.use_effective_charge;
+    settings::molecule::throw_on_unknown_atom = molecule.throw_on_unknown_atom;
+    settings::molecule::implicit_hydrogens = molecule.implicit_hydrogens;
+
+    settings::fit::verbose = fit.verbose;
+    settings::fit::N = fit.N;
+    settings::fit::max_iterations = fit.max_iterations;
+}
+
+ScopedContext::ScopedContext(const Context& context) {
+    context.apply();
+}
+
+ScopedContext::~ScopedContext() {
+    previous.apply();
+}
\ No newline at end of file
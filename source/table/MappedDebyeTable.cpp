@@ -0,0 +1,59 @@
+/*
+This software is distributed under the GNU General Public License v3.0. 
+For more information, please refer to the LICENSE file in the project root.
+*/
+
+#include <table/MappedDebyeTable.h>
+#include <table/VectorDebyeTable.h>
+#include <constants/Axes.h>
+
+#include <algorithm>
+#include <sstream>
+
+using namespace table;
+
+MappedDebyeTable::MappedDebyeTable(std::shared_ptr<const store::Segment> segment, std::size_t size_q, std::size_t size_d) : segment(std::move(segment)), N(size_q), M(size_d) {}
+
+MappedDebyeTable::~MappedDebyeTable() = default;
+
+double MappedDebyeTable::lookup(unsigned int q_index, unsigned int d_index) const {
+    return segment->data()[q_index*M + d_index];
+}
+
+std::size_t MappedDebyeTable::size_q() const noexcept {return N;}
+
+std::size_t MappedDebyeTable::size_d() const noexcept {return M;}
+
+const constants::axes::d_type* MappedDebyeTable::begin(unsigned int q_index) const {
+    return segment->data() + q_index*M;
+}
+
+const constants::axes::d_type* MappedDebyeTable::end(unsigned int q_index) const {
+    return segment->data() + (q_index+1)*M;
+}
+
+const MappedDebyeTable& MappedDebyeTable::get_default_table() {
+    static MappedDebyeTable default_table = [] () {
+        const auto& q = constants::axes::q_axis;
+        const auto& d = constants::axes::d_axis;
+
+        // the name identifies the axes, such that a change of the default axes results in a new table
+        std::ostringstream name;
+        name.precision(17);
+        name << "sinc_q" << q.bins << "_" << q.min << "_" << q.max << "_d" << d.bins << "_" << d.min << "_" << d.max;
+        auto segment = store::get(name.str(), q.bins*d.bins, [] (double* data) {
+            VectorDebyeTable table(constants::axes::d_vals);
+            std::copy(table.begin(0), table.end(table.size_q()-1), data);
+        });
+        return MappedDebyeTable(std::move(segment), q.bins, d.bins);
+    }();
+    return default_table;
+}
+
+void MappedDebyeTable::check_default(const std::vector<double>& q, const std::vector<constants::axes::d_type>& d) {
+    VectorDebyeTable::check_default(q, d);
+}
+
+void MappedDebyeTable::check_default(const std::vector<constants::axes::d_type>& d) {
+    VectorDebyeTable::check_default(d);
+}
\ No newline at end of file
@@ -0,0 +1,155 @@
+/*
+This software is distributed under the GNU General Public License v3.0. 
+For more information, please refer to the LICENSE file in the project root.
+*/
+
+#include <table/TableStore.h>
+#include <settings/GeneralSettings.h>
+#include <utility/Console.h>
+
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+
+#if defined(__unix__) || defined(__APPLE__)
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <fcntl.h>
+    #include <unistd.h>
+#endif
+
+using namespace table::store;
+
+namespace {
+    /**
+     * @brief The header of each stored table. The elements follow immediately after.
+     */
+    struct Header {
+        char magic[8];
+        std::uint32_t version;
+        std::uint32_t element_size;
+        std::uint64_t size;
+        std::uint64_t key;
+        std::uint8_t padding[32];
+    };
+    static_assert(sizeof(Header) == 64, "table::store::Header must be 64 bytes long");
+    constexpr char magic[8] = "AUSAXST";
+
+    // FNV-1a hash of the table name, such that a file which was renamed or overwritten by another table is not mistaken for this one
+    std::uint64_t hash(const std::string& name) {
+        std::uint64_t h = 14695981039346656037ull;
+        for (char c : name) {
+            h ^= static_cast<unsigned char>(c);
+            h *= 1099511628211ull;
+        }
+        return h;
+    }
+
+    bool is_valid(const Header& header, const std::string& name, std::size_t size) {
+        return std::memcmp(header.magic, magic, sizeof(magic)) == 0 && header.version == version && header.element_size == sizeof(double)
+            && header.size == size && header.key == hash(name);
+    }
+
+    std::shared_ptr<const Segment> calculate_private(std::size_t size, const std::function<void(double*)>& fill) {
+        std::vector<double> data(size);
+        fill(data.data());
+        return std::make_shared<Segment>(std::move(data));
+    }
+
+    #if defined(__unix__) || defined(__APPLE__)
+        /**
+         * @brief Map an existing stored table read-only. Returns nullptr if it does not exist or is invalid.
+         */
+        std::shared_ptr<const Segment> open(const std::string& path, const std::string& name, std::size_t size) {
+            int fd = ::open(path.c_str(), O_RDONLY);
+            if (fd == -1) {return nullptr;}
+
+            std::size_t bytes = sizeof(Header) + size*sizeof(double);
+            struct stat info;
+            if (::fstat(fd, &info) == -1 || static_cast<std::size_t>(info.st_size) != bytes) {
+                ::close(fd);
+                return nullptr;
+            }
+
+            void* mapping = ::mmap(nullptr, bytes, PROT_READ, MAP_SHARED, fd, 0);
+            ::close(fd);
+            if (mapping == MAP_FAILED) {return nullptr;}
+            if (!is_valid(*static_cast<const Header*>(mapping), name, size)) {
+                ::munmap(mapping, bytes);
+                return nullptr;
+            }
+            return std::make_shared<Segment>(mapping, bytes, sizeof(Header), size);
+        }
+
+        /**
+         * @brief Calculate a table directly into a new file of the store.
+         *        The table is written to a temporary file which is then renamed, such that other processes never see a partially written table.
+         */
+        std::shared_ptr<const Segment> create(const std::string& path, const std::string& name, std::size_t size, const std::function<void(double*)>& fill) {
+            std::string tmp = path + ".tmp" + std::to_string(::getpid());
+            int fd = ::open(tmp.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+            if (fd == -1) {return nullptr;}
+
+            std::size_t bytes = sizeof(Header) + size*sizeof(double);
+            void* mapping = ::ftruncate(fd, bytes) == -1 ? MAP_FAILED : ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+            ::close(fd);
+            if (mapping == MAP_FAILED) {
+                ::unlink(tmp.c_str());
+                return nullptr;
+            }
+
+            Header header{};
+            std::memcpy(header.magic, magic, sizeof(magic));
+            header.version = version;
+            header.element_size = sizeof(double);
+            header.size = size;
+            header.key = hash(name);
+            fill(reinterpret_cast<double*>(static_cast<char*>(mapping) + sizeof(Header)));
+            std::memcpy(mapping, &header, sizeof(Header));
+
+            // our own mapping is kept, since it refers to the same pages as the mappings of the other processes
+            if (::mprotect(mapping, bytes, PROT_READ) == -1 || ::rename(tmp.c_str(), path.c_str()) == -1) {
+                ::munmap(mapping, bytes);
+                ::unlink(tmp.c_str());
+                return nullptr;
+            }
+            return std::make_shared<Segment>(mapping, bytes, sizeof(Header), size);
+        }
+    #endif
+}
+
+Segment::Segment(std::vector<double>&& data) : owned(std::move(data)), begin(owned.data()), count(owned.size()) {
+    account.set(count*sizeof(double));
+}
+
+Segment::Segment(void* mapping, std::size_t bytes, std::size_t offset, std::size_t size)
+    : mapping(mapping), bytes(bytes), begin(reinterpret_cast<const double*>(static_cast<const char*>(mapping) + offset)), count(size)
+{
+    account.set(bytes);
+}
+
+Segment::~Segment() {
+    #if defined(__unix__) || defined(__APPLE__)
+        if (mapping) {::munmap(mapping, bytes);}
+    #endif
+}
+
+const double* Segment::data() const noexcept {return begin;}
+
+std::size_t Segment::size() const noexcept {return count;}
+
+bool Segment::is_shared() const noexcept {return mapping != nullptr;}
+
+std::shared_ptr<const Segment> table::store::get(const std::string& name, std::size_t size, const std::function<void(double*)>& fill) {
+    if (settings::general::table_store.empty()) {return calculate_private(size, fill);}
+
+    #if defined(__unix__) || defined(__APPLE__)
+        std::error_code ec;
+        std::filesystem::create_directories(settings::general::table_store, ec);
+        std::string path = (std::filesystem::path(settings::general::table_store) / (name + ".v" + std::to_string(version) + ".table")).string();
+        if (auto segment = open(path, name, size)) {return segment;}
+        if (auto segment = create(path, name, size, fill)) {return segment;}
+        console::print_warning("Warning in table::store::get: Could not use the table store at \"" + path + "\". The table will be calculated privately.");
+    #endif
+    return calculate_private(size, fill);
+}
\ No newline at end of file
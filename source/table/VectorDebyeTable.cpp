@@ -35,6 +35,7 @@ void VectorDebyeTable::initialize(const T1& q, const T2& d) {
     constexpr double tolerance = 1e-3;  // The minimum x-value where sin(x)/x is replaced by its Taylor-series.
     constexpr double inv_6 = 1./6;      // 1/6
     constexpr double inv_120 = 1./120;  // 1/120
+    account.set(utility::memory::size_of(data));
 
     for (unsigned int i = 0; i < N; ++i) {
         for (unsigned int j = 0; j < M; ++j) {
@@ -0,0 +1,44 @@
+/*
+This software is distributed under the GNU General Public License v3.0. 
+For more information, please refer to the LICENSE file in the project root.
+*/
+
+#include <utility/Job.h>
+#include <utility/Exceptions.h>
+
+using namespace utility::job;
+
+namespace {
+    // the token of the job running on the current thread
+    thread_local std::shared_ptr<Token> current_token = nullptr;
+}
+
+Token::Token(std::function<void(const Progress&)> on_progress) : on_progress(std::move(on_progress)) {}
+
+void Token::cancel() noexcept {cancelled.store(true, std::memory_order_relaxed);}
+
+bool Token::is_cancelled() const noexcept {return cancelled.load(std::memory_order_relaxed);}
+
+void Token::report(const Progress& progress) const {
+    if (on_progress) {on_progress(progress);}
+}
+
+std::shared_ptr<Token> utility::job::get_token() noexcept {return current_token;}
+
+ScopedToken::ScopedToken(std::shared_ptr<Token> token) noexcept : previous(std::move(current_token)) {
+    current_token = std::move(token);
+}
+
+ScopedToken::~ScopedToken() {current_token = std::move(previous);}
+
+bool utility::job::is_cancelled() noexcept {
+    return current_token && current_token->is_cancelled();
+}
+
+void utility::job::check_cancelled() {
+    if (is_cancelled()) {throw except::cancelled("utility::job::check_cancelled: The job was cancelled.");}
+}
+
+void utility::job::report_progress(const std::string& stage, unsigned int step, unsigned int total) {
+    if (current_token) {current_token->report({stage, step, total});}
+}
\ No newline at end of file
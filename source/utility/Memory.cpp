@@ -0,0 +1,166 @@
+/*
+This software is distributed under the GNU General Public License v3.0. 
+For more information, please refer to the LICENSE file in the project root.
+*/
+
+#include <utility/Memory.h>
+#include <utility/Console.h>
+#include <settings/GeneralSettings.h>
+
+#include <array>
+#include <atomic>
+#include <limits>
+#include <sstream>
+#include <iomanip>
+#include <iostream>
+#include <algorithm>
+
+using namespace utility::memory;
+
+namespace {
+    struct Counter {
+        std::atomic<std::size_t> current = 0;
+        std::atomic<std::size_t> peak = 0;
+
+        void add(std::size_t bytes) noexcept {
+            std::size_t now = current.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+            std::size_t prev = peak.load(std::memory_order_relaxed);
+            while (prev < now && !peak.compare_exchange_weak(prev, now, std::memory_order_relaxed)) {}
+        }
+
+        void remove(std::size_t bytes) noexcept {
+            current.fetch_sub(bytes, std::memory_order_relaxed);
+        }
+    };
+
+    // one counter per subsystem, and one for the total
+    std::array<Counter, static_cast<int>(Subsystem::count)+1>& counters() {
+        static std::array<Counter, static_cast<int>(Subsystem::count)+1> counters;
+        return counters;
+    }
+
+    void add(Subsystem subsystem, std::size_t bytes) noexcept {
+        if (bytes == 0) {return;}
+        counters()[static_cast<int>(subsystem)].add(bytes);
+        counters().back().add(bytes);
+    }
+
+    void remove(Subsystem subsystem, std::size_t bytes) noexcept {
+        if (bytes == 0) {return;}
+        counters()[static_cast<int>(subsystem)].remove(bytes);
+        counters().back().remove(bytes);
+    }
+
+    std::string format(std::size_t bytes) {
+        std::ostringstream ss;
+        ss << std::fixed << std::setprecision(1) << bytes/(1024.*1024) << " MB";
+        return ss.str();
+    }
+}
+
+Account::Account(Subsystem subsystem, std::size_t bytes) noexcept : subsystem(subsystem), bytes(bytes) {add(subsystem, bytes);}
+
+Account::Account(const Account& other) noexcept : subsystem(other.subsystem), bytes(other.bytes) {add(subsystem, bytes);}
+
+Account::Account(Account&& other) noexcept : subsystem(other.subsystem), bytes(other.bytes) {other.bytes = 0;}
+
+Account& Account::operator=(const Account& other) noexcept {
+    if (this == &other) {return *this;}
+    remove(subsystem, bytes);
+    subsystem = other.subsystem;
+    bytes = other.bytes;
+    add(subsystem, bytes);
+    return *this;
+}
+
+Account& Account::operator=(Account&& other) noexcept {
+    if (this == &other) {return *this;}
+    remove(subsystem, bytes);
+    subsystem = other.subsystem;
+    bytes = other.bytes;
+    other.bytes = 0;
+    return *this;
+}
+
+Account::~Account() {remove(subsystem, bytes);}
+
+void Account::set(std::size_t bytes) noexcept {
+    if (bytes == this->bytes) {return;}
+    add(subsystem, bytes);
+    remove(subsystem, this->bytes);
+    this->bytes = bytes;
+}
+
+std::size_t Account::get() const noexcept {return bytes;}
+
+Usage utility::memory::get_usage(Subsystem subsystem) noexcept {
+    const auto& counter = counters()[static_cast<int>(subsystem)];
+    return {counter.current.load(std::memory_order_relaxed), counter.peak.load(std::memory_order_relaxed)};
+}
+
+Usage utility::memory::get_total_usage() noexcept {
+    const auto& counter = counters().back();
+    return {counter.current.load(std::memory_order_relaxed), counter.peak.load(std::memory_order_relaxed)};
+}
+
+void utility::memory::reset_peak() noexcept {
+    for (auto& counter : counters()) {
+        counter.peak.store(counter.current.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+}
+
+std::string utility::memory::summary() {
+    static constexpr std::array<const char*, static_cast<int>(Subsystem::count)> names = {"histogram", "grid", "molecule", "em", "table"};
+    std::ostringstream ss;
+    ss << std::left << std::setw(12) << "subsystem" << std::right << std::setw(12) << "current" << std::setw(12) << "peak" << "\n";
+    for (unsigned int i = 0; i < names.size(); ++i) {
+        auto usage = get_usage(static_cast<Subsystem>(i));
+        ss << std::left << std::setw(12) << names[i] << std::right << std::setw(12) << format(usage.current) << std::setw(12) << format(usage.peak) << "\n";
+    }
+    auto total = get_total_usage();
+    ss << std::left << std::setw(12) << "total" << std::right << std::setw(12) << format(total.current) << std::setw(12) << format(total.peak);
+    return ss.str();
+}
+
+void utility::memory::print_summary() {
+    if (!settings::general::verbose) {return;}
+    console::print_info("\nMemory usage:");
+    std::cout << summary() << std::endl;
+}
+
+std::size_t utility::memory::get_remaining_budget() noexcept {
+    if (settings::general::memory_budget == 0) {return std::numeric_limits<std::size_t>::max();}
+    std::size_t budget = static_cast<std::size_t>(settings::general::memory_budget)*1024*1024;
+    std::size_t current = get_total_usage().current;
+    return current < budget ? budget - current : 0;
+}
+
+std::vector<int> utility::memory::job_sizes(std::initializer_list<Loop> loops) {
+    int job_size = settings::general::detail::job_size;
+    std::vector<int> sizes(loops.size(), job_size);
+    std::size_t remaining = get_remaining_budget();
+    if (remaining == std::numeric_limits<std::size_t>::max()) {return sizes;}
+
+    // each job may be run by a different thread, and thus create its own copy
+    // the loops run at the same time, so the copies of all loops must fit in the budget together
+    auto jobs = [job_size] (const Loop& loop) {return (std::size_t(std::max(loop.n, 0)) + job_size - 1)/job_size;};
+    std::size_t required = 0, round = 0;
+    for (const auto& loop : loops) {
+        required += jobs(loop)*loop.bytes_per_copy;
+        round += loop.bytes_per_copy;
+    }
+    if (required <= remaining) {return sizes;}
+
+    // every loop is limited to the same number of copies
+    std::size_t copies = std::max<std::size_t>(1, remaining/round);
+    unsigned int i = 0;
+    for (const auto& loop : loops) {
+        if (copies < jobs(loop)) {sizes[i] = static_cast<int>((loop.n + copies - 1)/copies);}
+        ++i;
+    }
+    return sizes;
+}
+
+int utility::memory::job_size(int n, std::size_t bytes_per_copy) {
+    return job_sizes({{n, bytes_per_copy}})[0];
+}
\ No newline at end of file
@@ -6,8 +6,10 @@ For more information, please refer to the LICENSE file in the project root.
 #include <utility/MultiThreading.h>
 #include <settings/GeneralSettings.h>
 
-observer_ptr<BS::thread_pool> utility::multi_threading::get_global_pool() {
+#include <memory>
+
+observer_ptr<utility::multi_threading::TaskScheduler> utility::multi_threading::get_global_scheduler() {
     // statics in functions are initialized on first call, so ok to use settings::general::threads here
-    static std::unique_ptr<BS::thread_pool> pool = std::make_unique<BS::thread_pool>(settings::general::threads);
-    return pool.get();
+    static std::unique_ptr<TaskScheduler> scheduler = std::make_unique<TaskScheduler>(settings::general::threads, settings::general::pin_threads);
+    return scheduler.get();
 }
\ No newline at end of file
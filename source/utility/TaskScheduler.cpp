@@ -0,0 +1,277 @@
+/*
+This software is distributed under the GNU General Public License v3.0. 
+For more information, please refer to the LICENSE file in the project root.
+*/
+
+#include <utility/TaskScheduler.h>
+#include <utility/MultiThreading.h>
+
+#include <algorithm>
+#include <numeric>
+#include <filesystem>
+#include <cctype>
+#include <fstream>
+#include <string>
+
+#if defined(__linux__)
+    #include <pthread.h>
+    #include <sched.h>
+#endif
+
+using namespace utility::multi_threading;
+
+namespace {
+    // the worker index of the current thread, and the scheduler it belongs to
+    thread_local const TaskScheduler* current_scheduler = nullptr;
+    thread_local unsigned int current_index = 0;
+
+    /**
+     * @brief Get the NUMA node of each logical core.
+     *        On systems without NUMA information, all cores are placed on node 0.
+     */
+    std::vector<unsigned int> core_nodes() {
+        std::vector<unsigned int> nodes(std::max(1u, std::thread::hardware_concurrency()), 0);
+        #if defined(__linux__)
+            std::error_code ec;
+            for (const auto& entry : std::filesystem::directory_iterator("/sys/devices/system/node", ec)) {
+                std::string name = entry.path().filename().string();
+                if (name.rfind("node", 0) != 0 || name.size() == 4 || !std::isdigit(name[4])) {continue;}
+                unsigned int node = std::stoi(name.substr(4));
+
+                // the cpulist is a comma-separated list of ranges, e.g. "0-7,16-23"
+                std::ifstream in(entry.path() / "cpulist");
+                std::string range;
+                while (std::getline(in, range, ',')) {
+                    if (range.empty() || !std::isdigit(range[0])) {continue;}
+                    auto dash = range.find('-');
+                    unsigned int first = std::stoi(range.substr(0, dash));
+                    unsigned int last = dash == std::string::npos ? first : std::stoi(range.substr(dash+1));
+                    for (unsigned int core = first; core <= last && core < nodes.size(); ++core) {nodes[core] = node;}
+                }
+            }
+        #endif
+        return nodes;
+    }
+}
+
+TaskScheduler::TaskScheduler(unsigned int threads, bool pin) {
+    if (threads == 0) {threads = std::max(1u, std::thread::hardware_concurrency());}
+
+    // assign the workers to cores node by node, so that neighbouring workers share a node
+    auto nodes = core_nodes();
+    std::vector<unsigned int> cores(nodes.size());
+    std::iota(cores.begin(), cores.end(), 0);
+    std::stable_sort(cores.begin(), cores.end(), [&nodes] (unsigned int a, unsigned int b) {return nodes[a] < nodes[b];});
+
+    // steal from the workers on the same node first, closest first
+    workers.resize(threads);
+    for (unsigned int i = 0; i < threads; ++i) {
+        workers[i] = std::make_unique<Worker>();
+        for (unsigned int d = 1; d < threads; ++d) {workers[i]->victims.push_back((i + d) % threads);}
+        auto node = [&] (unsigned int w) {return nodes[cores[w % cores.size()]];};
+        std::stable_partition(workers[i]->victims.begin(), workers[i]->victims.end(), [&] (unsigned int w) {return node(w) == node(i);});
+    }
+
+    for (unsigned int i = 0; i < threads; ++i) {
+        workers[i]->thread = std::thread([this, i] () {run(i);});
+        #if defined(__linux__)
+            if (pin) {
+                cpu_set_t set;
+                CPU_ZERO(&set);
+                CPU_SET(cores[i % cores.size()], &set);
+                pthread_setaffinity_np(workers[i]->thread.native_handle(), sizeof(set), &set);
+            }
+        #else
+            (void) pin;
+        #endif
+    }
+}
+
+TaskScheduler::~TaskScheduler() {
+    {
+        std::lock_guard lock(sleep_mutex);
+        stop = true;
+    }
+    sleep_cv.notify_all();
+    for (auto& worker : workers) {worker->thread.join();}
+}
+
+TaskScheduler::Group::Group() = default;
+TaskScheduler::Group::~Group() = default;
+
+void TaskScheduler::submit(Task&& task, Group* group) {
+    // counted before it is queued, since a waiting worker may take it from its group right away
+    queued.fetch_add(1);
+
+    Entry entry;
+    if (group) {
+        entry.slot = std::make_shared<Slot>();
+        entry.slot->task = std::move(task);
+        std::lock_guard lock(group->mutex);
+
+        // drop the tasks which were already taken from the deques, such that the list does not grow when nobody helps with this group
+        while (!group->tasks.empty() && group->tasks.front()->taken.load(std::memory_order_relaxed)) {group->tasks.pop_front();}
+        group->tasks.push_back(entry.slot);
+    } else {
+        entry.task = std::move(task);
+    }
+
+    unsigned int index = is_worker() ? current_index : next.fetch_add(1, std::memory_order_relaxed) % workers.size();
+    {
+        std::lock_guard lock(workers[index]->mutex);
+        workers[index]->tasks.push_back(std::move(entry));
+    }
+
+    // only take the lock if a worker may be sleeping
+    if (sleeping.load() != 0) {
+        std::lock_guard lock(sleep_mutex);
+        sleep_cv.notify_one();
+    }
+}
+
+bool TaskScheduler::claim(Entry& entry, Task& task) {
+    if (!entry.slot) {
+        task = std::move(entry.task);
+        return true;
+    }
+
+    // a grouped task may already have been taken from its group
+    if (entry.slot->taken.exchange(true)) {return false;}
+    task = std::move(entry.slot->task);
+    return true;
+}
+
+bool TaskScheduler::pop(unsigned int index, Task& task) {
+    auto& own = *workers[index];
+    {
+        std::lock_guard lock(own.mutex);
+        while (!own.tasks.empty()) {
+            Entry entry = std::move(own.tasks.back());
+            own.tasks.pop_back();
+            if (claim(entry, task)) {
+                queued.fetch_sub(1);
+                return true;
+            }
+        }
+    }
+
+    for (unsigned int victim : own.victims) {
+        auto& other = *workers[victim];
+        std::lock_guard lock(other.mutex);
+        while (!other.tasks.empty()) {
+            Entry entry = std::move(other.tasks.front());
+            other.tasks.pop_front();
+            if (claim(entry, task)) {
+                queued.fetch_sub(1);
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+bool TaskScheduler::pop(Task& task, Group& group) {
+    // the most recent task is taken first, like from the worker's own deque
+    std::lock_guard lock(group.mutex);
+    while (!group.tasks.empty()) {
+        auto slot = std::move(group.tasks.back());
+        group.tasks.pop_back();
+        if (!slot->taken.exchange(true)) {
+            task = std::move(slot->task);
+            queued.fetch_sub(1);
+            return true;
+        }
+    }
+    return false;
+}
+
+void TaskScheduler::run(unsigned int index) {
+    current_scheduler = this;
+    current_index = index;
+    Task task;
+    while (true) {
+        if (pop(index, task)) {
+            task();
+            task = nullptr;
+            continue;
+        }
+
+        std::unique_lock lock(sleep_mutex);
+        sleeping.fetch_add(1);
+        sleep_cv.wait(lock, [this] () {return stop || queued.load() != 0;});
+        sleeping.fetch_sub(1);
+        if (stop && queued.load() == 0) {return;}
+    }
+}
+
+bool TaskScheduler::try_run_task() {
+    if (!is_worker()) {return false;}
+    Task task;
+    if (!pop(current_index, task)) {return false;}
+    task();
+    return true;
+}
+
+bool TaskScheduler::try_run_task(Group& group) {
+    if (!is_worker()) {return false;}
+    Task task;
+    if (!pop(task, group)) {return false;}
+    task();
+    return true;
+}
+
+bool TaskScheduler::is_worker() const noexcept {
+    return current_scheduler == this;
+}
+
+unsigned int TaskScheduler::get_thread_count() const noexcept {
+    return workers.size();
+}
+
+std::vector<std::thread::id> TaskScheduler::get_thread_ids() const {
+    std::vector<std::thread::id> ids;
+    for (const auto& worker : workers) {ids.push_back(worker->thread.get_id());}
+    return ids;
+}
+
+TaskGroup::TaskGroup() : TaskGroup(get_global_scheduler()) {}
+
+TaskGroup::TaskGroup(observer_ptr<TaskScheduler> scheduler) : scheduler(scheduler) {}
+
+TaskGroup::~TaskGroup() {
+    try {
+        wait();
+    } catch (...) {}
+}
+
+void TaskGroup::finish() {
+    // the counter is decremented under the lock, so the group cannot be destroyed before the last task is done with it
+    std::lock_guard lock(mutex);
+    if (pending.fetch_sub(1) == 1) {cv.notify_all();}
+}
+
+void TaskGroup::wait() {
+    // workers help with the queued tasks of this group instead of blocking, since they may be queued behind the current task
+    // when none are queued, the remaining tasks are running on other threads, so the worker sleeps until they finish or new ones are queued
+    bool worker = scheduler->is_worker();
+    std::unique_lock lock(mutex);
+    if (worker) {waiting.fetch_add(1);}
+    while (true) {
+        cv.wait(lock, [this, worker] () {return pending.load() == 0 || (worker && queued.load() != 0);});
+        if (pending.load() == 0) {break;}
+        lock.unlock();
+        while (scheduler->try_run_task(group)) {}
+        lock.lock();
+    }
+    if (worker) {waiting.fetch_sub(1);}
+
+    if (error) {
+        auto e = error;
+        error = nullptr;
+        std::rethrow_exception(e);
+    }
+}
+
+observer_ptr<TaskScheduler> TaskGroup::get_scheduler() const noexcept {
+    return scheduler;
+}
\ No newline at end of file
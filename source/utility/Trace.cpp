@@ -0,0 +1,164 @@
+/*
+This software is distributed under the GNU General Public License v3.0. 
+For more information, please refer to the LICENSE file in the project root.
+*/
+
+#include <utility/Trace.h>
+#include <utility/Exceptions.h>
+#include <utility/Console.h>
+#include <io/File.h>
+
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <atomic>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <algorithm>
+#include <cstdlib>
+#include <chrono>
+#include <thread>
+
+using namespace utility::trace;
+
+namespace {
+    struct Event {
+        const char* name;
+        std::int64_t begin, end;
+    };
+
+    /**
+     * @brief The ring buffer of a single thread. Only the owning thread writes to it.
+     */
+    struct Buffer {
+        static constexpr unsigned int capacity = buffer_capacity;
+        Buffer(unsigned int tid) : tid(tid), events(capacity) {}
+        unsigned int tid;
+        std::vector<Event> events;
+        std::atomic<std::uint64_t> head = 0;  // The total number of recorded events.
+        std::atomic<unsigned int> depth = 0;  // The number of zones currently open on the owning thread.
+    };
+
+    /**
+     * @brief All thread buffers. The buffers are shared with the threads, such that they outlive the threads which recorded them.
+     */
+    struct Registry {
+        std::mutex mutex;
+        std::vector<std::shared_ptr<Buffer>> buffers;
+        std::atomic<bool> enabled = false;
+        std::string path;
+    };
+
+    Registry& registry() {
+        static Registry registry;
+        return registry;
+    }
+
+    Buffer& local_buffer() {
+        thread_local std::shared_ptr<Buffer> buffer = [] () {
+            auto& reg = registry();
+            std::lock_guard lock(reg.mutex);
+            reg.buffers.push_back(std::make_shared<Buffer>(reg.buffers.size()));
+            return reg.buffers.back();
+        }();
+        return *buffer;
+    }
+}
+
+bool Zone::enter() noexcept {
+    auto& reg = registry();
+    if (!reg.enabled.load(std::memory_order_relaxed)) {return false;}
+
+    // the zone is announced before checking again, so save() either waits for it to close, or it is never opened
+    auto& buffer = local_buffer();
+    buffer.depth.fetch_add(1);
+    if (!reg.enabled.load()) {
+        buffer.depth.fetch_sub(1);
+        return false;
+    }
+    return true;
+}
+
+void Zone::record(const char* name, std::int64_t begin, std::int64_t end) noexcept {
+    auto& buffer = local_buffer();
+    auto head = buffer.head.load(std::memory_order_relaxed);
+    buffer.events[head % Buffer::capacity] = {name, begin, end};
+    buffer.head.store(head+1, std::memory_order_release);
+    buffer.depth.fetch_sub(1);
+}
+
+bool utility::trace::is_enabled() noexcept {
+    return registry().enabled.load(std::memory_order_relaxed);
+}
+
+void utility::trace::start(const std::string& path) {
+    #if !defined(TRACE_ENABLED)
+        console::print_warning("Warning in utility::trace::start: Tracing was disabled at compile time. Build with the TRACE option to record trace zones.");
+    #endif
+    auto& reg = registry();
+    reg.path = path;
+    reg.enabled = true;
+
+    // the registry is constructed before the exit handler is registered, so it is still alive when the handler runs
+    static bool registered = false;
+    if (!registered) {
+        std::atexit([] () {
+            try {
+                save(registry().path);
+            } catch (const std::exception& e) {
+                console::print_warning(e.what());
+            }
+        });
+        registered = true;
+    }
+}
+
+void utility::trace::save(const std::string& path) {
+    auto& reg = registry();
+    reg.enabled = false;
+
+    ::io::File(path).create();
+    std::ofstream out(path);
+    if (!out.is_open()) {throw except::io_error("utility::trace::save: Could not open file \"" + path + "\".");}
+
+    // a thread inside a zone writes to its buffer when the zone closes, so a buffer can only be read once its thread has left all zones
+    // since no new zones are opened, each buffer stays unchanged from then on
+    std::lock_guard lock(reg.mutex);
+    std::vector<const Buffer*> buffers;
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(500);
+    for (const auto& buffer : reg.buffers) {
+        while (buffer->depth.load() != 0 && std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        if (buffer->depth.load() == 0) {buffers.push_back(buffer.get());}
+        else {console::print_warning("Warning in utility::trace::save: Thread " + std::to_string(buffer->tid) + " is still recording, and is left out of the trace.");}
+    }
+
+    // the timestamps are made relative to the first event, and written in microseconds
+    auto events = [] (const Buffer& buffer) {
+        std::uint64_t head = buffer.head.load(std::memory_order_acquire);
+        std::uint64_t first = head < Buffer::capacity ? 0 : head - Buffer::capacity;
+        return std::pair{first, head};
+    };
+    std::int64_t origin = std::numeric_limits<std::int64_t>::max();
+    for (const auto& buffer : buffers) {
+        auto [first, head] = events(*buffer);
+        for (auto i = first; i < head; ++i) {origin = std::min(origin, buffer->events[i % Buffer::capacity].begin);}
+    }
+
+    out << std::fixed << std::setprecision(3) << "{\"traceEvents\":[";
+    bool first_event = true;
+    for (const auto& buffer : buffers) {
+        auto [first, head] = events(*buffer);
+        for (auto i = first; i < head; ++i) {
+            const auto& e = buffer->events[i % Buffer::capacity];
+            out << (first_event ? "\n" : ",\n")
+                << "{\"name\":\"" << e.name << "\",\"ph\":\"X\",\"pid\":0,\"tid\":" << buffer->tid
+                << ",\"ts\":" << (e.begin - origin)/1e3 << ",\"dur\":" << (e.end - e.begin)/1e3 << "}"
+            ;
+            first_event = false;
+        }
+    }
+    out << "\n],\"displayTimeUnit\":\"ms\"}" << std::endl;
+}
\ No newline at end of file
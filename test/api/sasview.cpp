@@ -0,0 +1,111 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <api/sasview.h>
+#include <data/Molecule.h>
+#include <data/record/Atom.h>
+#include <dataset/SimpleDataset.h>
+#include <hist/intensity_calculator/ICompositeDistanceHistogram.h>
+#include <settings/All.h>
+
+#include <vector>
+#include <cmath>
+
+TEST_CASE("sasview_model") {
+    std::vector<double> x = {-1, -1, -1, -1, 1, 1, 1, 1};
+    std::vector<double> y = {-1, -1, 1, 1, -1, -1, 1, 1};
+    std::vector<double> z = {-1, 1, -1, 1, -1, 1, -1, 1};
+    std::vector<double> w = {1, 1, 1, 1, 1, 1, 1, 1};
+    std::vector<double> q = {0.01, 0.1, 0.5, 1, 2};
+    int status;
+
+    // the reference is the histogram approach of the molecule itself, without the form factor of the Debye transform
+    std::vector<double> Iq_ref(q.size());
+    {
+        settings::ScopedContext restore{settings::Context()};
+        settings::hist::histogram_manager = settings::hist::HistogramManagerChoice::HistogramManagerMT;
+        settings::molecule::use_effective_charge = false;
+        settings::molecule::implicit_hydrogens = false;
+        settings::hist::weighted_bins = true;
+        settings::axes::qmax = 1;
+
+        std::vector<data::record::Atom> atoms(x.size());
+        for (unsigned int i = 0; i < x.size(); ++i) {
+            atoms[i] = data::record::Atom({x[i], y[i], z[i]}, w[i], constants::atom_t::dummy, "", i);
+        }
+        auto Iq = data::Molecule(atoms).get_histogram()->debye_transform(q);
+        for (unsigned int i = 0; i < q.size(); ++i) {
+            Iq_ref[i] = Iq.y(i)/std::exp(-std::pow(q[i], 2));
+        }
+    }
+
+    auto model = create_sans_model(x.data(), y.data(), z.data(), w.data(), x.size(), &status);
+    REQUIRE(status == 0);
+    REQUIRE(model != nullptr);
+
+    SECTION("evaluate") {
+        std::vector<double> Iq(q.size());
+        for (int repeat = 0; repeat < 2; ++repeat) {
+            evaluate_sans_model(model, q.data(), q.size(), Iq.data(), &status);
+            REQUIRE(status == 0);
+            for (unsigned int i = 0; i < q.size(); ++i) {
+                REQUIRE_THAT(Iq[i], Catch::Matchers::WithinRel(Iq_ref[i], 1e-9));
+            }
+        }
+
+        // the Debye transform of eight unit scatterers at q -> 0 is just the number of pairs
+        REQUIRE_THAT(Iq[0], Catch::Matchers::WithinRel(64, 1e-2));
+    }
+
+    SECTION("update") {
+        std::vector<double> Iq(q.size());
+        evaluate_sans_model(model, q.data(), q.size(), Iq.data(), &status);
+
+        // translating all scatterers does not change the intensity
+        std::vector<double> x2 = x;
+        for (auto& v : x2) {v += 5;}
+        std::vector<double> Iq_translated(q.size());
+        update_sans_model(model, x2.data(), y.data(), z.data(), nullptr, &status);
+        REQUIRE(status == 0);
+        evaluate_sans_model(model, q.data(), q.size(), Iq_translated.data(), &status);
+        for (unsigned int i = 0; i < q.size(); ++i) {
+            REQUIRE_THAT(Iq_translated[i], Catch::Matchers::WithinRel(Iq[i], 1e-6));
+        }
+
+        // doubling all weights quadruples the intensity
+        std::vector<double> w2(w.size(), 2);
+        std::vector<double> Iq_scaled(q.size());
+        update_sans_model(model, nullptr, nullptr, nullptr, w2.data(), &status);
+        REQUIRE(status == 0);
+        evaluate_sans_model(model, q.data(), q.size(), Iq_scaled.data(), &status);
+        for (unsigned int i = 0; i < q.size(); ++i) {
+            REQUIRE_THAT(Iq_scaled[i], Catch::Matchers::WithinRel(4*Iq[i], 1e-6));
+        }
+    }
+
+    SECTION("leaves the settings of the caller untouched") {
+        auto choice = settings::hist::histogram_manager;
+        std::vector<double> Iq(q.size());
+        evaluate_sans_model(model, q.data(), q.size(), Iq.data(), &status);
+        CHECK(settings::hist::histogram_manager == choice);
+    }
+
+    SECTION("evaluate_sans_debye") {
+        std::vector<double> Iq(q.size());
+        evaluate_sans_debye(q.data(), x.data(), y.data(), z.data(), w.data(), q.size(), x.size(), &status, Iq.data());
+        REQUIRE(status == 0);
+        for (unsigned int i = 0; i < q.size(); ++i) {
+            REQUIRE_THAT(Iq[i], Catch::Matchers::WithinRel(Iq_ref[i], 1e-9));
+        }
+    }
+
+    SECTION("invalid handle") {
+        std::vector<double> Iq(q.size());
+        evaluate_sans_model(nullptr, q.data(), q.size(), Iq.data(), &status);
+        CHECK(status != 0);
+        update_sans_model(nullptr, x.data(), y.data(), z.data(), w.data(), &status);
+        CHECK(status != 0);
+    }
+
+    destroy_sans_model(model);
+}
\ No newline at end of file
@@ -35,12 +35,12 @@ TEST_CASE("ThreadLocalWrapper::ThreadLocalWrapper") {
 }
 
 TEST_CASE("ThreadLocalWrapper::ops") {
-    const auto& pool = utility::multi_threading::get_global_pool();
+    utility::multi_threading::TaskGroup tasks;
     ThreadLocalWrapper<int> wrapper(0);
     for (unsigned int i = 0; i < 100; ++i) {
-        pool->detach_task([&wrapper](){wrapper.get() += 1;});
+        tasks.run([&wrapper](){wrapper.get() += 1;});
     }
-    pool->wait();
+    tasks.wait();
     auto merged = wrapper.merge();
     CHECK(merged == 100);
 }
\ No newline at end of file
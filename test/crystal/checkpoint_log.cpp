@@ -0,0 +1,72 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <crystal/CheckpointLog.h>
+#include <crystal/Fval.h>
+#include <crystal/miller/Miller.h>
+
+#include <filesystem>
+#include <vector>
+#include <complex>
+
+using namespace crystal;
+
+TEST_CASE("CheckpointLog") {
+    std::string file = "temp/test/crystal/checkpoint.log";
+    std::filesystem::remove(file);
+
+    std::vector<Miller> millers;
+    for (int i = 0; i < 25; ++i) {millers.emplace_back(i, -i, 2*i);}
+    std::vector<Fval> fvals(millers.size());
+    for (unsigned int i = 0; i < millers.size(); ++i) {
+        fvals[i] = Fval(millers[i].h, millers[i].k, millers[i].l, std::complex<double>(i, -1.0*i));
+    }
+
+    // write blocks 0, 3 and 1 out of order
+    {
+        CheckpointLog log(file, millers, fvals, 7);
+        REQUIRE(log.remaining_blocks() == std::vector<unsigned int>{0, 1, 2, 3});
+        CHECK(log.block_range(3) == std::make_pair(21u, 25u));
+        log.commit(0);
+        log.commit(3);
+        log.commit(1);
+    }
+
+    SECTION("replay") {
+        std::vector<Fval> loaded(millers.size());
+        CheckpointLog log(file, millers, loaded, 7);
+        CHECK(log.remaining_blocks() == std::vector<unsigned int>{2});
+        for (unsigned int i : {0u, 6u, 7u, 13u, 21u, 24u}) {
+            CHECK(loaded[i].hkl == millers[i]);
+            CHECK(loaded[i].fval == fvals[i].fval);
+
+            // only the index and value are stored, so the q vector is recalculated
+            CHECK(loaded[i].qlength == fvals[i].qlength);
+        }
+    }
+
+    SECTION("partial record") {
+        // a record cut short by a crash is discarded, and new records are appended after the last complete record
+        std::filesystem::resize_file(file, std::filesystem::file_size(file) - 1);
+        {
+            std::vector<Fval> loaded(millers.size());
+            CheckpointLog log(file, millers, loaded, 7);
+            CHECK(log.remaining_blocks() == std::vector<unsigned int>{1, 2});
+            for (unsigned int i = 14; i < 21; ++i) {loaded[i] = fvals[i];}
+            log.commit(2);
+        }
+        std::vector<Fval> loaded(millers.size());
+        CheckpointLog log(file, millers, loaded, 7);
+        CHECK(log.remaining_blocks() == std::vector<unsigned int>{1});
+        CHECK(loaded[14].fval == fvals[14].fval);
+    }
+
+    SECTION("incompatible") {
+        std::vector<Fval> loaded(millers.size());
+        CHECK_THROWS(CheckpointLog(file, millers, loaded, 5));
+
+        auto other = millers;
+        other[3] = Miller(1, 1, 1);
+        CHECK_THROWS(CheckpointLog(file, other, loaded, 7));
+    }
+    std::filesystem::remove(file);
+}
\ No newline at end of file
@@ -0,0 +1,119 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <crystal/miller/MillerSymmetry.h>
+#include <crystal/miller/Miller.h>
+#include <crystal/miller/MillerGenerationFactory.h>
+#include <crystal/miller/SymmetryReducedMillers.h>
+#include <settings/CrystalSettings.h>
+#include <math/Vector3.h>
+
+#include <vector>
+#include <complex>
+#include <random>
+#include <numeric>
+#include <numbers>
+
+using namespace crystal;
+
+static std::vector<Miller> box(int n) {
+    std::vector<Miller> millers;
+    for (int h = -n; h <= n; ++h) {
+        for (int k = -n; k <= n; ++k) {
+            for (int l = -n; l <= n; ++l) {
+                millers.emplace_back(h, k, l);
+            }
+        }
+    }
+    return millers;
+}
+
+static double intensity(const std::vector<Vector3<double>>& points, const Vector3<double>& cell, const Miller& m) {
+    std::complex<double> F = 0;
+    for (const auto& p : points) {
+        F += std::polar(1.0, -2*std::numbers::pi*(m.h*p.x()/cell.x() + m.k*p.y()/cell.y() + m.l*p.z()/cell.z()));
+    }
+    return std::norm(F);
+}
+
+TEST_CASE("MillerSymmetry::detect") {
+    SECTION("cubic grid") {
+        // a simple cubic grid filling the cell has the full m-3m symmetry
+        std::vector<Vector3<double>> points;
+        for (int i = 0; i < 4; ++i) {
+            for (int j = 0; j < 4; ++j) {
+                for (int k = 0; k < 4; ++k) {
+                    points.push_back({i*2.5, j*2.5, k*2.5});
+                }
+            }
+        }
+        auto symmetry = MillerSymmetry::detect(points, {10, 10, 10});
+        CHECK(symmetry.order() == 48);
+    }
+
+    SECTION("orthorhombic grid") {
+        // the same grid in an orthorhombic cell only has the mirror symmetries
+        std::vector<Vector3<double>> points;
+        for (int i = 0; i < 4; ++i) {
+            for (int j = 0; j < 3; ++j) {
+                for (int k = 0; k < 2; ++k) {
+                    points.push_back({i*2.5, j*4., k*6.});
+                }
+            }
+        }
+        auto symmetry = MillerSymmetry::detect(points, {10, 12, 12});
+        CHECK(symmetry.order() == 8);
+    }
+
+    SECTION("no symmetry") {
+        std::mt19937 gen(1);
+        std::uniform_real_distribution<double> dist(0, 10);
+        std::vector<Vector3<double>> points(50);
+        for (auto& p : points) {p = {dist(gen), dist(gen), dist(gen)};}
+        auto symmetry = MillerSymmetry::detect(points, {10, 10, 10});
+        CHECK(symmetry.order() == 2);
+    }
+}
+
+TEST_CASE("MillerSymmetry::reduce") {
+    auto millers = box(4);
+
+    SECTION("friedel") {
+        MillerSymmetry symmetry;
+        auto reduced = symmetry.reduce(millers);
+        CHECK(reduced.size() == (millers.size()+1)/2);
+        unsigned int total = std::accumulate(reduced.begin(), reduced.end(), 0u, [] (unsigned int sum, const Miller& m) {return sum + m.multiplicity;});
+        CHECK(total == millers.size());
+    }
+
+    SECTION("equivalent intensities") {
+        // the reduced set must give the same weighted intensity sum as the full set
+        std::vector<Vector3<double>> points;
+        for (int i = 0; i < 3; ++i) {
+            for (int j = 0; j < 3; ++j) {
+                points.push_back({i*10./3, j*10./3, 0});
+            }
+        }
+        points.push_back({5, 5, 2});
+        points.push_back({5, 5, 8});
+        Vector3<double> cell(10, 10, 10);
+        auto symmetry = MillerSymmetry::detect(points, cell);
+        REQUIRE(symmetry.order() == 16);
+
+        auto reduced = symmetry.reduce(millers);
+        CHECK(reduced.size() < millers.size()/8);
+
+        double expected = 0, result = 0;
+        for (const auto& m : millers) {expected += intensity(points, cell, m);}
+        for (const auto& m : reduced) {result += m.multiplicity*intensity(points, cell, m);}
+        CHECK(std::abs(result - expected) < 1e-6*expected);
+    }
+}
+
+TEST_CASE("MillerGenerationFactory: symmetry reduction") {
+    // the reduction is used unless explicitly disabled
+    CHECK(dynamic_cast<SymmetryReducedMillers*>(factory::construct_miller_strategy().get()) != nullptr);
+
+    settings::crystal::use_symmetry = false;
+    CHECK(dynamic_cast<SymmetryReducedMillers*>(factory::construct_miller_strategy().get()) == nullptr);
+    settings::crystal::use_symmetry = true;
+}
\ No newline at end of file
@@ -0,0 +1,62 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <crystal/RotationalAverager.h>
+#include <crystal/miller/Miller.h>
+#include <crystal/Fval.h>
+#include <settings/CrystalSettings.h>
+#include <utility/Basis3D.h>
+
+#include <vector>
+#include <complex>
+#include <random>
+
+using namespace crystal;
+
+TEST_CASE("RotationalAverager::generate_orientations") {
+    for (auto choice : {settings::crystal::OrientationChoice::Random, settings::crystal::OrientationChoice::Fibonacci}) {
+        auto orientations = RotationalAverager::generate_orientations(50, choice);
+        REQUIRE(orientations.size() == 50);
+        for (const auto& R : orientations) {
+            // each orientation must be a proper rotation
+            auto I = R*R.T();
+            for (unsigned int i = 0; i < 3; ++i) {
+                for (unsigned int j = 0; j < 3; ++j) {
+                    CHECK(std::abs(I(i, j) - (i == j)) < 1e-12);
+                }
+            }
+            Vector3<double> x(R(0, 0), R(1, 0), R(2, 0)), y(R(0, 1), R(1, 1), R(2, 1)), z(R(0, 2), R(1, 2), R(2, 2));
+            CHECK(std::abs(x.cross(y).dot(z) - 1) < 1e-12);
+        }
+    }
+}
+
+TEST_CASE("RotationalAverager::average") {
+    std::mt19937 gen(1);
+    std::uniform_real_distribution<double> dist(0, 10);
+    std::vector<Vector3<double>> points(30);
+    for (auto& p : points) {p = {dist(gen), dist(gen), dist(gen)};}
+    Fval::set_basis(Basis3D({10, 0, 0}, {0, 10, 0}, {0, 0, 10}));
+
+    std::vector<Miller> millers;
+    for (int h = 0; h <= 2; ++h) {
+        for (int k = -2; k <= 2; ++k) {
+            millers.emplace_back(h, k, 1);
+        }
+    }
+    auto orientations = RotationalAverager::generate_orientations(7, settings::crystal::OrientationChoice::Fibonacci);
+    auto result = RotationalAverager(points).average(millers, orientations);
+
+    // compare with explicitly rotating a copy of the points for each orientation
+    for (unsigned int i = 0; i < millers.size(); ++i) {
+        double expected = 0;
+        for (const auto& R : orientations) {
+            std::complex<double> F = 0;
+            for (auto p : points) {
+                p.rotate(R);
+                F += std::polar(1.0, -Fval::Q(millers[i]).dot(p));
+            }
+            expected += std::norm(F)/orientations.size();
+        }
+        CHECK(std::abs(result[i] - expected) < 1e-9*expected);
+    }
+}
\ No newline at end of file
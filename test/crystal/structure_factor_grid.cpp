@@ -0,0 +1,52 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include <crystal/StructureFactorGrid.h>
+#include <math/Vector3.h>
+
+#include <vector>
+#include <array>
+#include <complex>
+#include <random>
+#include <cmath>
+#include <numbers>
+
+TEST_CASE("StructureFactorGrid::F") {
+    std::mt19937 gen(1);
+    std::uniform_real_distribution<double> dist(-5, 15);
+    std::vector<Vector3<double>> points(200);
+    for (auto& p : points) {p = {dist(gen), dist(gen), dist(gen)};}
+
+    Vector3<double> cell(10, 12, 8);
+
+    // the larger range is oversampled by the minimum ratio of 1.25 along the first axis
+    auto [H, K, L] = GENERATE(std::array{6, 5, 4}, std::array{25, 24, 23});
+    crystal::StructureFactorGrid grid(points, cell, H, K, L);
+
+    // compare with the direct summation for all indices
+    double max_error = 0;
+    for (int h = -H; h <= H; ++h) {
+        for (int k = -K; k <= K; ++k) {
+            for (int l = -L; l <= L; ++l) {
+                std::complex<double> expected = 0;
+                for (const auto& p : points) {
+                    expected += std::polar(1.0, -2*std::numbers::pi*(h*p.x()/cell.x() + k*p.y()/cell.y() + l*p.z()/cell.z()));
+                }
+                max_error = std::max(max_error, std::abs(grid.F(h, k, l) - expected));
+            }
+        }
+    }
+    CHECK(max_error < 1e-3);
+    CHECK_THROWS(grid.F(H+1, 0, 0));
+}
+
+TEST_CASE("StructureFactorGrid::bytes") {
+    // at least 1.25 times oversampled, rounded up to a power of two
+    CHECK(crystal::StructureFactorGrid::bytes(30, 30, 30) == 128*128*128*sizeof(std::complex<double>));
+    CHECK(crystal::StructureFactorGrid::bytes(200, 200, 200) == std::size_t(512)*512*512*sizeof(std::complex<double>));
+
+    // but never smaller than the spreading kernel
+    CHECK(crystal::StructureFactorGrid::bytes(6, 5, 4) == 32*32*32*sizeof(std::complex<double>));
+    CHECK(crystal::StructureFactorGrid::bytes(0, 0, 0) == 32*32*32*sizeof(std::complex<double>));
+}
\ No newline at end of file
@@ -16,6 +16,10 @@
 #include <em/detail/ExtendedLandscape.h>
 #include <fitter/ExcludedVolumeFitter.h>
 #include <mini/detail/FittedParameter.h>
+#include <fitter/LinearFitter.h>
+#include <fitter/Fit.h>
+#include <hist/intensity_calculator/DistanceHistogram.h>
+#include <dataset/SimpleDataset.h>
 
 using namespace data;
 
@@ -93,4 +97,66 @@ TEST_CASE("fitter: consistent_charge_scaling") {
         fit2 = fitter.fit_chi2_only();
         REQUIRE_THAT(fit1, Catch::Matchers::WithinAbs(fit2, 1e-6));
     }
+}
+
+TEST_CASE("LinearFitter: normalized chi2") {
+    // a simple model histogram
+    hist::Distribution1D p(100);
+    for (unsigned int i = 0; i < p.size(); ++i) {
+        p.index(i) = std::exp(-0.01*(i - 40.)*(i - 40.));
+    }
+    hist::DistanceHistogram model(std::move(p));
+
+    // data points generated from the model with a deterministic perturbation
+    std::vector<double> q, I, Ierr;
+    for (unsigned int i = 0; i < 60; ++i) {
+        double qi = 0.01 + 0.005*i;
+        double Ii = 3*model.debye_transform({qi}).y(0) + 5;
+        q.push_back(qi);
+        I.push_back(Ii*(1 + 0.02*std::sin(7.*i)));
+        Ierr.push_back(0.05*Ii);
+    }
+    SimpleDataset data(q, I, Ierr);
+
+    // the first normalization rescales the data itself, while later ones are applied on the fly
+    auto I0 = GENERATE(-1., 1., 1000.);
+    fitter::LinearFitter fitter(data, std::make_unique<hist::DistanceHistogram>(std::move(model)));
+    if (0 < I0) {
+        fitter.normalize_intensity(1);
+        fitter.normalize_intensity(I0);
+    }
+
+    // the buffered chi2 must match the full SimpleLeastSquares fit on the normalized dataset
+    double chi2 = fitter.fit_chi2_only();
+    double expected = fitter.fit()->fval;
+    REQUIRE_THAT(chi2, Catch::Matchers::WithinRel(expected, 1e-6));
+}
+
+TEST_CASE("LinearFitter: changing the q-range") {
+    hist::Distribution1D p(100);
+    for (unsigned int i = 0; i < p.size(); ++i) {
+        p.index(i) = std::exp(-0.01*(i - 40.)*(i - 40.));
+    }
+    hist::DistanceHistogram model(p);
+
+    std::vector<double> q, I, Ierr;
+    for (unsigned int i = 0; i < 60; ++i) {
+        double qi = 0.03 + 0.005*i;
+        double Ii = 3*model.debye_transform({qi}).y(0) + 5;
+        q.push_back(qi);
+        I.push_back(Ii*(1 + 0.02*std::sin(7.*i)));
+        Ierr.push_back(0.05*Ii);
+    }
+    SimpleDataset data(q, I, Ierr);
+
+    // the splicing operator depends on the q-axis of the calling thread, so it must follow changes of the q-range
+    auto qmin = settings::axes::qmin;
+    fitter::LinearFitter fitter(data, std::make_unique<hist::DistanceHistogram>(p));
+    double before = fitter.fit_chi2_only();
+    settings::axes::qmin = 0.02;
+    double after = fitter.fit_chi2_only();
+    double expected = fitter::LinearFitter(data, std::make_unique<hist::DistanceHistogram>(p)).fit_chi2_only();
+    settings::axes::qmin = qmin;
+    CHECK_THAT(after, Catch::Matchers::WithinRel(expected, 1e-9));
+    CHECK_THAT(before, Catch::Matchers::WithinRel(fitter.fit_chi2_only(), 1e-9));
 }
\ No newline at end of file
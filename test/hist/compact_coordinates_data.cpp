@@ -2,6 +2,9 @@
 #include <catch2/matchers/catch_matchers_floating_point.hpp>
 
 #include <hist/detail/CompactCoordinatesData.h>
+#include <hist/detail/CompactCoordinates.h>
+#include <hist/detail/DistanceAxis.h>
+#include <utility/Exceptions.h>
 #include <constants/Constants.h>
 #include <math/Vector3.h>
 
@@ -31,18 +34,18 @@ struct DebugData : CompactCoordinatesData {
     QuadEvaluatedResult evaluate_scalar(const CompactCoordinatesData& v1, const CompactCoordinatesData& v2, const CompactCoordinatesData& v3, const CompactCoordinatesData& v4) const {return CompactCoordinatesData::evaluate_scalar(v1, v2, v3, v4);}
     OctoEvaluatedResult evaluate_scalar(const CompactCoordinatesData& v1, const CompactCoordinatesData& v2, const CompactCoordinatesData& v3, const CompactCoordinatesData& v4, const CompactCoordinatesData& v5, const CompactCoordinatesData& v6, const CompactCoordinatesData& v7, const CompactCoordinatesData& v8) const {return CompactCoordinatesData::evaluate_scalar(v1, v2, v3, v4, v5, v6, v7, v8);}
 
-    EvaluatedResultRounded evaluate_rounded_scalar(const CompactCoordinatesData& other) const {return CompactCoordinatesData::evaluate_rounded_scalar(other);}
-    QuadEvaluatedResultRounded evaluate_rounded_scalar(const CompactCoordinatesData& v1, const CompactCoordinatesData& v2, const CompactCoordinatesData& v3, const CompactCoordinatesData& v4) const {return CompactCoordinatesData::evaluate_rounded_scalar(v1, v2, v3, v4);}
-    OctoEvaluatedResultRounded evaluate_rounded_scalar(const CompactCoordinatesData& v1, const CompactCoordinatesData& v2, const CompactCoordinatesData& v3, const CompactCoordinatesData& v4, const CompactCoordinatesData& v5, const CompactCoordinatesData& v6, const CompactCoordinatesData& v7, const CompactCoordinatesData& v8) const {return CompactCoordinatesData::evaluate_rounded_scalar(v1, v2, v3, v4, v5, v6, v7, v8);}    
+    EvaluatedResultRounded evaluate_rounded_scalar(const CompactCoordinatesData& other) const {return CompactCoordinatesData::evaluate_rounded_scalar(other, constants::axes::d_inv_width);}
+    QuadEvaluatedResultRounded evaluate_rounded_scalar(const CompactCoordinatesData& v1, const CompactCoordinatesData& v2, const CompactCoordinatesData& v3, const CompactCoordinatesData& v4) const {return CompactCoordinatesData::evaluate_rounded_scalar(v1, v2, v3, v4, constants::axes::d_inv_width);}
+    OctoEvaluatedResultRounded evaluate_rounded_scalar(const CompactCoordinatesData& v1, const CompactCoordinatesData& v2, const CompactCoordinatesData& v3, const CompactCoordinatesData& v4, const CompactCoordinatesData& v5, const CompactCoordinatesData& v6, const CompactCoordinatesData& v7, const CompactCoordinatesData& v8) const {return CompactCoordinatesData::evaluate_rounded_scalar(v1, v2, v3, v4, v5, v6, v7, v8, constants::axes::d_inv_width);}    
 
     #if defined __SSE2__
         EvaluatedResult evaluate_sse(const CompactCoordinatesData& other) const {return CompactCoordinatesData::evaluate_sse(other);}
         QuadEvaluatedResult evaluate_sse(const CompactCoordinatesData& v1, const CompactCoordinatesData& v2, const CompactCoordinatesData& v3, const CompactCoordinatesData& v4) const {return CompactCoordinatesData::evaluate_sse(v1, v2, v3, v4);}
         OctoEvaluatedResult evaluate_sse(const CompactCoordinatesData& v1, const CompactCoordinatesData& v2, const CompactCoordinatesData& v3, const CompactCoordinatesData& v4, const CompactCoordinatesData& v5, const CompactCoordinatesData& v6, const CompactCoordinatesData& v7, const CompactCoordinatesData& v8) const {return CompactCoordinatesData::evaluate_sse(v1, v2, v3, v4, v5, v6, v7, v8);}
 
-        EvaluatedResultRounded evaluate_rounded_sse(const CompactCoordinatesData& other) const {return CompactCoordinatesData::evaluate_rounded_sse(other);}
-        QuadEvaluatedResultRounded evaluate_rounded_sse(const CompactCoordinatesData& v1, const CompactCoordinatesData& v2, const CompactCoordinatesData& v3, const CompactCoordinatesData& v4) const {return CompactCoordinatesData::evaluate_rounded_sse(v1, v2, v3, v4);}
-        OctoEvaluatedResultRounded evaluate_rounded_sse(const CompactCoordinatesData& v1, const CompactCoordinatesData& v2, const CompactCoordinatesData& v3, const CompactCoordinatesData& v4, const CompactCoordinatesData& v5, const CompactCoordinatesData& v6, const CompactCoordinatesData& v7, const CompactCoordinatesData& v8) const {return CompactCoordinatesData::evaluate_rounded_sse(v1, v2, v3, v4, v5, v6, v7, v8);}
+        EvaluatedResultRounded evaluate_rounded_sse(const CompactCoordinatesData& other) const {return CompactCoordinatesData::evaluate_rounded_sse(other, constants::axes::d_inv_width);}
+        QuadEvaluatedResultRounded evaluate_rounded_sse(const CompactCoordinatesData& v1, const CompactCoordinatesData& v2, const CompactCoordinatesData& v3, const CompactCoordinatesData& v4) const {return CompactCoordinatesData::evaluate_rounded_sse(v1, v2, v3, v4, constants::axes::d_inv_width);}
+        OctoEvaluatedResultRounded evaluate_rounded_sse(const CompactCoordinatesData& v1, const CompactCoordinatesData& v2, const CompactCoordinatesData& v3, const CompactCoordinatesData& v4, const CompactCoordinatesData& v5, const CompactCoordinatesData& v6, const CompactCoordinatesData& v7, const CompactCoordinatesData& v8) const {return CompactCoordinatesData::evaluate_rounded_sse(v1, v2, v3, v4, v5, v6, v7, v8, constants::axes::d_inv_width);}
     #endif
 
     #if defined __AVX__
@@ -50,9 +53,9 @@ struct DebugData : CompactCoordinatesData {
         QuadEvaluatedResult evaluate_avx(const CompactCoordinatesData& v1, const CompactCoordinatesData& v2, const CompactCoordinatesData& v3, const CompactCoordinatesData& v4) const {return CompactCoordinatesData::evaluate_avx(v1, v2, v3, v4);}
         OctoEvaluatedResult evaluate_avx(const CompactCoordinatesData& v1, const CompactCoordinatesData& v2, const CompactCoordinatesData& v3, const CompactCoordinatesData& v4, const CompactCoordinatesData& v5, const CompactCoordinatesData& v6, const CompactCoordinatesData& v7, const CompactCoordinatesData& v8) const {return CompactCoordinatesData::evaluate_avx(v1, v2, v3, v4, v5, v6, v7, v8);}
 
-        EvaluatedResultRounded evaluate_rounded_avx(const CompactCoordinatesData& other) const {return CompactCoordinatesData::evaluate_rounded_avx(other);}
-        QuadEvaluatedResultRounded evaluate_rounded_avx(const CompactCoordinatesData& v1, const CompactCoordinatesData& v2, const CompactCoordinatesData& v3, const CompactCoordinatesData& v4) const {return CompactCoordinatesData::evaluate_rounded_avx(v1, v2, v3, v4);}
-        OctoEvaluatedResultRounded evaluate_rounded_avx(const CompactCoordinatesData& v1, const CompactCoordinatesData& v2, const CompactCoordinatesData& v3, const CompactCoordinatesData& v4, const CompactCoordinatesData& v5, const CompactCoordinatesData& v6, const CompactCoordinatesData& v7, const CompactCoordinatesData& v8) const {return CompactCoordinatesData::evaluate_rounded_avx(v1, v2, v3, v4, v5, v6, v7, v8);}
+        EvaluatedResultRounded evaluate_rounded_avx(const CompactCoordinatesData& other) const {return CompactCoordinatesData::evaluate_rounded_avx(other, constants::axes::d_inv_width);}
+        QuadEvaluatedResultRounded evaluate_rounded_avx(const CompactCoordinatesData& v1, const CompactCoordinatesData& v2, const CompactCoordinatesData& v3, const CompactCoordinatesData& v4) const {return CompactCoordinatesData::evaluate_rounded_avx(v1, v2, v3, v4, constants::axes::d_inv_width);}
+        OctoEvaluatedResultRounded evaluate_rounded_avx(const CompactCoordinatesData& v1, const CompactCoordinatesData& v2, const CompactCoordinatesData& v3, const CompactCoordinatesData& v4, const CompactCoordinatesData& v5, const CompactCoordinatesData& v6, const CompactCoordinatesData& v7, const CompactCoordinatesData& v8) const {return CompactCoordinatesData::evaluate_rounded_avx(v1, v2, v3, v4, v5, v6, v7, v8, constants::axes::d_inv_width);}
     #endif
 };
 
@@ -224,4 +227,35 @@ TEST_CASE("CompactCoordinatesData::evaluate") {
             octo_tests_rounded([](const DebugData& data, const DebugData& data1, const DebugData& data2, const DebugData& data3, const DebugData& data4, const DebugData& data5, const DebugData& data6, const DebugData& data7, const DebugData& data8) { return data.evaluate_rounded_avx(data1, data2, data3, data4, data5, data6, data7, data8); });
         }
     #endif
+}
+
+TEST_CASE("CompactCoordinates::get_required_bins") {
+    unsigned int axis_bins = get_distance_axis().bins;
+    double width = get_bin_width();
+
+    SECTION("empty") {
+        CompactCoordinates empty;
+        CHECK(get_required_bins({empty}) == 10);
+    }
+
+    SECTION("bounding box") {
+        // the largest distance is the diagonal between the two sets
+        CompactCoordinates a(std::vector<Vector3<double>>{{0, 0, 0}, {10, 0, 0}}, 1);
+        CompactCoordinates b(std::vector<Vector3<double>>{{10, 20, 20}}, 1);
+        unsigned int bins = get_required_bins({a, b});
+        CHECK(std::round(30/width) < bins);
+        CHECK(bins <= std::round(30/width) + 3);
+        CHECK(get_required_bins({a}) < bins);
+
+        auto res = b[0].evaluate_rounded(a[0], 1/width);
+        CHECK(res.distance < (int) bins);
+    }
+
+    SECTION("limits") {
+        CompactCoordinates small(std::vector<Vector3<double>>{{0, 0, 0}, {0, 0, 0.1}}, 1);
+        CHECK(get_required_bins({small}) == 10);
+
+        CompactCoordinates large(std::vector<Vector3<double>>{{0, 0, 0}, {0, 0, 10*axis_bins*width}}, 1);
+        CHECK_THROWS_AS(get_required_bins({large}), except::size_error);
+    }
 }
\ No newline at end of file
@@ -9,6 +9,8 @@
 #include <settings/All.h>
 #include <plots/All.h>
 
+#include <numeric>
+
 TEST_CASE("DistanceHistogram::is_highly_ordered") {
     settings::general::verbose = false;
     settings::molecule::use_effective_charge = false;
@@ -74,4 +76,45 @@ TEST_CASE("DistanceHistogram: check relative errors") {
             REQUIRE(rel_error < 0.01);
         }
     }
+}
+
+TEST_CASE("DistanceHistogram: runtime bin width") {
+    settings::general::verbose = false;
+    settings::molecule::use_effective_charge = false;
+    settings::molecule::implicit_hydrogens = false;
+    settings::hist::weighted_bins = true;
+    auto width = settings::axes::distance_bin_width;
+    auto max_distance = settings::axes::max_distance;
+
+    auto protein = data::Molecule("test/files/2epe.pdb");
+    protein.clear_hydration();
+    auto I_exact = protein.debye_transform();
+    auto h_default = protein.get_histogram();
+    double counts_default = std::accumulate(h_default->get_total_counts().begin(), h_default->get_total_counts().end(), 0.0);
+
+    settings::axes::distance_bin_width = 0.5;
+    settings::axes::max_distance = 500;
+    auto coarse = data::Molecule("test/files/2epe.pdb");
+    coarse.clear_hydration();
+    auto h = coarse.get_histogram();
+    const auto& d = h->get_d_axis();
+    REQUIRE(d.size() < h_default->get_d_axis().size()/4);
+    for (unsigned int i = 1; i < d.size(); ++i) {
+        CHECK(std::abs(d[i] - 0.5*i) <= 0.25);
+    }
+
+    double counts = std::accumulate(h->get_total_counts().begin(), h->get_total_counts().end(), 0.0);
+    CHECK(std::abs(counts - counts_default) < 1e-6*counts_default);
+
+    auto I_estimated = h->debye_transform();
+    for (unsigned int i = 0; i < I_estimated.size(); ++i) {
+        auto rel_error = std::abs(I_estimated[i] - I_exact[i]) / I_exact[i];
+        REQUIRE(rel_error < 0.02); // coarser bins are slightly less accurate at high q
+    }
+
+    settings::axes::distance_bin_width = 0;
+    CHECK_THROWS(data::Molecule("test/files/2epe.pdb").get_histogram());
+
+    settings::axes::distance_bin_width = width;
+    settings::axes::max_distance = max_distance;
 }
\ No newline at end of file
@@ -12,6 +12,7 @@
 #include <hist/distance_calculator/HistogramManagerMTFFAvg.h>
 #include <hist/distance_calculator/HistogramManagerMTFFExplicit.h>
 #include <hist/distance_calculator/HistogramManagerMTFFGrid.h>
+#include <hist/distance_calculator/HistogramManagerMP.h>
 #include <hist/distance_calculator/PartialHistogramManager.h>
 #include <hist/distance_calculator/PartialHistogramManagerMT.h>
 #include <hist/intensity_calculator/CompositeDistanceHistogramFFAvg.h>
@@ -19,7 +20,12 @@
 #include <io/ExistingFile.h>
 #include <settings/MoleculeSettings.h>
 #include <settings/HistogramSettings.h>
+#include <settings/GeneralSettings.h>
 #include <constants/Constants.h>
+#include <utility/TaskScheduler.h>
+#include <utility/Exceptions.h>
+
+#include <random>
 
 using namespace data::record;
 using namespace data;
@@ -325,6 +331,126 @@ TEST_CASE_METHOD(analytical_histogram, "HistogramManager::calculate_all") {
     }
 }
 
+TEST_CASE("HistogramManagerMT::calculate_all nested") {
+    settings::general::verbose = false;
+    Molecule protein("test/files/2epe.pdb");
+    protein.generate_new_hydration();
+    auto p_exp = hist::HistogramManager<false>(&protein).calculate_all()->get_total_counts();
+
+    // the multi-threaded managers must also work when called from inside other tasks
+    // a worker waiting on an inner group only runs the queued tasks of that group, and sleeps once the rest are running on other workers
+    std::vector<Molecule> proteins(4, protein);
+    std::vector<std::vector<double>> results(proteins.size());
+    utility::multi_threading::TaskGroup tasks;
+    for (unsigned int i = 0; i < proteins.size(); ++i) {
+        tasks.run([&proteins, &results, i] () {
+            results[i] = i % 2 == 0 
+                ? hist::HistogramManagerMT<false>(&proteins[i]).calculate_all()->get_total_counts()
+                : hist::PartialHistogramManagerMT<false>(&proteins[i]).calculate_all()->get_total_counts()
+            ;
+        });
+    }
+    tasks.wait();
+    for (const auto& p : results) {
+        REQUIRE(compare_hist(p_exp, p));
+    }
+}
+
+TEST_CASE("HistogramManagerMT: uniform weights") {
+    settings::general::verbose = false;
+    settings::molecule::use_effective_charge = false;
+    settings::molecule::implicit_hydrogens = false;
+
+    // all atoms are carbons and all waters are oxygens, so the pairs are only counted and then scaled by the weights
+    std::vector<Atom> a;
+    std::vector<Water> w;
+    for (int i = 0; i < 1000; ++i) {
+        a.emplace_back(Vector3<double>(i % 10, (i/10) % 10, i/100.), 1, constants::atom_t::C, "C", i);
+    }
+    for (int i = 0; i < 200; ++i) {
+        w.emplace_back(Atom(Vector3<double>(i % 7 - 5, (i/7) % 7 - 5, i/49.), 1, constants::atom_t::O, "HOH", i));
+    }
+    Molecule protein(a, w);
+    auto hm = hist::HistogramManager<false>(&protein).calculate_all();
+    auto hm_mt = hist::HistogramManagerMT<false>(&protein).calculate_all();
+    CHECK(hm_mt->get_aa_counts().get_content() == hm->get_aa_counts().get_content());
+    CHECK(hm_mt->get_aw_counts().get_content() == hm->get_aw_counts().get_content());
+    CHECK(hm_mt->get_ww_counts().get_content() == hm->get_ww_counts().get_content());
+    CHECK(hm_mt->get_total_counts() == hm->get_total_counts());
+}
+
+TEST_CASE("PartialHistogramManagerMT: uniform weights") {
+    settings::general::verbose = false;
+    settings::molecule::use_effective_charge = false;
+    settings::molecule::implicit_hydrogens = false;
+    auto manager = settings::hist::histogram_manager;
+    auto weighted_bins = settings::hist::weighted_bins;
+    settings::hist::histogram_manager = settings::hist::HistogramManagerChoice::PartialHistogramManagerMT;
+    settings::hist::weighted_bins = false;
+
+    // each body shares a single weight, but the weights differ between the bodies
+    // the coordinates are random, so no distance lies exactly on a bin edge where the managers could round differently
+    std::mt19937 gen(1);
+    std::uniform_real_distribution<double> dist(0, 10);
+    std::vector<Atom> a1, a2;
+    std::vector<Water> w;
+    for (int i = 0; i < 500; ++i) {
+        a1.emplace_back(Vector3<double>(dist(gen), dist(gen), dist(gen)), 1, constants::atom_t::C, "C", i);
+        a2.emplace_back(Vector3<double>(dist(gen) + 12, dist(gen), dist(gen)), 1, constants::atom_t::N, "N", i);
+    }
+    for (int i = 0; i < 200; ++i) {
+        w.emplace_back(Atom(Vector3<double>(dist(gen) - 5, dist(gen) - 5, dist(gen)), 1, constants::atom_t::O, "HOH", i));
+    }
+    Molecule protein({Body(a1), Body(a2)}, w);
+
+    // the partial histograms store the atom-water counts with a factor two, so only the other contributions are compared directly
+    auto compare = [&protein] () {
+        auto result = protein.get_histogram();
+        auto expected = hist::HistogramManagerMT<false>(&protein).calculate_all();
+        CHECK(result->get_aa_counts().get_content() == expected->get_aa_counts().get_content());
+        CHECK(result->get_ww_counts().get_content() == expected->get_ww_counts().get_content());
+        CHECK(result->get_total_counts() == expected->get_total_counts());
+    };
+    compare();
+
+    // only the partial histograms of the moved body are counted again
+    protein.get_body(1).translate(Vector3<double>(3, 0, 0));
+    compare();
+    settings::hist::histogram_manager = manager;
+    settings::hist::weighted_bins = weighted_bins;
+}
+
+TEST_CASE_METHOD(analytical_histogram, "HistogramManagerMP::calculate_all") {
+    settings::general::verbose = false;
+    auto processes = settings::general::processes;
+    Molecule protein("test/files/2epe.pdb");
+    protein.generate_new_hydration();
+
+    SECTION("real data with hydration") {
+        auto p_exp = hist::HistogramManagerMT<false>(&protein).calculate_all()->get_total_counts();
+        for (unsigned int n : {1, 3, 8}) {
+            settings::general::processes = n;
+            REQUIRE(compare_hist(p_exp, hist::HistogramManagerMP<false>(&protein).calculate_all()->get_total_counts()));
+            REQUIRE(compare_hist(p_exp, hist::HistogramManagerMP<true>(&protein).calculate_all()->get_total_counts()));
+        }
+    }
+
+    SECTION("identical to the threaded result") {
+        // with unit weights all partial sums are exact, so the results must agree to the last bit regardless of the tiling
+        set_unity_charge(protein);
+        auto hm_mt = hist::HistogramManagerMT<false>(&protein).calculate_all();
+        for (unsigned int n : {1, 3, 8}) {
+            settings::general::processes = n;
+            auto hm_mp = hist::HistogramManagerMP<false>(&protein).calculate_all();
+            CHECK(hm_mp->get_aa_counts().get_content() == hm_mt->get_aa_counts().get_content());
+            CHECK(hm_mp->get_aw_counts().get_content() == hm_mt->get_aw_counts().get_content());
+            CHECK(hm_mp->get_ww_counts().get_content() == hm_mt->get_ww_counts().get_content());
+            CHECK(hm_mp->get_total_counts() == hm_mt->get_total_counts());
+        }
+    }
+    settings::general::processes = processes;
+}
+
 TEST_CASE("PartialHistogramManager::get_probe") {
     settings::general::verbose = false;
     Molecule protein("test/files/2epe.pdb");
@@ -348,4 +474,34 @@ TEST_CASE("PartialHistogramManager::signal_modified_hydration_layer") {
     sm->reset_to_false();
     phm.signal_modified_hydration_layer();
     CHECK(sm->get_modified_hydration());
+}
+
+TEST_CASE("PartialHistogramManager: distance axis") {
+    settings::general::verbose = false;
+    auto max_distance = settings::axes::max_distance;
+    auto manager = settings::hist::histogram_manager;
+    settings::axes::max_distance = 100;
+
+    std::vector<Body> bodies = {
+        Body(std::vector<Atom>{Atom(Vector3<double>(0, 0, 0), 1, constants::atom_t::C, "C", 1)}),
+        Body(std::vector<Atom>{Atom(Vector3<double>(50, 0, 0), 1, constants::atom_t::C, "C", 1)})
+    };
+
+    SECTION("too large") {
+        // the partial histograms span the full axis, so larger molecules must be rejected instead of written past the end
+        Molecule protein(bodies);
+        protein.get_body(1).translate(Vector3<double>(100, 0, 0));
+        CHECK_THROWS_AS(hist::PartialHistogramManager<false>(&protein).calculate(), except::size_error);
+        CHECK_THROWS_AS(hist::PartialHistogramManagerMT<false>(&protein).calculate(), except::size_error);
+    }
+
+    SECTION("moved outside") {
+        settings::hist::histogram_manager = settings::hist::HistogramManagerChoice::PartialHistogramManagerMT;
+        Molecule protein(bodies);
+        CHECK_NOTHROW(protein.get_total_histogram());
+        protein.get_body(1).translate(Vector3<double>(100, 0, 0));
+        CHECK_THROWS_AS(protein.get_total_histogram(), except::size_error);
+    }
+    settings::axes::max_distance = max_distance;
+    settings::hist::histogram_manager = manager;
 }
\ No newline at end of file
@@ -0,0 +1,126 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <data/Molecule.h>
+#include <data/Body.h>
+#include <data/record/Atom.h>
+#include <data/record/Water.h>
+#include <hist/distance_calculator/SymmetryManagerMT.h>
+#include <hist/distance_calculator/HistogramManagerMT.h>
+#include <hist/intensity_calculator/ICompositeDistanceHistogram.h>
+#include <hist/symmetry/PlaneSymmetry.h>
+#include <hist/symmetry/RotationalSymmetry.h>
+#include <hist/symmetry/HelicalSymmetry.h>
+#include <constants/ConstantsMath.h>
+#include <settings/All.h>
+
+#include <random>
+#include <numeric>
+
+using namespace data;
+using namespace data::record;
+
+namespace {
+    // a random asymmetric unit, placed away from the symmetry axes such that the copies do not overlap. settings::molecule::center must be disabled to keep the offset.
+    Molecule asymmetric_unit() {
+        std::mt19937 gen(42);
+        std::uniform_real_distribution<double> dist(0, 10);
+        std::vector<Atom> atoms;
+        std::vector<Water> waters;
+        for (int i = 0; i < 300; ++i) {
+            atoms.emplace_back(Vector3<double>(20 + dist(gen), dist(gen), dist(gen)), 1, constants::atom_t::C, "C", i);
+        }
+        for (int i = 0; i < 50; ++i) {
+            waters.emplace_back(Atom(Vector3<double>(20 + dist(gen), dist(gen), dist(gen) - 5), 1, constants::atom_t::O, "HOH", i));
+        }
+        return Molecule(atoms, waters);
+    }
+
+    // explicitly generate the full assembly from the asymmetric unit
+    Molecule assembly(const Molecule& unit, const hist::symmetry::Symmetry& symmetry) {
+        std::vector<Body> bodies;
+        std::vector<Water> waters;
+        for (unsigned int k = 0; k < symmetry.copies(); ++k) {
+            std::vector<Atom> atoms;
+            for (const auto& body : unit.get_bodies()) {
+                for (auto atom : body.get_atoms()) {
+                    atom.set_coordinates(symmetry.apply(atom.get_coordinates(), k));
+                    atoms.push_back(atom);
+                }
+            }
+            bodies.emplace_back(atoms);
+            for (auto water : unit.get_waters()) {
+                water.set_coordinates(symmetry.apply(water.get_coordinates(), k));
+                waters.push_back(water);
+            }
+        }
+        return Molecule(bodies, waters);
+    }
+
+    // a few pairs may end up in neighbouring bins due to the limited precision of the transformed coordinates
+    void compare(const std::vector<double>& p1, const std::vector<double>& p2) {
+        REQUIRE(p1.size() == p2.size());
+        double total = std::accumulate(p1.begin(), p1.end(), 0.0);
+        double diff = 0;
+        for (unsigned int i = 0; i < p1.size(); ++i) {diff += std::abs(p1[i] - p2[i]);}
+        CHECK(std::abs(total - std::accumulate(p2.begin(), p2.end(), 0.0)) < 1e-6*total);
+        CHECK(diff < 1e-3*total);
+    }
+
+    void check(const Molecule& unit, std::shared_ptr<hist::symmetry::Symmetry> symmetry) {
+        Molecule full = assembly(unit, *symmetry);
+        auto p_exp = hist::HistogramManagerMT<false>(&full).calculate_all();
+
+        auto p_sym = hist::SymmetryManagerMT<false>(&unit, symmetry).calculate_all();
+        compare(p_exp->get_aa_counts().get_content(), p_sym->get_aa_counts().get_content());
+        compare(p_exp->get_aw_counts().get_content(), p_sym->get_aw_counts().get_content());
+        compare(p_exp->get_ww_counts().get_content(), p_sym->get_ww_counts().get_content());
+        compare(p_exp->get_total_counts(), p_sym->get_total_counts());
+
+        auto p_sym_w = hist::SymmetryManagerMT<true>(&unit, symmetry).calculate_all();
+        compare(p_exp->get_total_counts(), p_sym_w->get_total_counts());
+    }
+}
+
+TEST_CASE("Symmetry::get_cross_terms") {
+    auto pairs = [] (const hist::symmetry::Symmetry& symmetry) {
+        unsigned int sum = 0;
+        for (const auto& term : symmetry.get_cross_terms()) {sum += term.multiplicity;}
+        return sum;
+    };
+
+    for (unsigned int n : {1, 2, 3, 4, 7}) {
+        hist::symmetry::RotationalSymmetry rotation({0, 0, 1}, {0, 0, 0}, n);
+        CHECK(pairs(rotation) == n*(n-1)/2);
+
+        hist::symmetry::HelicalSymmetry helix({0, 0, 1}, {0, 0, 0}, 0.5, 5, n);
+        CHECK(pairs(helix) == n*(n-1)/2);
+    }
+    CHECK(pairs(hist::symmetry::PlaneSymmetry({1, 0, 0}, {0, 1, 0})) == 1);
+    CHECK_THROWS(hist::symmetry::RotationalSymmetry({0, 0, 0}, {0, 0, 0}, 2));
+    CHECK_THROWS(hist::symmetry::HelicalSymmetry({0, 0, 1}, {0, 0, 0}, 0.5, 5, 0));
+}
+
+TEST_CASE("SymmetryManagerMT::calculate_all") {
+    settings::general::verbose = false;
+    settings::molecule::use_effective_charge = false;
+    settings::molecule::implicit_hydrogens = false;
+
+    // the asymmetric unit must keep its position relative to the symmetry elements, so it must not be recentred
+    settings::ScopedContext context{settings::Context()};
+    settings::molecule::center = false;
+    Molecule unit = asymmetric_unit();
+    REQUIRE(20 <= unit.get_body(0).get_atom(0).get_coordinates().x());
+
+    SECTION("plane") {
+        check(unit, std::make_shared<hist::symmetry::PlaneSymmetry>(Vector3<double>(0, 1, 0), Vector3<double>(0, 0, 1)));
+    }
+
+    SECTION("rotation") {
+        check(unit, std::make_shared<hist::symmetry::RotationalSymmetry>(Vector3<double>(0, 0, 1), Vector3<double>(0, 0, 0), 3));
+        check(unit, std::make_shared<hist::symmetry::RotationalSymmetry>(Vector3<double>(1, 1, 0), Vector3<double>(0, 5, 0), 4));
+    }
+
+    SECTION("helix") {
+        check(unit, std::make_shared<hist::symmetry::HelicalSymmetry>(Vector3<double>(0, 0, 1), Vector3<double>(0, 0, 0), 2*constants::pi/5, 12, 4));
+    }
+}
\ No newline at end of file
@@ -86,6 +86,19 @@ TEST_CASE("WeightedDistribution: tracks content") {
         REQUIRE_THAT(weighted_bins[1], Catch::Matchers::WithinAbs(2.5*width/4, 1e-3));
         REQUIRE_THAT(weighted_bins[2], Catch::Matchers::WithinAbs(2*width, 1e-3));
     }
+
+    SECTION("more than 2^32 pairs") {
+        hist::WeightedDistribution1D p(10);
+        auto width = constants::axes::d_axis.width();
+        std::uint64_t n = std::uint64_t(1) << 33;
+        p.add_index(1, hist::detail::WeightedEntry(n, n, n*width));
+        p.add(width, 1);
+        CHECK(p.index(1).count == n+1);
+
+        p += p;
+        CHECK(p.index(1).count == 2*(n+1));
+        REQUIRE_THAT(p.get_weighted_axis()[1], Catch::Matchers::WithinRel(width, 1e-6));
+    }
 }
 
 class DistanceHistogramDebug : public DistanceHistogram {
@@ -0,0 +1,44 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <hydrate/Grid.h>
+#include <hydrate/GridMember.h>
+#include <hydrate/placement/PlacementFactory.h>
+#include <hydrate/culling/CullingFactory.h>
+#include <hydrate/culling/CullingStrategy.h>
+#include <data/Molecule.h>
+#include <data/record/Water.h>
+#include <settings/All.h>
+
+#include <algorithm>
+#include <vector>
+
+using namespace data;
+using namespace data::record;
+
+TEST_CASE("OutlierCulling::cull") {
+    settings::general::verbose = false;
+    settings::ScopedContext context{settings::Context()};
+    settings::molecule::use_effective_charge = false;
+    settings::molecule::implicit_hydrogens = false;
+    Molecule protein("test/files/LAR1-2.pdb");
+    auto grid = protein.get_grid();
+    grid->expand_volume();
+
+    auto placed = grid::factory::construct_placement_strategy(grid)->place();
+    REQUIRE(grid->get_waters().size() == placed.size());
+
+    // the removed molecules are stored from the start of their own vector, so culling away most of them must not write out of bounds
+    unsigned int target = placed.size()/4;
+    REQUIRE(0 < target);
+    auto culler = grid::factory::construct_culling_strategy(grid, settings::grid::CullingStrategy::OutlierStrategy);
+    culler->set_target_count(target);
+    auto kept = culler->cull(placed);
+    REQUIRE(kept.size() == target);
+
+    // exactly the kept molecules remain in the grid
+    auto remaining = grid->get_waters();
+    REQUIRE(remaining.size() == target);
+    for (const auto& water : kept) {
+        CHECK(std::find_if(remaining.begin(), remaining.end(), [&water] (const Water& w) {return w.coords == water.coords;}) != remaining.end());
+    }
+}
\ No newline at end of file
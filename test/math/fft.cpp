@@ -0,0 +1,75 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <math/FFT.h>
+
+#include <vector>
+#include <complex>
+#include <random>
+#include <numbers>
+
+static std::vector<std::complex<double>> dft(const std::vector<std::complex<double>>& x) {
+    unsigned int n = x.size();
+    std::vector<std::complex<double>> X(n);
+    for (unsigned int k = 0; k < n; ++k) {
+        for (unsigned int j = 0; j < n; ++j) {
+            X[k] += x[j]*std::polar(1.0, -2*std::numbers::pi*k*j/n);
+        }
+    }
+    return X;
+}
+
+TEST_CASE("fft") {
+    std::mt19937 gen(1);
+    std::uniform_real_distribution<double> dist(-1, 1);
+    std::vector<std::complex<double>> x(64);
+    for (auto& v : x) {v = {dist(gen), dist(gen)};}
+
+    SECTION("matches direct transform") {
+        auto X = x;
+        math::fft(X);
+        auto expected = dft(x);
+        for (unsigned int i = 0; i < x.size(); ++i) {
+            REQUIRE_THAT(X[i].real(), Catch::Matchers::WithinAbs(expected[i].real(), 1e-10));
+            REQUIRE_THAT(X[i].imag(), Catch::Matchers::WithinAbs(expected[i].imag(), 1e-10));
+        }
+    }
+
+    SECTION("inverse") {
+        auto X = x;
+        math::fft(X);
+        math::fft(X, true);
+        for (unsigned int i = 0; i < x.size(); ++i) {
+            REQUIRE_THAT(X[i].real()/x.size(), Catch::Matchers::WithinAbs(x[i].real(), 1e-12));
+            REQUIRE_THAT(X[i].imag()/x.size(), Catch::Matchers::WithinAbs(x[i].imag(), 1e-12));
+        }
+    }
+}
+
+TEST_CASE("fft3") {
+    unsigned int nx = 4, ny = 8, nz = 2;
+    std::vector<std::complex<double>> x(nx*ny*nz);
+    std::mt19937 gen(2);
+    std::uniform_real_distribution<double> dist(-1, 1);
+    for (auto& v : x) {v = {dist(gen), dist(gen)};}
+
+    auto X = x;
+    math::fft3(X, nx, ny, nz);
+    for (unsigned int a = 0; a < nx; ++a) {
+        for (unsigned int b = 0; b < ny; ++b) {
+            for (unsigned int c = 0; c < nz; ++c) {
+                std::complex<double> expected = 0;
+                for (unsigned int i = 0; i < nx; ++i) {
+                    for (unsigned int j = 0; j < ny; ++j) {
+                        for (unsigned int k = 0; k < nz; ++k) {
+                            double phase = -2*std::numbers::pi*(double(a*i)/nx + double(b*j)/ny + double(c*k)/nz);
+                            expected += x[(i*ny + j)*nz + k]*std::polar(1.0, phase);
+                        }
+                    }
+                }
+                REQUIRE_THAT(X[(a*ny + b)*nz + c].real(), Catch::Matchers::WithinAbs(expected.real(), 1e-10));
+                REQUIRE_THAT(X[(a*ny + b)*nz + c].imag(), Catch::Matchers::WithinAbs(expected.imag(), 1e-10));
+            }
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,82 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <math/KDTree.h>
+#include <math/Vector3.h>
+
+#include <vector>
+#include <random>
+#include <algorithm>
+
+static std::vector<Vector3<double>> random_points(unsigned int n, std::mt19937& gen) {
+    std::uniform_real_distribution<double> dist(-20, 20);
+    std::vector<Vector3<double>> points(n);
+    for (auto& p : points) {p = {dist(gen), dist(gen), dist(gen)};}
+    return points;
+}
+
+TEST_CASE("KDTree::nearest") {
+    std::mt19937 gen(1);
+    auto points = random_points(1000, gen);
+    math::KDTree tree(points);
+    REQUIRE(tree.size() == 1000);
+
+    SECTION("matches brute force") {
+        for (const auto& q : random_points(200, gen)) {
+            unsigned int expected = 0;
+            for (unsigned int i = 1; i < points.size(); ++i) {
+                if (q.distance(points[i]) < q.distance(points[expected])) {expected = i;}
+            }
+            auto [index, dist] = tree.nearest(q);
+            REQUIRE(index == int(expected));
+            REQUIRE(dist == q.distance(points[expected]));
+        }
+    }
+
+    SECTION("bounded search") {
+        for (const auto& q : random_points(200, gen)) {
+            double closest = std::numeric_limits<double>::max();
+            for (const auto& p : points) {closest = std::min(closest, q.distance(p));}
+            auto [index, dist] = tree.nearest(q, 1);
+            if (closest < 1) {
+                REQUIRE(index != -1);
+                REQUIRE(dist == closest);
+            } else {
+                REQUIRE(index == -1);
+            }
+        }
+    }
+
+    SECTION("empty tree") {
+        math::KDTree empty(std::vector<Vector3<double>>{});
+        REQUIRE(empty.empty());
+        REQUIRE(empty.nearest({0, 0, 0}).first == -1);
+    }
+}
+
+TEST_CASE("KDTree::radius_search") {
+    std::mt19937 gen(2);
+    auto points = random_points(1000, gen);
+    math::KDTree tree(points);
+
+    for (const auto& q : random_points(100, gen)) {
+        std::vector<unsigned int> expected;
+        for (unsigned int i = 0; i < points.size(); ++i) {
+            if (q.distance2(points[i]) <= 25) {expected.push_back(i);}
+        }
+        auto found = tree.radius_search(q, 5);
+        std::sort(found.begin(), found.end());
+        REQUIRE(found == expected);
+    }
+}
+
+TEST_CASE("KDTree: ties") {
+    // the largest index among equally close points is returned
+    std::vector<Vector3<double>> points = {{1, 0, 0}, {0, 1, 0}, {-1, 0, 0}, {0, -1, 0}, {0, 0, 2}, {1, 0, 0}};
+    math::KDTree tree(points);
+    auto [index, dist] = tree.nearest({0, 0, 0});
+    REQUIRE(index == 5);
+    REQUIRE(dist == 1);
+
+    // the bound is still strict
+    REQUIRE(tree.nearest({0, 0, 0}, 1).first == -1);
+}
\ No newline at end of file
@@ -9,6 +9,7 @@
 #include <math/Cramer2DSolver.h>
 #include <math/GivensSolver.h>
 #include <math/CubicSpline.h>
+#include <math/CubicSplineResampler.h>
 #include <math/LUPDecomposition.h>
 #include <math/QRDecomposition.h>
 #include <math/Statistics.h>
@@ -154,6 +155,41 @@ TEST_CASE("cubic_spline", "[manual],[math]") {
     plot.save("temp/cubicspline.png");
 }
 
+TEST_CASE("cubic_spline_resampler") {
+    std::vector<double> x(50), y(50);
+    for (unsigned int i = 0; i < x.size(); ++i) {
+        x[i] = 0.01 + 0.02*i + 0.001*i*i;
+        y[i] = std::exp(-x[i])*std::sin(3*x[i]);
+    }
+
+    std::vector<double> z;
+    for (double v = -0.1; v < x.back() + 0.1; v += 0.013) {
+        z.push_back(v);
+    }
+
+    math::CubicSpline spline(x, y);
+    math::CubicSplineResampler resampler(x, z);
+    REQUIRE(resampler.size_in() == x.size());
+    REQUIRE(resampler.size_out() == z.size());
+
+    std::vector<double> out;
+    for (unsigned int repeat = 0; repeat < 2; ++repeat) {
+        resampler.resample(y, out);
+        REQUIRE(out.size() == z.size());
+        for (unsigned int i = 0; i < z.size(); ++i) {
+            REQUIRE_THAT(out[i], Catch::Matchers::WithinAbs(spline.spline(z[i]), 1e-9));
+        }
+    }
+
+    // the operator must be reusable for different curves on the same axis
+    std::transform(y.begin(), y.end(), y.begin(), [] (double v) {return 2*v + 1;});
+    math::CubicSpline spline2(x, y);
+    auto out2 = resampler.resample(y);
+    for (unsigned int i = 0; i < z.size(); ++i) {
+        REQUIRE_THAT(out2[i], Catch::Matchers::WithinAbs(spline2.spline(z[i]), 1e-9));
+    }
+}
+
 TEST_CASE("orthonormal_rotations") {
     for (int i = 0; i < 10; i++) {
         Vector3<double> angles = GenRandVector(3);
@@ -13,6 +13,8 @@
 #include <settings/MoleculeSettings.h>
 #include <settings/GeneralSettings.h>
 
+#include <limits>
+
 using namespace data;
 using namespace data::record;
 
@@ -38,6 +40,42 @@ TEST_CASE("LinearConstraints::generate") {
         REQUIRE(rigidbody.get_constraint_manager()->distance_constraints.size() == 3);
     }
 
+    SECTION("ties") {
+        // several pairs of carbons are equally close, so the chosen pair must match the old exhaustive search
+        bool center = settings::molecule::center;
+        settings::molecule::center = false;
+        auto chain = [] (std::vector<double> xs, double z) {
+            std::vector<Atom> atoms;
+            for (double x : xs) {atoms.push_back(Atom(Vector3<double>(x, 0, z), 1, constants::atom_t::C, "C", 1));}
+            atoms.push_back(Atom(Vector3<double>(xs[0], 0, z + (z < 0 ? 1 : -1)), 1, constants::atom_t::O, "O", 1));
+            return Body(atoms);
+        };
+        rigidbody::RigidBody rigidbody(std::vector<Body>{chain({0, 2, 4, 6}, 0), chain({2, 4}, 3), chain({0, 2, 4, 6}, 6)});
+        settings::molecule::center = center;
+
+        auto& constraints = rigidbody.get_constraint_manager()->distance_constraints;
+        REQUIRE(constraints.size() == 2);
+        for (const auto& constraint : constraints) {
+            const Body& body1 = rigidbody.get_body(constraint.ibody1);
+            const Body& body2 = rigidbody.get_body(constraint.ibody2);
+            double min_dist = std::numeric_limits<double>::max();
+            unsigned int min_atom1 = 0, min_atom2 = 0;
+            for (unsigned int iatom1 = 0; iatom1 < body1.atom_size(); iatom1++) {
+                if (body1.get_atom(iatom1).element != constants::atom_t::C) {continue;}
+                for (unsigned int iatom2 = 0; iatom2 < body2.atom_size(); iatom2++) {
+                    if (body2.get_atom(iatom2).element != constants::atom_t::C) {continue;}
+                    double dist = body1.get_atom(iatom1).distance(body2.get_atom(iatom2));
+                    if (dist > min_dist) {continue;}
+                    min_dist = dist;
+                    min_atom1 = iatom1;
+                    min_atom2 = iatom2;
+                }
+            }
+            CHECK(constraint.iatom1 == min_atom1);
+            CHECK(constraint.iatom2 == min_atom2);
+        }
+    }
+
     SECTION("real data") {
         rigidbody::RigidBody rigidbody = rigidbody::BodySplitter::split("test/files/LAR1-2.pdb", {9, 99});
         REQUIRE(rigidbody.get_constraint_manager()->distance_constraints.size() == 2);
@@ -11,6 +11,7 @@
 #include <rigidbody/constraints/ConstraintManager.h>
 #include <rigidbody/constraints/DistanceConstraint.h>
 #include <rigidbody/transform/TransformGroup.h>
+#include <rigidbody/parameters/ParameterGenerationStrategy.h>
 #include <fitter/HydrationFitter.h>
 #include <data/record/Atom.h>
 #include <data/record/Water.h>
@@ -21,6 +22,13 @@
 #include <hydrate/GridMember.h>
 #include <hydrate/GridObj.h>
 #include <settings/All.h>
+#include <fitter/Fit.h>
+#include <io/File.h>
+#include <utility/Exceptions.h>
+
+#include <fstream>
+#include <string>
+#include <vector>
 
 using namespace data;
 using namespace rigidbody;
@@ -31,6 +39,238 @@ TEST_CASE("RigidBody::apply_calibration") {}
 TEST_CASE("RigidBody::update_fitter") {}
 TEST_CASE("RigidBody::get_constraint_manager") {}
 
+namespace {
+    // a short chain of small bodies, together with a measurement simulated from a slightly different conformation
+    // all settings changed by the fixture or the tests using it are restored afterwards
+    struct chain_fixture {
+        chain_fixture() {
+            settings::general::verbose = false;
+            settings::general::supplementary_plots = false;
+            settings::molecule::center = false;
+            settings::molecule::use_effective_charge = false;
+            settings::molecule::implicit_hydrogens = false;
+            settings::hist::histogram_manager = settings::hist::HistogramManagerChoice::HistogramManager;
+            settings::grid::cubic = true;
+            settings::grid::scaling = 2;
+            settings::rigidbody::constraint_generation_strategy = settings::rigidbody::ConstraintGenerationStrategyChoice::Linear;
+            settings::rigidbody::iterations = 20;
+            settings::rigidbody::seed = 1;
+
+            for (unsigned int b = 0; b < 4; ++b) {
+                std::vector<record::Atom> atoms;
+                for (unsigned int i = 0; i < 6; ++i) {
+                    Vector3<double> pos(4.*b + 1.5*(i%2), 1.5*((i/2)%3), 1.5*((i+b)%2));
+                    atoms.emplace_back(6*b+i, "C", "", "LYS", 'A', b, "", pos, 1, 0, constants::atom_t::C, "0");
+                }
+                bodies.emplace_back(atoms);
+            }
+
+            Molecule target(bodies);
+            target.get_body(3).translate(Vector3<double>(1, 1, 0));
+            target.generate_new_hydration();
+            target.simulate_dataset(false).save(measurement);
+        }
+
+        ~chain_fixture() {
+            settings::general::verbose = previous.verbose;
+            settings::general::supplementary_plots = previous.supplementary_plots;
+            settings::rigidbody::constraint_generation_strategy = previous.constraint_generation_strategy;
+            settings::rigidbody::iterations = previous.iterations;
+            settings::rigidbody::seed = previous.seed;
+            settings::rigidbody::replicas = previous.replicas;
+            settings::rigidbody::swap_interval = previous.swap_interval;
+            settings::rigidbody::speculative_moves = previous.speculative_moves;
+            settings::rigidbody::use_checkpointing = previous.use_checkpointing;
+            settings::rigidbody::checkpoint_interval = previous.checkpoint_interval;
+        }
+
+        // optimize a fresh copy of the chain, returning the final chi2 and the optimized coordinates
+        std::pair<double, std::vector<Vector3<double>>> optimize() const {
+            RigidBody rigidbody(Molecule{bodies});
+            auto fit = rigidbody.optimize(measurement);
+            std::vector<Vector3<double>> coords;
+            for (const auto& atom : rigidbody.get_atoms()) {coords.push_back(atom.coords);}
+            return {fit->fval, coords};
+        }
+
+        // the chi2 of the initial conformation
+        double initial_chi2() const {
+            Molecule molecule(bodies);
+            molecule.generate_new_hydration();
+            fitter::HydrationFitter fitter(measurement, molecule.get_histogram());
+            return fitter.fit()->fval;
+        }
+
+        std::vector<Body> bodies;
+        std::string measurement = settings::general::output + "test/rigidbody/chain.dat";
+
+        private:
+            // the thread-local settings are restored by the context, while the global settings are saved individually
+            settings::ScopedContext context{settings::Context()};
+            struct {
+                bool verbose = settings::general::verbose;
+                bool supplementary_plots = settings::general::supplementary_plots;
+                settings::rigidbody::ConstraintGenerationStrategyChoice constraint_generation_strategy = settings::rigidbody::constraint_generation_strategy;
+                unsigned int iterations = settings::rigidbody::iterations;
+                unsigned int seed = settings::rigidbody::seed;
+                unsigned int replicas = settings::rigidbody::replicas;
+                unsigned int swap_interval = settings::rigidbody::swap_interval;
+                unsigned int speculative_moves = settings::rigidbody::speculative_moves;
+                bool use_checkpointing = settings::rigidbody::use_checkpointing;
+                unsigned int checkpoint_interval = settings::rigidbody::checkpoint_interval;
+            } previous;
+    };
+}
+
+TEST_CASE_METHOD(chain_fixture, "RigidBody::optimize_tempered") {
+    settings::rigidbody::replicas = 3;
+    settings::rigidbody::swap_interval = 5;
+
+    // the coldest replica is greedy, so the result can never be worse than the initial conformation
+    auto [chi2, coords] = optimize();
+    CHECK(chi2 <= initial_chi2()*(1 + 1e-6));
+
+    // with a fixed seed the run is reproducible
+    auto [chi2_repeat, coords_repeat] = optimize();
+    REQUIRE(chi2 == chi2_repeat);
+    REQUIRE(coords == coords_repeat);
+
+    // the trajectory is written
+    REQUIRE(io::File(settings::general::output + "trajectory.xyz").exists());
+}
+
+TEST_CASE_METHOD(chain_fixture, "RigidBody::optimize_speculative") {
+    // the frame numbers are counted across all writers, so they are skipped
+    auto read_trajectory = [] () {
+        std::ifstream in(settings::general::output + "trajectory.xyz");
+        std::vector<std::string> lines;
+        for (std::string line; std::getline(in, line);) {
+            if (line.find("Frame") == std::string::npos) {lines.push_back(line);}
+        }
+        return lines;
+    };
+
+    // the serial optimization with the same seed is the reference
+    // a longer run is used so several moves are accepted, also by workers other than the first
+    settings::rigidbody::iterations = 150;
+    auto [chi2_serial, coords_serial] = optimize();
+    auto trajectory_serial = read_trajectory();
+
+    SECTION("same result as the serial optimization") {
+        settings::rigidbody::speculative_moves = 3;
+        auto [chi2, coords] = optimize();
+
+        // the trajectory contains a frame for each accepted move, so the same moves were accepted in the same order
+        CHECK(read_trajectory() == trajectory_serial);
+        CHECK(chi2 == chi2_serial);
+        CHECK(coords == coords_serial);
+    }
+
+    SECTION("with checkpointing") {
+        settings::rigidbody::speculative_moves = 4;
+        settings::rigidbody::use_checkpointing = true;
+        settings::rigidbody::checkpoint_interval = 3;
+        auto [chi2, coords] = optimize();
+        CHECK(chi2 == chi2_serial);
+        CHECK(coords == coords_serial);
+        CHECK(!io::File(settings::general::output + "temp/rigidbody_checkpoint.dat").exists());
+    }
+
+    SECTION("cannot be combined with parallel tempering") {
+        settings::rigidbody::speculative_moves = 2;
+        settings::rigidbody::replicas = 2;
+        RigidBody rigidbody(Molecule{bodies});
+        CHECK_THROWS_AS(rigidbody.optimize(measurement), except::invalid_argument);
+    }
+}
+
+TEST_CASE_METHOD(chain_fixture, "RigidBody: checkpoints") {
+    struct inspector : public RigidBody {
+        using RigidBody::RigidBody;
+        using RigidBody::save_checkpoint;
+        using RigidBody::load_checkpoint;
+        using RigidBody::remove_checkpoint;
+        parameter::Parameter next() {return parameter_generator->next();}
+        std::pair<unsigned int, unsigned int> select() {return body_selector->next();}
+        void prepare(const std::string& measurement_path) {checkpoint_key = checkpoint_hash(measurement_path);}
+    };
+
+    SECTION("round trip") {
+        inspector saved(Molecule{bodies});
+        saved.prepare(measurement);
+        saved.get_body(2).translate(Vector3<double>(0.5, -0.5, 1));
+        saved.generate_new_hydration();
+        for (unsigned int i = 0; i < 5; ++i) {(void) saved.next(); (void) saved.select();}
+        saved.save_checkpoint(7);
+
+        inspector loaded(Molecule{bodies});
+        loaded.prepare(measurement);
+        REQUIRE(loaded.load_checkpoint() == 7);
+
+        // the configuration is restored
+        auto atoms = saved.get_atoms();
+        auto loaded_atoms = loaded.get_atoms();
+        REQUIRE(atoms.size() == loaded_atoms.size());
+        for (unsigned int i = 0; i < atoms.size(); ++i) {
+            REQUIRE(atoms[i].coords == loaded_atoms[i].coords);
+        }
+        REQUIRE(saved.get_waters().size() == loaded.get_waters().size());
+        for (unsigned int i = 0; i < saved.get_waters().size(); ++i) {
+            REQUIRE(saved.get_waters()[i].coords == loaded.get_waters()[i].coords);
+        }
+
+        // the random number generators continue where they left off
+        for (unsigned int i = 0; i < 5; ++i) {
+            auto p1 = saved.next();
+            auto p2 = loaded.next();
+            REQUIRE(p1.dr == p2.dr);
+            REQUIRE(p1.alpha == p2.alpha);
+            REQUIRE(saved.select() == loaded.select());
+        }
+        saved.remove_checkpoint();
+    }
+
+    SECTION("rejected for another run") {
+        inspector saved(Molecule{bodies});
+        saved.prepare(measurement);
+        saved.get_body(2).translate(Vector3<double>(0.5, -0.5, 1));
+        saved.save_checkpoint(7);
+
+        // a different measurement
+        std::string other = settings::general::output + "test/rigidbody/chain_other.dat";
+        {
+            std::ifstream in(measurement);
+            std::ofstream out(other);
+            out << in.rdbuf() << "\n";
+        }
+        inspector remeasured(Molecule{bodies});
+        remeasured.prepare(other);
+        REQUIRE_THROWS(remeasured.load_checkpoint());
+
+        // a different initial structure
+        auto moved = bodies;
+        moved[0].translate(Vector3<double>(0, 0, 1e-6));
+        inspector restructured(Molecule{moved});
+        restructured.prepare(measurement);
+        REQUIRE_THROWS(restructured.load_checkpoint());
+
+        // the original run can still be resumed
+        inspector resumed(Molecule{bodies});
+        resumed.prepare(measurement);
+        REQUIRE(resumed.load_checkpoint() == 7);
+        saved.remove_checkpoint();
+    }
+
+    SECTION("removed after a completed run") {
+        settings::rigidbody::use_checkpointing = true;
+        settings::rigidbody::checkpoint_interval = 5;
+        inspector rigidbody(Molecule{bodies});
+        rigidbody.remove_checkpoint();
+        rigidbody.optimize(measurement);
+        REQUIRE(rigidbody.load_checkpoint() == 0);
+    }
+}
+
 // test that we can consistently fit the same protein
 // TEST_CASE("RigidBody: reusable fitter", "[files]") {
 //     settings::general::verbose = true;
@@ -3,6 +3,11 @@
 #include <catch2/matchers/catch_matchers_vector.hpp>
 
 #include <settings/All.h>
+#include <utility/TaskScheduler.h>
+#include <io/File.h>
+
+#include <thread>
+#include <fstream>
 
 TEST_CASE("io") {
     SECTION("write_settings") {
@@ -12,4 +17,65 @@ TEST_CASE("io") {
     SECTION("read_settings") {
         settings::read("temp/settings/settings.txt");
     }
+}
+
+TEST_CASE("Context") {
+    settings::grid::width = 1;
+    settings::axes::qmax = 0.5;
+
+    SECTION("threads start with the defaults") {
+        settings::grid::width = 2;
+        double width = 0;
+        std::thread([&width] () {width = settings::grid::width;}).join();
+        CHECK(width == 1);
+        settings::grid::width = 1;
+    }
+
+    SECTION("scoped context") {
+        settings::grid::width = 3;
+        settings::axes::qmax = 0.3;
+        settings::Context context;
+        settings::grid::width = 1;
+        settings::axes::qmax = 0.5;
+        {
+            settings::ScopedContext scope(context);
+            CHECK(settings::grid::width == 3);
+            CHECK(settings::axes::qmax == 0.3);
+        }
+        CHECK(settings::grid::width == 1);
+        CHECK(settings::axes::qmax == 0.5);
+    }
+
+    SECTION("settings files are read by the calling thread") {
+        // the registered settings must resolve to the values of the thread reading the file
+        std::string path = "temp/settings/thread_settings.txt";
+        {
+            std::ofstream out(path);
+            out << "width 3" << std::endl;
+        }
+
+        double width = 0;
+        std::thread([&path, &width] () {
+            settings::read(path);
+            width = settings::grid::width;
+        }).join();
+        CHECK(width == 3);
+        CHECK(settings::grid::width == 1);
+        io::File(path).remove();
+    }
+
+    SECTION("tasks inherit the context") {
+        // two concurrent jobs with different settings
+        std::vector<double> widths(20);
+        utility::multi_threading::TaskGroup tasks;
+        for (unsigned int i = 0; i < widths.size(); ++i) {
+            settings::grid::width = i;
+            tasks.run([&widths, i] () {widths[i] = settings::grid::width;});
+        }
+        tasks.wait();
+        settings::grid::width = 1;
+        for (unsigned int i = 0; i < widths.size(); ++i) {
+            CHECK(widths[i] == i);
+        }
+    }
 }
\ No newline at end of file
@@ -0,0 +1,68 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <table/TableStore.h>
+#include <table/MappedDebyeTable.h>
+#include <table/VectorDebyeTable.h>
+#include <settings/GeneralSettings.h>
+
+#include <filesystem>
+#include <fstream>
+#include <numeric>
+
+TEST_CASE("table::store::get") {
+    unsigned int calls = 0;
+    auto fill = [&calls] (double* data) {
+        ++calls;
+        std::iota(data, data+100, 0);
+    };
+
+    SECTION("disabled") {
+        settings::general::table_store = "";
+        auto segment = table::store::get("test", 100, fill);
+        CHECK(calls == 1);
+        CHECK_FALSE(segment->is_shared());
+        REQUIRE(segment->size() == 100);
+        CHECK(segment->data()[42] == 42);
+    }
+
+    SECTION("enabled") {
+        settings::general::table_store = "temp/tests/table_store/";
+        std::filesystem::remove_all(settings::general::table_store);
+        calls = 0;
+
+        // the first request calculates the table, and the second maps the stored one
+        auto first = table::store::get("test", 100, fill);
+        auto second = table::store::get("test", 100, fill);
+        CHECK(calls == 1);
+        CHECK(first->is_shared());
+        CHECK(second->is_shared());
+        for (unsigned int i = 0; i < 100; ++i) {
+            REQUIRE(first->data()[i] == i);
+            REQUIRE(second->data()[i] == i);
+        }
+
+        // a different size or a corrupted file must result in a new table
+        auto resized = table::store::get("test", 50, [&calls] (double* data) {++calls; std::iota(data, data+50, 0);});
+        CHECK(calls == 2);
+        CHECK(resized->size() == 50);
+
+        std::ofstream(settings::general::table_store + "test.v" + std::to_string(table::store::version) + ".table", std::ios::binary) << "garbage";
+        auto recovered = table::store::get("test", 100, fill);
+        CHECK(calls == 3);
+        CHECK(recovered->data()[99] == 99);
+
+        settings::general::table_store = "";
+    }
+}
+
+TEST_CASE("MappedDebyeTable::get_default_table") {
+    const auto& table = table::MappedDebyeTable::get_default_table();
+    table::VectorDebyeTable reference(constants::axes::d_vals);
+    REQUIRE(table.size_q() == reference.size_q());
+    REQUIRE(table.size_d() == reference.size_d());
+    for (unsigned int i = 0; i < table.size_q(); i += 17) {
+        for (unsigned int j = 0; j < table.size_d(); j += 101) {
+            REQUIRE(table.lookup(i, j) == reference.lookup(i, j));
+        }
+    }
+}
\ No newline at end of file
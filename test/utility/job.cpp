@@ -0,0 +1,109 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <utility/Job.h>
+#include <utility/TaskScheduler.h>
+#include <utility/Exceptions.h>
+#include <mini/Golden.h>
+#include <mini/detail/Parameter.h>
+#include <settings/GridSettings.h>
+
+#include <atomic>
+#include <chrono>
+#include <vector>
+
+using namespace utility::job;
+
+TEST_CASE("Job::get") {
+    SECTION("value") {
+        auto job = run([] () {return 42;});
+        CHECK(job.valid());
+        CHECK(job.get() == 42);
+    }
+
+    SECTION("exception") {
+        auto job = run([] () -> int {throw except::invalid_argument("test");});
+        CHECK_THROWS_AS(job.get(), except::invalid_argument);
+    }
+
+    SECTION("settings context") {
+        auto width = settings::grid::width;
+        settings::grid::width = 0.123;
+        auto job = run([] () {return settings::grid::width;});
+        CHECK(job.get() == 0.123);
+        settings::grid::width = width;
+    }
+}
+
+TEST_CASE("Job::cancel") {
+    SECTION("cooperative") {
+        std::atomic<bool> started = false;
+        auto job = run([&started] () {
+            started = true;
+            while (true) {
+                check_cancelled();
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+        });
+        while (!started) {std::this_thread::yield();}
+        CHECK(!job.is_done());
+        job.cancel();
+        CHECK_THROWS_AS(job.get(), except::cancelled);
+    }
+
+    SECTION("reassignment cancels the previous job") {
+        std::atomic<bool> stopped = false;
+        auto job = run([&stopped] () {
+            while (!is_cancelled()) {std::this_thread::sleep_for(std::chrono::milliseconds(1));}
+            stopped = true;
+        });
+        job = run([] () {});
+        CHECK(stopped);
+    }
+
+    SECTION("minimizer") {
+        auto job = run([] () {
+            mini::Golden minimizer([] (std::vector<double> p) {
+                if (p[0] > 0) {get_token()->cancel();}
+                return p[0]*p[0];
+            }, mini::Parameter{"a", -1, {-2, 2}});
+            return minimizer.landscape(100);
+        });
+        CHECK_THROWS_AS(job.get(), except::cancelled);
+    }
+
+    SECTION("task group") {
+        utility::multi_threading::TaskScheduler scheduler(2);
+        std::atomic<unsigned int> count = 0;
+        auto job = run([&scheduler, &count] () {
+            get_token()->cancel();
+            utility::multi_threading::TaskGroup tasks(&scheduler);
+            for (unsigned int i = 0; i < 100; ++i) {
+                tasks.run([&count] () {++count;});
+            }
+            tasks.wait();
+        });
+        CHECK_THROWS_AS(job.get(), except::cancelled);
+        CHECK(count == 0);
+    }
+}
+
+TEST_CASE("Job::progress") {
+    std::vector<Progress> reports;
+    auto job = run([] () {
+        for (unsigned int i = 0; i <= 3; ++i) {report_progress("stage", i, 3);}
+    }, [&reports] (const Progress& progress) {reports.push_back(progress);});
+    job.get();
+
+    REQUIRE(reports.size() == 4);
+    for (unsigned int i = 0; i < reports.size(); ++i) {
+        CHECK(reports[i].stage == "stage");
+        CHECK(reports[i].step == i);
+        CHECK(reports[i].total == 3);
+    }
+
+    // outside of a job, nothing happens
+    CHECK(get_token() == nullptr);
+    CHECK(!is_cancelled());
+    CHECK_NOTHROW(check_cancelled());
+    CHECK_NOTHROW(report_progress("stage", 0));
+}
\ No newline at end of file
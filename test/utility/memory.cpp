@@ -0,0 +1,139 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <utility/Memory.h>
+#include <container/ThreadLocalWrapper.h>
+#include <hydrate/GridObj.h>
+#include <settings/GeneralSettings.h>
+
+#include <vector>
+#include <limits>
+
+using namespace utility::memory;
+
+TEST_CASE("Account::Account") {
+    auto base = get_usage(Subsystem::Table).current;
+
+    SECTION("construct & destroy") {
+        {
+            Account account(Subsystem::Table, 100);
+            CHECK(account.get() == 100);
+            CHECK(get_usage(Subsystem::Table).current == base + 100);
+        }
+        CHECK(get_usage(Subsystem::Table).current == base);
+    }
+
+    SECTION("set") {
+        Account account(Subsystem::Table);
+        account.set(50);
+        CHECK(get_usage(Subsystem::Table).current == base + 50);
+        account.set(20);
+        CHECK(get_usage(Subsystem::Table).current == base + 20);
+    }
+
+    SECTION("copy") {
+        Account account(Subsystem::Table, 100);
+        {
+            Account copy(account);
+            CHECK(get_usage(Subsystem::Table).current == base + 200);
+
+            Account assigned(Subsystem::Table, 10);
+            assigned = account;
+            CHECK(get_usage(Subsystem::Table).current == base + 300);
+        }
+        CHECK(get_usage(Subsystem::Table).current == base + 100);
+    }
+
+    SECTION("move") {
+        Account account(Subsystem::Table, 100);
+        Account moved(std::move(account));
+        CHECK(moved.get() == 100);
+        CHECK(get_usage(Subsystem::Table).current == base + 100);
+
+        Account assigned(Subsystem::Table, 10);
+        assigned = std::move(moved);
+        CHECK(assigned.get() == 100);
+        CHECK(get_usage(Subsystem::Table).current == base + 100);
+    }
+
+    SECTION("peak") {
+        reset_peak();
+        {
+            Account account(Subsystem::Table, 1000);
+        }
+        CHECK(get_usage(Subsystem::Table).current == base);
+        CHECK(get_usage(Subsystem::Table).peak == base + 1000);
+        CHECK(get_total_usage().peak >= 1000);
+        reset_peak();
+        CHECK(get_usage(Subsystem::Table).peak == base);
+    }
+}
+
+TEST_CASE("Memory: subsystems") {
+    SECTION("grid") {
+        auto base = get_usage(Subsystem::Grid).current;
+        {
+            grid::detail::GridObj grid(10, 20, 30);
+            CHECK(get_usage(Subsystem::Grid).current == base + 10*20*30*sizeof(grid::detail::State));
+        }
+        CHECK(get_usage(Subsystem::Grid).current == base);
+    }
+
+    SECTION("thread-local histograms") {
+        auto base = get_usage(Subsystem::Histogram).current;
+        {
+            container::ThreadLocalWrapper<std::vector<double>> wrapper(100);
+            CHECK(wrapper.instance_bytes() == 100*sizeof(double));
+            CHECK(get_usage(Subsystem::Histogram).current == base + 100*sizeof(double));
+        }
+        CHECK(get_usage(Subsystem::Histogram).current == base);
+    }
+}
+
+TEST_CASE("Memory::job_size") {
+    auto budget = settings::general::memory_budget;
+    int default_size = settings::general::detail::job_size;
+
+    SECTION("no budget") {
+        settings::general::memory_budget = 0;
+        CHECK(get_remaining_budget() == std::numeric_limits<std::size_t>::max());
+        CHECK(job_size(100*default_size, 1ull << 40) == default_size);
+    }
+
+    SECTION("budget") {
+        settings::general::memory_budget = 1;
+        std::size_t remaining = get_remaining_budget();
+        REQUIRE(remaining <= 1024*1024);
+
+        // everything fits
+        CHECK(job_size(100*default_size, 1) == default_size);
+
+        // only two copies fit
+        std::size_t copy = remaining/2;
+        if (copy != 0) {
+            CHECK(job_size(100*default_size, copy) == 50*default_size);
+        }
+
+        // nothing fits, so everything is done in a single job
+        CHECK(job_size(100*default_size, 1ull << 40) == 100*default_size);
+    }
+
+    SECTION("shared budget") {
+        settings::general::memory_budget = 1;
+        std::size_t remaining = get_remaining_budget();
+        REQUIRE(remaining <= 1024*1024);
+
+        // two copies of each loop would fit on their own, but the loops run at the same time and must share the budget
+        std::size_t copy = remaining/4;
+        if (copy != 0) {
+            auto sizes = job_sizes({{100*default_size, copy}, {100*default_size, copy}});
+            REQUIRE(sizes.size() == 2);
+            CHECK(sizes[0] == 50*default_size);
+            CHECK(sizes[1] == 50*default_size);
+            CHECK(job_size(100*default_size, 2*copy) == 50*default_size);
+        }
+
+        // the budget is a soft limit, so a loop always gets at least one job even if its copy does not fit
+        CHECK(job_sizes({{default_size, 1ull << 40}, {100*default_size, 1}}) == std::vector<int>{default_size, 100*default_size});
+    }
+    settings::general::memory_budget = budget;
+}
\ No newline at end of file
@@ -0,0 +1,104 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <utility/TaskScheduler.h>
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+using namespace utility::multi_threading;
+
+TEST_CASE("TaskScheduler::submit") {
+    TaskScheduler scheduler(4);
+    REQUIRE(scheduler.get_thread_count() == 4);
+    CHECK(!scheduler.is_worker());
+
+    std::atomic<unsigned int> count = 0;
+    {
+        TaskGroup tasks(&scheduler);
+        for (unsigned int i = 0; i < 1000; ++i) {
+            tasks.run([&count] () {++count;});
+        }
+        tasks.wait();
+        CHECK(count == 1000);
+    }
+}
+
+TEST_CASE("TaskGroup") {
+    TaskScheduler scheduler(3);
+
+    SECTION("nested groups") {
+        // every task waits on its own group of subtasks, which must not deadlock even with more tasks than workers
+        std::vector<unsigned int> sums(20, 0);
+        TaskGroup outer(&scheduler);
+        for (unsigned int i = 0; i < sums.size(); ++i) {
+            outer.run([&scheduler, &sums, i] () {
+                std::atomic<unsigned int> sum = 0;
+                TaskGroup inner(&scheduler);
+                for (unsigned int j = 1; j <= 10; ++j) {
+                    inner.run([&sum, j] () {sum += j;});
+                }
+                inner.wait();
+                sums[i] = sum;
+            });
+        }
+        outer.wait();
+        for (auto sum : sums) {CHECK(sum == 55);}
+    }
+
+    SECTION("independent groups") {
+        // waiting on one group does not require the tasks of another group to finish
+        std::atomic<bool> release = false;
+        TaskGroup slow(&scheduler), fast(&scheduler);
+        slow.run([&release] () {while (!release) {std::this_thread::yield();}});
+        std::atomic<unsigned int> count = 0;
+        for (unsigned int i = 0; i < 10; ++i) {
+            fast.run([&count] () {++count;});
+        }
+        fast.wait();
+        CHECK(count == 10);
+        release = true;
+        slow.wait();
+    }
+
+    SECTION("waiting only helps its own group") {
+        // a waiting worker must not pick up unrelated tasks, since they could delay its return by an arbitrary amount
+        TaskScheduler single(1);
+        std::atomic<bool> unrelated = false;
+        bool unrelated_during_wait = true;
+        TaskGroup outer(&single), other(&single);
+        outer.run([&] () {
+            TaskGroup inner(&single);
+            std::atomic<unsigned int> count = 0;
+            for (unsigned int i = 0; i < 4; ++i) {
+                inner.run([&count] () {++count;});
+            }
+            other.run([&unrelated] () {unrelated = true;}); // queued last, so it would be the first task taken from the deque
+            inner.wait();
+            unrelated_during_wait = unrelated;
+            CHECK(count == 4);
+        });
+        outer.wait();
+        other.wait();
+        CHECK(!unrelated_during_wait);
+        CHECK(unrelated);
+    }
+
+    SECTION("exceptions") {
+        TaskGroup tasks(&scheduler);
+        std::atomic<unsigned int> count = 0;
+        for (unsigned int i = 0; i < 10; ++i) {
+            tasks.run([&count, i] () {
+                if (i == 5) {throw std::runtime_error("task failed");}
+                ++count;
+            });
+        }
+        CHECK_THROWS(tasks.wait());
+        CHECK(count == 9);
+
+        // the group can be reused after the exception has been reported
+        tasks.run([&count] () {++count;});
+        CHECK_NOTHROW(tasks.wait());
+        CHECK(count == 10);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,74 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <utility/Trace.h>
+#include <settings/GeneralSettings.h>
+
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+
+using namespace utility;
+
+namespace {
+    std::string read(const std::string& path) {
+        std::ifstream in(path);
+        std::stringstream ss;
+        ss << in.rdbuf();
+        return ss.str();
+    }
+
+    unsigned int count(const std::string& text, const std::string& pattern) {
+        unsigned int n = 0;
+        for (auto pos = text.find(pattern); pos != std::string::npos; pos = text.find(pattern, pos+1)) {++n;}
+        return n;
+    }
+}
+
+TEST_CASE("trace::save") {
+    std::string path = settings::general::output + "test/utility/trace.json";
+
+    SECTION("ring buffer") {
+        // the oldest zones are overwritten once the buffer of a thread is full
+        trace::start(path);
+        REQUIRE(trace::is_enabled());
+        std::thread([] () {
+            for (unsigned int i = 0; i < 10; ++i) {trace::Zone zone("old");}
+            for (unsigned int i = 0; i < trace::buffer_capacity; ++i) {trace::Zone zone("new");}
+        }).join();
+        trace::save(path);
+        REQUIRE(!trace::is_enabled());
+
+        auto trace = read(path);
+        CHECK(trace.starts_with("{\"traceEvents\":[\n{\"name\":\"new\",\"ph\":\"X\",\"pid\":0,\"tid\":"));
+        CHECK(trace.ends_with("\n],\"displayTimeUnit\":\"ms\"}\n"));
+        CHECK(count(trace, "\"name\":\"old\"") == 0);
+        CHECK(count(trace, "\"name\":\"new\"") == trace::buffer_capacity);
+
+        // the timestamps are relative to the first kept zone
+        CHECK(count(trace, "\"ts\":0.000,") != 0);
+        CHECK(count(trace, "\"ts\":-") == 0);
+    }
+
+    SECTION("open zones") {
+        // zones which are still open when saving are waited for
+        trace::start(path);
+        std::atomic<bool> ready = false;
+        std::thread thread([&ready] () {
+            trace::Zone zone("late");
+            ready = true;
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        });
+        while (!ready) {std::this_thread::yield();}
+        trace::save(path);
+        thread.join();
+        CHECK(count(read(path), "\"name\":\"late\"") == 1);
+
+        // no zones are recorded after saving
+        std::thread([] () {trace::Zone zone("stopped");}).join();
+        trace::save(path);
+        CHECK(count(read(path), "\"name\":\"stopped\"") == 0);
+    }
+}
\ No newline at end of file